@@ -11,7 +11,7 @@
 
 #include "stm32f4xx.h"
 #include "stm32f4xx_nucleo.h"
-#include "swi2c.h"
+#include "../stm32lib/swi2c.h"
 #include "mpu6050.h"
 #if 1
 #ifdef __GNUC__
@@ -1,5 +1,8 @@
 #include "mpu6050.h"
 
+/* 소프트웨어 I2C 버스, PB_8(SCL), PB_9(SDA) */
+static SWI2C_t mpu6050_bus;
+
 /* Default I2C address */
 #define MPU6050_I2C_ADDR            0xD0
 
@@ -62,23 +65,23 @@ MPU6050_Res_t mpu6050_init(MPU6050_t* mpu6050, MPU6050_Dev_t devnum, MPU6050_Acc
     mpu6050->address = MPU6050_I2C_ADDR | (uint8_t)devnum;
 
     /* Initialize I2C */
-    swi2c_init();
+    swi2c_init(&mpu6050_bus, GPIO_PB_8, GPIO_PB_9, MPU6050_I2C_CLOCK);
     
     /* Check if device is connected */
-    if (swi2c_ready(mpu6050->address) != SWI2C_RES_OK) {
+    if (swi2c_ready(&mpu6050_bus, mpu6050->address) < 0) {
         /* Return error */
         return MPU6050_RES_NOTCONNECT;
     }
     
     /* Check who am I */
-    swi2c_read(mpu6050->address, MPU6050_WHO_AM_I, &temp);
+    swi2c_read(&mpu6050_bus, mpu6050->address, MPU6050_WHO_AM_I, &temp);
     if (temp != MPU6050_I_AM) {
         /* Return error */
         return MPU6050_RES_INVALID;
     }
 
     /* Wakeup MPU6050 */
-    swi2c_write(mpu6050->address, MPU6050_PWR_MGMT_1, 0x00);
+    swi2c_write(&mpu6050_bus, mpu6050->address, MPU6050_PWR_MGMT_1, 0x00);
     
     /* Set sample rate to 1kHz */
     mpu6050_setrate(mpu6050, MPU6050_RATE_1KHZ);
@@ -98,9 +101,9 @@ MPU6050_Res_t mpu6050_setgyro(MPU6050_t* mpu6050, MPU6050_Gyro_t gyro)
     uint8_t temp;
     
     /* Config gyroscope */
-    swi2c_read(mpu6050->address, MPU6050_GYRO_CONFIG, &temp);
+    swi2c_read(&mpu6050_bus, mpu6050->address, MPU6050_GYRO_CONFIG, &temp);
     temp = (temp & 0xE7) | (uint8_t)gyro << 3;
-    swi2c_write(mpu6050->address, MPU6050_GYRO_CONFIG, temp);
+    swi2c_write(&mpu6050_bus, mpu6050->address, MPU6050_GYRO_CONFIG, temp);
     
     switch (gyro) {
     case MPU6050_GYRO_250S:
@@ -127,9 +130,9 @@ MPU6050_Res_t mpu6050_setacc(MPU6050_t* mpu6050, MPU6050_Acc_t acc)
     uint8_t temp;
     
     /* Config accelerometer */
-    swi2c_read(mpu6050->address, MPU6050_ACCEL_CONFIG, &temp);
+    swi2c_read(&mpu6050_bus, mpu6050->address, MPU6050_ACCEL_CONFIG, &temp);
     temp = (temp & 0xE7) | (uint8_t)acc << 3;
-    swi2c_write(mpu6050->address, MPU6050_ACCEL_CONFIG, temp);
+    swi2c_write(&mpu6050_bus, mpu6050->address, MPU6050_ACCEL_CONFIG, temp);
     
     /* Set sensitivities for multiplying gyro and accelerometer data */
     switch (acc) {
@@ -155,7 +158,7 @@ MPU6050_Res_t mpu6050_setacc(MPU6050_t* mpu6050, MPU6050_Acc_t acc)
 MPU6050_Res_t mpu6050_setrate(MPU6050_t* mpu6050, uint8_t rate)
 {
     /* Set data sample rate */
-    if (swi2c_write(mpu6050->address, MPU6050_SMPLRT_DIV, rate) != SWI2C_RES_OK) {
+    if (swi2c_write(&mpu6050_bus, mpu6050->address, MPU6050_SMPLRT_DIV, rate) < 0) {
         /* Return error */
         return MPU6050_RES_ERR;
     }
@@ -168,7 +171,7 @@ MPU6050_Res_t mpu6050_readacc(MPU6050_t* mpu6050) {
     uint8_t data[6];
     
     /* Read accelerometer data */
-    swi2c_readmulti(mpu6050->address, MPU6050_ACCEL_XOUT_H, data, 6);
+    swi2c_nread(&mpu6050_bus, mpu6050->address, MPU6050_ACCEL_XOUT_H, data, 6);
     
     /* Format */
     mpu6050->acc_x = (int16_t)(data[0] << 8 | data[1]);    
@@ -184,7 +187,7 @@ MPU6050_Res_t mpu6050_readgyro(MPU6050_t* mpu6050)
     uint8_t data[6];
     
     /* Read gyroscope data */
-    swi2c_readmulti(mpu6050->address, MPU6050_GYRO_XOUT_H, data, 6);
+    swi2c_nread(&mpu6050_bus, mpu6050->address, MPU6050_GYRO_XOUT_H, data, 6);
     
     /* Format */
     mpu6050->gyro_x = (int16_t)(data[0] << 8 | data[1]);
@@ -201,7 +204,7 @@ MPU6050_Res_t mpu6050_readtemp(MPU6050_t* mpu6050)
     int16_t temp;
     
     /* Read temperature */
-    swi2c_readmulti(mpu6050->address, MPU6050_TEMP_OUT_H, data, 2);
+    swi2c_nread(&mpu6050_bus, mpu6050->address, MPU6050_TEMP_OUT_H, data, 2);
     
     /* Format temperature */
     temp = (data[0] << 8 | data[1]);
@@ -217,7 +220,7 @@ MPU6050_Res_t mpu6050_readall(MPU6050_t* mpu6050)
     int16_t temp;
     
     /* Read full raw data, 14bytes */
-    swi2c_readmulti(mpu6050->address, MPU6050_ACCEL_XOUT_H, data, 14);
+    swi2c_nread(&mpu6050_bus, mpu6050->address, MPU6050_ACCEL_XOUT_H, data, 14);
     
     /* Format accelerometer data */
     mpu6050->acc_x = (int16_t)(data[0] << 8 | data[1]);    
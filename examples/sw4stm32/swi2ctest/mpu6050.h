@@ -7,7 +7,7 @@ extern "C" {
 #endif
 
 #include "stm32f4xx.h"
-#include "swi2c.h"
+#include "../stm32lib/swi2c.h"
 
 /* 기본 I2C 클록 */
 #ifndef MPU6050_I2C_CLOCK
@@ -45,6 +45,10 @@ static void clcd_write_data(uint8_t data);
 /* Private variable */
 static CLCD_Options_t clcd_options;
 
+/* D4~D7 이 한 포트에 있으면 니블을 한 번의 BSRR 쓰기로 출력한다 */
+static GPIO_Group_t clcd_data;
+static uint8_t clcd_grouped;
+
 /* Pin definitions */
 #define CLCD_RS_LOW              gpio_write(CLCD_RS_PIN, 0)
 #define CLCD_RS_HIGH             gpio_write(CLCD_RS_PIN, 1)
@@ -308,27 +312,41 @@ static void clcd_write_data(uint8_t data) {
 
 static void clcd_write4bit(uint8_t cmd) {
     /* Set output port */
-    gpio_write(CLCD_D7_PIN, (cmd >> 3) & 0x01);
-    gpio_write(CLCD_D6_PIN, (cmd >> 2) & 0x01);
-    gpio_write(CLCD_D5_PIN, (cmd >> 1) & 0x01);
-    gpio_write(CLCD_D4_PIN, (cmd >> 0) & 0x01);
+    if (clcd_grouped) {
+        gpio_group_write(&clcd_data, cmd & 0x0F);
+    } else {
+        gpio_write(CLCD_D7_PIN, (cmd >> 3) & 0x01);
+        gpio_write(CLCD_D6_PIN, (cmd >> 2) & 0x01);
+        gpio_write(CLCD_D5_PIN, (cmd >> 1) & 0x01);
+        gpio_write(CLCD_D4_PIN, (cmd >> 0) & 0x01);
+    }
     CLCD_E_BLINK;
 }
 
 static void clcd_initpins(void) {
+    static const GPIO_Pin_t data[4] = {CLCD_D4_PIN, CLCD_D5_PIN, CLCD_D6_PIN, CLCD_D7_PIN};
+
     /* Init all pins */
     gpio_init(CLCD_RS_PIN, GPIO_OUT);
     gpio_init(CLCD_E_PIN,  GPIO_OUT);
-    gpio_init(CLCD_D4_PIN, GPIO_OUT);
-    gpio_init(CLCD_D5_PIN, GPIO_OUT);
-    gpio_init(CLCD_D6_PIN, GPIO_OUT);
-    gpio_init(CLCD_D7_PIN, GPIO_OUT);
+    /* 데이터 핀이 여러 포트에 나뉘어 있으면 핀마다 쓴다 */
+    clcd_grouped = (gpio_group_init(&clcd_data, data, 4, GPIO_OUT) > 0);
+    if (!clcd_grouped) {
+        gpio_init(CLCD_D4_PIN, GPIO_OUT);
+        gpio_init(CLCD_D5_PIN, GPIO_OUT);
+        gpio_init(CLCD_D6_PIN, GPIO_OUT);
+        gpio_init(CLCD_D7_PIN, GPIO_OUT);
+    }
     
     /* Set pins low */
     gpio_write(CLCD_RS_PIN, 0);
     gpio_write(CLCD_E_PIN, 0);
-    gpio_write(CLCD_D4_PIN, 0);
-    gpio_write(CLCD_D5_PIN, 0);
-    gpio_write(CLCD_D6_PIN, 0);
-    gpio_write(CLCD_D7_PIN, 0);
+    if (clcd_grouped) {
+        gpio_group_write(&clcd_data, 0);
+    } else {
+        gpio_write(CLCD_D4_PIN, 0);
+        gpio_write(CLCD_D5_PIN, 0);
+        gpio_write(CLCD_D6_PIN, 0);
+        gpio_write(CLCD_D7_PIN, 0);
+    }
 }
@@ -89,6 +89,8 @@ K     GND               백라이트를 위한 접지
 #define CLCD_D7_PORT     GPIOC
 #define CLCD_D7_PIN      0
 \endcode
+ *
+ * D4~D7 을 한 포트에 두면 니블을 @ref gpio_group_write() 로 한 번에 출력하므로 네 핀이 동시에 바뀐다.
  *
  * \par Changelog
  *
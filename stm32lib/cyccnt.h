@@ -0,0 +1,99 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+#ifndef CYCCNT_H
+#define CYCCNT_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup stm32lib
+ * @{
+ */
+
+/**
+ * @defgroup CYCCNT
+ * @brief    DWT 사이클 카운터 켜기
+ * @{
+ *
+ * 시간 측정과 짧은 지연에 DWT->CYCCNT 를 쓰는 모듈들이 공유한다.
+ * 카운터는 한 번 켜면 계속 돌고, 여러 번 켜도 해가 없다.
+ * 첫 시각을 재기 전에 켜야 하므로 각 모듈의 초기화 함수나 첫 측정 지점에서 부른다.
+ *
+ * \par Changelog
+ *
+\verbatim
+ 버전 1.0
+  - 최초 배포
+\endverbatim
+ *
+ * \par 의존성
+ *
+\verbatim
+ - STM32F4xx HAL
+\endverbatim
+ */
+#include "stm32f4xx_hal.h"
+
+/**
+ * @defgroup CYCCNT_함수
+ * @brief    CYCCNT 함수
+ * @{
+ */
+
+/**
+ * @brief  DWT 사이클 카운터(CYCCNT)를 켠다
+ * @param  없음
+ * @retval 없음
+ */
+static inline void cyccnt_enable(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
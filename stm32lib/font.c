@@ -453,6 +453,8 @@ Font_t Font_16x26 = {
 };
 
 #include "../stm32lib/hangulfont.h"
+#include "../stm32lib/pagefont.h"
+#include "../stm32lib/fontstore.h"
 
 FontSet_t FontSet_10 = {
     10,
@@ -486,34 +488,190 @@ FontSet_t FontSet_26 = {
 };
 
 void font_getstringsize(char* str, FontSize_t* SizeStruct, FontSet_t* fontset) {
-    int i;
-    char c, c2, c3;
-    uint16_t utf16;
+    uint16_t utf16, next;
+    Font_t *font;
     int width=0;
 
     /* Fill settings */
     SizeStruct->height = fontset->height;
 
-    while (*str) {
-        c = *str++;
-        // convert utf-8 to unicode
-        if (c <= 0xFF){
-            utf16 = c;
-        } else {
-            /*------------------------------
-              UTF-8 을 UTF-16으로 변환한다.  UTF-8 1110xxxx 10xxxxxx 10xxxxxx
-            ------------------------------*/
-            c2 = *str++;
-            c3 = *str++;
-            utf16 = ((c & 0x0f) << 12) | ((c2 & 0x3f) << 6) | (c3 & 0x3f);
+    utf16 = font_getutf16(&str);
+    while (utf16) {
+        next = font_getutf16(&str);
+        font = font_find(utf16, fontset);
+        if (font)
+            width += font_getadvance(font, utf16, next);
+        utf16 = next;
+    }
+    SizeStruct->width = width;
+}
+
+uint16_t font_getutf16(char** str) {
+    uint8_t c, c2, c3;
+
+    c = (uint8_t)*(*str);
+    if (c == 0)
+        return 0;
+    (*str)++;
+    // convert utf-8 to unicode
+    if (c <= 0x7F)
+        return c;
+    /*------------------------------
+      UTF-8 을 UTF-16으로 변환한다.  UTF-8 1110xxxx 10xxxxxx 10xxxxxx
+    ------------------------------*/
+    if ((c2 = (uint8_t)*(*str)) != 0)
+        (*str)++;
+    if ((c3 = (uint8_t)*(*str)) != 0)
+        (*str)++;
+    return ((c & 0x0f) << 12) | ((c2 & 0x3f) << 6) | (c3 & 0x3f);
+}
+
+Font_t* font_find(uint16_t ch, FontSet_t* fontset) {
+    int i;
+
+    for (i = 0; i < 5 && fontset->fontlist[i]; i++) {
+        Font_t *font = fontset->fontlist[i];
+        if (ch >= font->first && ch <= font->last)
+            return font;
+    }
+    return NULL;
+}
+
+int8_t font_getkerning(Font_t* font, uint16_t ch, uint16_t next) {
+    const GFXFont_t *gfxfont;
+    const GFXKern_t *kern;
+    int lo, hi, mid;
+    uint32_t key, k;
+
+    if (font->type != GFX_FONT || next == 0)
+        return 0;
+    gfxfont = font->data.gfxfont;
+    if (gfxfont->kern == NULL || gfxfont->kerncount == 0)
+        return 0;
+
+    /* 정렬된 커닝 쌍 테이블에서 이진 탐색 */
+    key = ((uint32_t)ch << 16) | next;
+    lo = 0;
+    hi = gfxfont->kerncount - 1;
+    while (lo <= hi) {
+        mid = (lo + hi) / 2;
+        kern = &gfxfont->kern[mid];
+        k = ((uint32_t)kern->first << 16) | kern->second;
+        if (k == key)
+            return kern->adjust;
+        if (k < key)
+            lo = mid + 1;
+        else
+            hi = mid - 1;
+    }
+    return 0;
+}
+
+int16_t font_getadvance(Font_t* font, uint16_t ch, uint16_t next) {
+    const GFXFont_t *gfxfont;
+
+    if (font->type != GFX_FONT)
+        return font->width;
+    gfxfont = font->data.gfxfont;
+    return gfxfont->glyph[ch - gfxfont->first].xAdvance + font_getkerning(font, ch, next);
+}
+
+void font_getglyph(Font_t* font, uint16_t ch, FontGlyph_t* glyph) {
+    uint16_t i, j, p;
+
+    memset(glyph, 0, sizeof(FontGlyph_t));
+    glyph->width = (font->width > 32) ? 32 : font->width;
+    glyph->height = (font->height > FONT_GLYPH_MAX_ROWS) ? FONT_GLYPH_MAX_ROWS : font->height;
+
+    if (font->type == ASCII_FONT) {
+        const uint16_t *data = &font->data.data[(ch - font->first) * font->height];
+        for (i = 0; i < glyph->height; i++)
+            glyph->rows[i] = (uint32_t)data[i] << 16;
+    } else if (font->type == GFX_FONT) {
+        const GFXFont_t *gfxfont = font->data.gfxfont;
+        GFXglyph *g = &(gfxfont->glyph)[ch - gfxfont->first];
+        uint32_t bo = g->bitmapOffset;
+        uint8_t bits = 0, bit = 0;
+
+        glyph->x = g->xOffset;
+        glyph->y = g->yOffset + GFXFONT_BASELINE(gfxfont);
+        glyph->width = (g->width > 32) ? 32 : g->width;
+        glyph->height = (g->height > FONT_GLYPH_MAX_ROWS) ? FONT_GLYPH_MAX_ROWS : g->height;
+        for (i = 0; i < glyph->height; i++) {
+            for (j = 0; j < g->width; j++) {
+                if (!(bit++ & 7))
+                    bits = gfxfont->bitmap[bo++];
+                if ((bits & 0x80) && j < 32)
+                    glyph->rows[i] |= 0x80000000UL >> j;
+                bits <<= 1;
+            }
         }
-        for (i = 0; fontset->fontlist[i] && i < 5; i++) {
-            Font_t *font = fontset->fontlist[i];
-            if (utf16 >= font->first && utf16 <= font->last) {
-                width += font->width;
-                break;
+    } else if (font->type == COMB_FONT) {
+        uint8_t wb = font->width / 8;
+        uint8_t *pFs = get_hangul_glyph(ch, font);
+        for (i = 0; i < glyph->height; i++)
+            for (j = 0; j < wb && j < 4; j++)
+                glyph->rows[i] |= (uint32_t)pFs[i*wb + j] << (24 - 8*j);
+    } else if (font->type == STORE_FONT) {
+        uint8_t wb = (font->width + 7) / 8;
+        uint8_t *pFs = fontstore_getglyph(ch, font);
+        for (i = 0; i < glyph->height && (i + 1) * wb <= FONTSTORE_MAX_GLYPH; i++)
+            for (j = 0; j < wb && j < 4; j++)
+                glyph->rows[i] |= (uint32_t)pFs[i*wb + j] << (24 - 8*j);
+    } else if (font->type == PAGE_FONT) {
+        const uint8_t *pFs = font->data.page + (ch - font->first) * PAGEFONT_GLYPH_SIZE(font);
+        for (p = 0; p < PAGEFONT_PAGES(font); p++)
+            for (i = 0; i < glyph->width; i++)
+                for (j = 0; j < 8 && p*8 + j < glyph->height; j++)
+                    if ((pFs[p*font->width + i] >> j) & 0x01)
+                        glyph->rows[p*8 + j] |= 0x80000000UL >> i;
+    }
+}
+
+/* 글자 밖은 0으로 보는 픽셀 읽기 */
+static uint8_t font_glyphpixel(const FontGlyph_t* glyph, int x, int y) {
+    if (x < 0 || y < 0 || x >= glyph->width || y >= glyph->height)
+        return 0;
+    return (glyph->rows[y] >> (31 - x)) & 0x01;
+}
+
+int font_scale2x(const FontGlyph_t* src, FontGlyph_t* dst) {
+    int x, y;
+    uint8_t a, b, c, d, e;
+    uint8_t e0, e1, e2, e3;
+
+    if (src->width > 16 || src->height * 2 > FONT_GLYPH_MAX_ROWS)
+        return 0;
+
+    memset(dst, 0, sizeof(FontGlyph_t));
+    dst->x = src->x * 2;
+    dst->y = src->y * 2;
+    dst->width = src->width * 2;
+    dst->height = src->height * 2;
+
+    /*------------------------------
+      scale2x: 각 픽셀 E를 위(A), 오른쪽(B), 왼쪽(C), 아래(D) 이웃에 따라 2x2 로 확대한다.
+    ------------------------------*/
+    for (y = 0; y < src->height; y++) {
+        for (x = 0; x < src->width; x++) {
+            a = font_glyphpixel(src, x, y - 1);
+            b = font_glyphpixel(src, x + 1, y);
+            c = font_glyphpixel(src, x - 1, y);
+            d = font_glyphpixel(src, x, y + 1);
+            e = font_glyphpixel(src, x, y);
+            if (b != c && a != d) {
+                e0 = (c == a) ? c : e;
+                e1 = (a == b) ? b : e;
+                e2 = (c == d) ? c : e;
+                e3 = (d == b) ? b : e;
+            } else {
+                e0 = e1 = e2 = e3 = e;
             }
+            if (e0) dst->rows[2*y]     |= 0x80000000UL >> (2*x);
+            if (e1) dst->rows[2*y]     |= 0x80000000UL >> (2*x + 1);
+            if (e2) dst->rows[2*y + 1] |= 0x80000000UL >> (2*x);
+            if (e3) dst->rows[2*y + 1] |= 0x80000000UL >> (2*x + 1);
         }
     }
-    SizeStruct->width = width;
+    return 1;
 }
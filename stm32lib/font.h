@@ -76,6 +76,20 @@ extern "C" {
  */
 #define PROGMEM
 
+/**
+ * @brief  GFX 폰트에서 글자 줄의 위쪽부터 기준선(baseline)까지의 픽셀 수
+ * @note   GFXglyph 의 yOffset 은 기준선에 대한 값이므로, 커서 위치(줄의 위쪽)에
+ *         이 값을 더하여 기준선을 구한다. 줄 간격(yAdvance)의 3/4 을 사용한다.
+ */
+#define GFXFONT_BASELINE(gfxfont)   (((gfxfont)->yAdvance * 3) / 4)
+
+/**
+ * @brief  @ref FontGlyph_t 에 담을 수 있는 최대 행 수
+ */
+#ifndef FONT_GLYPH_MAX_ROWS
+#define FONT_GLYPH_MAX_ROWS         64
+#endif
+
 /**
  * @defgroup FONT_자료형
  * @brief    FONT 자료형
@@ -89,6 +103,8 @@ typedef enum {
     ASCII_FONT,
     GFX_FONT,
     COMB_FONT,
+    PAGE_FONT,      /*!< 세로 8 픽셀 페이지 형식의 폰트, @ref PAGEFONT 참조 */
+    STORE_FONT,     /*!< 외부 저장장치에 있는 폰트, @ref FONTSTORE 참조 */
 } FontType_t;
 
 typedef struct {               /* Data stored PER GLYPH */
@@ -98,11 +114,19 @@ typedef struct {               /* Data stored PER GLYPH */
     int8_t   xOffset, yOffset; /* Dist from cursor pos to UL corner */
 } GFXglyph;
 
+typedef struct {           /* Data stored PER KERNING PAIR */
+    uint16_t first;        /* Left character code */
+    uint16_t second;       /* Right character code */
+    int8_t   adjust;       /* Added to xAdvance of the left character */
+} GFXKern_t;
+
 typedef struct {           /* Data stored for FONT AS A WHOLE: */
     uint8_t  *bitmap;      /* Glyph bitmaps, concatenated */
     GFXglyph *glyph;       /* Glyph array */
     uint16_t  first, last; /* ASCII extents */
     uint8_t   yAdvance;    /* Newline distance (y axis) */
+    const GFXKern_t *kern; /* Kerning pairs sorted by (first, second), optional */
+    uint16_t  kerncount;   /* Number of kerning pairs */
 } GFXFont_t;
 
 typedef struct {           /* Data stored for FONT AS A WHOLE: */
@@ -111,6 +135,11 @@ typedef struct {           /* Data stored for FONT AS A WHOLE: */
     uint8_t   yAdvance;    /* Newline distance (y axis) */
 } CombFont_t;
 
+/**
+ * @brief  외부 저장장치 폰트 데이터, @ref FONTSTORE 에 정의됨
+ */
+typedef struct StoreFont StoreFont_t;
+
 /**
  * @brief  폰트 공용체
  */
@@ -118,6 +147,8 @@ typedef union {
     const uint16_t   *data; /*!< 폰트 데이터 배열에 대한 포인터 */
     const GFXFont_t  *gfxfont;
     const CombFont_t *combfont;
+    const uint8_t    *page; /*!< 페이지 형식 폰트 데이터 배열에 대한 포인터 */
+    const StoreFont_t *store; /*!< 외부 저장장치 폰트 데이터에 대한 포인터 */
 } FontData_t;
 
 /**
@@ -139,6 +170,18 @@ typedef struct {
     uint16_t height;      /*!< 픽셀 단위의 문자열 높이 */
 } FontSize_t;
 
+/**
+ * @brief  폰트 종류에 상관없이 행 단위 비트열로 풀어 놓은 글자 구조체
+ * @note   각 행은 MSB가 가장 왼쪽 픽셀이며, 최대 32 픽셀 넓이까지 담는다
+ */
+typedef struct {
+    int8_t   x;       /*!< 커서 위치에서 글자 왼쪽까지의 픽셀 수 */
+    int8_t   y;       /*!< 커서 위치에서 글자 위쪽까지의 픽셀 수 */
+    uint8_t  width;   /*!< 픽셀 단위의 글자 넓이 */
+    uint8_t  height;  /*!< 픽셀 단위의 글자 높이 */
+    uint32_t rows[FONT_GLYPH_MAX_ROWS]; /*!< 행 단위 비트열 */
+} FontGlyph_t;
+
 /**
  * @brief  LCD 라이브러리에 사용되는 폰트셋 구조체
  */
@@ -205,6 +248,58 @@ extern FontSet_t FontSet_26;
  */
 void font_getstringsize(char* str, FontSize_t* SizeStruct, FontSet_t* fontset);
 
+/**
+ * @brief  UTF-8 문자열에서 한 글자를 읽어 UTF-16 코드로 변환한다
+ * @param  **str: 읽을 문자열 포인터의 주소. 읽은 글자 다음 위치로 이동된다
+ * @retval 글자의 UTF-16 코드, 문자열의 끝이면 0
+ */
+uint16_t font_getutf16(char** str);
+
+/**
+ * @brief  폰트셋에서 글자를 포함하는 폰트를 찾는다
+ * @param  ch: 찾을 글자의 UTF-16 코드
+ * @param  *fontset: 찾을 @ref FontSet_t 폰트셋 구조체의 포인터
+ * @retval 글자를 포함하는 @ref Font_t 폰트 구조체의 포인터, 없으면 NULL
+ */
+Font_t* font_find(uint16_t ch, FontSet_t* fontset);
+
+/**
+ * @brief  두 글자 사이의 커닝(kerning) 값을 구한다
+ * @param  *font: 사용된 @ref Font_t 폰트 구조체의 포인터
+ * @param  ch: 왼쪽 글자 코드
+ * @param  next: 오른쪽 글자 코드, 없으면 0
+ * @retval 왼쪽 글자의 진행 거리에 더할 픽셀 수. 커닝 테이블이 없으면 0
+ */
+int8_t font_getkerning(Font_t* font, uint16_t ch, uint16_t next);
+
+/**
+ * @brief  글자를 그린 후에 커서가 진행할 거리를 구한다
+ * @note   GFX 폰트는 글자별 xAdvance 와 커닝 값을 사용하고, 다른 폰트는 폰트 넓이를 사용한다
+ * @param  *font: 사용된 @ref Font_t 폰트 구조체의 포인터
+ * @param  ch: 그린 글자 코드
+ * @param  next: 다음 글자 코드, 없으면 0
+ * @retval 픽셀 단위의 진행 거리
+ */
+int16_t font_getadvance(Font_t* font, uint16_t ch, uint16_t next);
+
+/**
+ * @brief  글자를 행 단위 비트열로 풀어 놓는다
+ * @note   확대 출력처럼 글자 전체를 여러 번 읽어야 하는 경우에 사용한다
+ * @param  *font: 사용된 @ref Font_t 폰트 구조체의 포인터
+ * @param  ch: 풀어 놓을 글자 코드
+ * @param  *glyph: 결과를 저장할 @ref FontGlyph_t 구조체의 포인터
+ * @retval 없음
+ */
+void font_getglyph(Font_t* font, uint16_t ch, FontGlyph_t* glyph);
+
+/**
+ * @brief  scale2x 알고리즘으로 글자를 두 배 확대하여 대각선 계단을 부드럽게 한다
+ * @param  *src: 원본 @ref FontGlyph_t 구조체의 포인터
+ * @param  *dst: 결과를 저장할 @ref FontGlyph_t 구조체의 포인터
+ * @retval 1: 정상, 0: 확대한 글자가 @ref FontGlyph_t 에 들어가지 않음
+ */
+int font_scale2x(const FontGlyph_t* src, FontGlyph_t* dst);
+
 /**
  * @}
  */
@@ -0,0 +1,197 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+#include "../stm32lib/fontstore.h"
+#include "../stm32lib/cyccnt.h"
+
+int fontstore_init(FontStore_t* store, FontStoreRead_t read, void* ctx, uint32_t size, uint8_t* cache, uint16_t blocksize, uint8_t nblocks, uint8_t readahead)
+{
+    memset(store, 0, sizeof(FontStore_t));
+    if (size == 0 || blocksize == 0 || nblocks == 0)
+        return -1;
+    store->read = read;
+    store->ctx = ctx;
+    store->size = size;
+    store->cache = cache;
+    store->blocksize = blocksize;
+    store->nblocks = (nblocks > FONTSTORE_MAX_BLOCKS) ? FONTSTORE_MAX_BLOCKS : nblocks;
+    /* 미리 읽은 블록이 지금 읽은 블록을 밀어내지 않도록 한다 */
+    store->readahead = (readahead >= store->nblocks) ? store->nblocks - 1 : readahead;
+
+    /* 읽기 시간을 잴 사이클 카운터 */
+    cyccnt_enable();
+    return 1;
+}
+
+void fontstore_flush(FontStore_t* store)
+{
+    memset(store->tag, 0, sizeof(store->tag));
+}
+
+/* 캐시에서 블록을 찾는다 */
+static int fontstore_lookup(FontStore_t* store, uint32_t block)
+{
+    int i;
+
+    for (i = 0; i < store->nblocks; i++)
+        if (store->tag[i] == block + 1)
+            return i;
+    return -1;
+}
+
+/* 빈 블록이나 가장 오래 사용되지 않은 블록을 고른다 */
+static int fontstore_victim(FontStore_t* store)
+{
+    int i, victim = 0;
+
+    for (i = 0; i < store->nblocks; i++) {
+        if (store->tag[i] == 0)
+            return i;
+        if ((int32_t)(store->age[i] - store->age[victim]) < 0)
+            victim = i;
+    }
+    return victim;
+}
+
+/* 저장장치에서 블록을 읽어 캐시에 넣는다. 마지막 블록은 저장장치 끝까지만 읽는다 */
+static int fontstore_fetch(FontStore_t* store, uint32_t block)
+{
+    int i = fontstore_victim(store);
+    uint32_t addr = block * store->blocksize;
+    uint32_t len = store->size - addr;
+    uint32_t start, cycles;
+
+    if (len > store->blocksize)
+        len = store->blocksize;
+    store->tag[i] = 0;
+    start = FONTSTORE_TIMESTAMP();
+    if (store->read(store->ctx, addr, &store->cache[i * store->blocksize], len) < 0)
+        return -1;
+    cycles = FONTSTORE_TIMESTAMP() - start;
+
+    store->stats.bytes += len;
+    store->stats.cycles += cycles;
+    if (cycles > store->stats.maxcycles)
+        store->stats.maxcycles = cycles;
+    store->tag[i] = block + 1;
+    store->age[i] = ++store->clock;
+    return i;
+}
+
+/* 저장장치 전체의 블록 수 */
+static uint32_t fontstore_nblocks(FontStore_t* store)
+{
+    return (store->size - 1) / store->blocksize + 1;
+}
+
+/* 블록이 들어 있는 캐시 블록 번호를 얻는다. 없으면 읽어 온다 */
+static int fontstore_block(FontStore_t* store, uint32_t block)
+{
+    int i, n;
+
+    if ((i = fontstore_lookup(store, block)) >= 0) {
+        store->stats.hits++;
+        store->age[i] = ++store->clock;
+        return i;
+    }
+
+    store->stats.misses++;
+    if ((i = fontstore_fetch(store, block)) < 0) {
+        store->stats.errors++;
+        return -1;
+    }
+
+    /* 다음 블록들을 미리 읽는다. 저장장치 끝에 닿거나 읽기에 실패하면 그만둔다 */
+    for (n = 1; n <= store->readahead; n++) {
+        if (block + n >= fontstore_nblocks(store))
+            break;
+        if (fontstore_lookup(store, block + n) >= 0)
+            continue;
+        if (fontstore_fetch(store, block + n) < 0)
+            break;
+        store->stats.readaheads++;
+    }
+    return i;
+}
+
+int fontstore_read(FontStore_t* store, uint32_t addr, uint8_t* buf, uint32_t len)
+{
+    uint32_t block, offset, n;
+    int i;
+
+    /* 초기화에 실패한 저장소이거나 저장장치 밖 */
+    if (store->nblocks == 0 || addr >= store->size || len > store->size - addr)
+        return -1;
+    while (len > 0) {
+        block = addr / store->blocksize;
+        offset = addr % store->blocksize;
+        n = store->blocksize - offset;
+        if (n > len)
+            n = len;
+
+        if ((i = fontstore_block(store, block)) < 0)
+            return -1;
+        memcpy(buf, &store->cache[i * store->blocksize + offset], n);
+
+        addr += n;
+        buf += n;
+        len -= n;
+    }
+    return 1;
+}
+
+uint8_t* fontstore_getglyph(uint16_t ch, Font_t* font)
+{
+    const StoreFont_t *data = font->data.store;
+    FontStore_t *store = data->store;
+    uint32_t stride = ((font->width + 7) / 8) * font->height;
+    uint32_t size = (stride > FONTSTORE_MAX_GLYPH) ? FONTSTORE_MAX_GLYPH : stride;
+
+    if (fontstore_read(store, data->offset + (uint32_t)(ch - font->first) * stride, store->glyph, size) < 0)
+        memset(store->glyph, 0, size);
+    return store->glyph;
+}
+
+void fontstore_getstats(FontStore_t* store, FontStoreStats_t* stats)
+{
+    *stats = store->stats;
+}
+
+void fontstore_resetstats(FontStore_t* store)
+{
+    memset(&store->stats, 0, sizeof(FontStoreStats_t));
+}
+
+int fontstore_memread(void *ctx, uint32_t addr, uint8_t *buf, uint32_t len)
+{
+    const FontStoreMem_t *mem = (const FontStoreMem_t *)ctx;
+
+    if (addr >= mem->size || len > mem->size - addr)
+        return -1;
+    memcpy(buf, mem->base + addr, len);
+    return 1;
+}
@@ -0,0 +1,290 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+#ifndef FONTSTORE_H
+#define FONTSTORE_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup stm32lib
+ * @{
+ */
+
+/**
+ * @defgroup FONTSTORE
+ * @brief    외부 저장장치에 있는 폰트를 블록 캐시를 통해 읽는 라이브러리
+ * @{
+ *
+ * 큰 한글/CJK 폰트처럼 내부 플래시에 넣기 어려운 폰트의 글자 데이터를
+ * SPI NOR 플래시, SD 카드 파일, 메모리 맵 영역 등의 외부 저장장치에서
+ * 필요할 때마다 읽어 온다. 읽은 데이터는 사용자가 제공한 RAM 블록 캐시에 보관되며,
+ * 캐시가 가득 차면 가장 오래 사용되지 않은 블록을 교체한다(LRU).
+ * 캐시에 없는 블록을 읽을 때에는 다음 블록들을 미리 읽어(read-ahead) 둘 수 있다.
+ *
+ * 저장장치는 읽기 함수(@ref FontStoreRead_t) 하나로 추상화되므로,
+ * 같은 폰트 파일을 호스트에서 파일로 읽어 시험할 수도 있다(tools/fontstoretest.c).
+ * 저장장치 크기를 넘는 주소는 읽지 않으므로, 마지막 블록과 미리 읽기도 저장장치 끝에서 멈춘다.
+ *
+ * \par 폰트 데이터 형식
+ *
+ * 글자 코드 first 부터 last 까지의 글자가 빈틈 없이 이어져 있으며, 각 글자는
+ * height 개의 행으로, 각 행은 (width + 7) / 8 바이트로 이루어진다(MSB가 왼쪽 픽셀).
+ * 이는 @ref HANGULFONT 의 조합된 글자와 같은 형식이다.
+ *
+ * \par 사용 예
+ *
+\code
+static uint8_t cache[8 * 256];
+static FontStore_t store;
+static StoreFont_t hangul_data = {&store, 0x100000};
+Font_t Hangul_16x16 = {STORE_FONT, 16, 16, 0xAC00, 0xD7A3, {.store = &hangul_data}};
+
+static int flash_read(void *ctx, uint32_t addr, uint8_t *buf, uint32_t len)
+{
+    //SPI 플래시, SD 카드 파일 등에서 len 바이트를 읽는다
+    return 1;
+}
+
+fontstore_init(&store, flash_read, NULL, 0x100000 + 11172 * 32, cache, 256, 8, 1);
+\endcode
+ *
+ * SD 카드의 폰트 파일은 @ref FONTSTORE_FILE 의 fontstore_fileread() 로 읽는다.
+ *
+ * \par Changelog
+ *
+\verbatim
+ 버전 1.0
+  - 최초 배포
+\endverbatim
+ *
+ * \par 의존성
+ *
+\verbatim
+ - STM32F4xx HAL
+ - FONT
+\endverbatim
+ */
+#include "stm32f4xx_hal.h"
+#include "../stm32lib/font.h"
+
+/**
+ * @defgroup FONTSTORE_매크로
+ * @brief    FONTSTORE 매크로
+ * @{
+ */
+
+/**
+ * @brief  캐시 블록의 최대 개수
+ */
+#ifndef FONTSTORE_MAX_BLOCKS
+#define FONTSTORE_MAX_BLOCKS        32
+#endif
+
+/**
+ * @brief  한 글자의 최대 바이트 수 (기본값은 32 x 32 픽셀)
+ */
+#ifndef FONTSTORE_MAX_GLYPH
+#define FONTSTORE_MAX_GLYPH         128
+#endif
+
+/**
+ * @brief  읽기 시간 측정에 사용하는 사이클 카운터
+ * @note   기본값은 DWT 사이클 카운터이며, 카운터가 동작하지 않으면 읽기 시간은 0 으로 기록된다
+ */
+#ifndef FONTSTORE_TIMESTAMP
+#define FONTSTORE_TIMESTAMP()       (DWT->CYCCNT)
+#endif
+
+/**
+ * @brief  캐시 적중률(%)
+ */
+#define FONTSTORE_HITRATE(stats)    \
+    (((stats)->hits + (stats)->misses) ? (stats)->hits * 100 / ((stats)->hits + (stats)->misses) : 0)
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup FONTSTORE_자료형
+ * @brief    FONTSTORE 자료형
+ * @{
+ */
+
+/**
+ * @brief  저장장치 읽기 함수
+ * @param  *ctx: @ref fontstore_init() 에 넘겨준 사용자 포인터
+ * @param  addr: 저장장치에서 읽을 주소
+ * @param  *buf: 읽은 데이터를 저장할 버퍼
+ * @param  len: 읽을 바이트 수
+ * @retval 1: 정상, -1: 오류
+ */
+typedef int (*FontStoreRead_t)(void *ctx, uint32_t addr, uint8_t *buf, uint32_t len);
+
+/**
+ * @brief  @ref fontstore_memread() 에 넘겨줄 메모리 영역
+ */
+typedef struct {
+    const uint8_t *base;        /*!< 영역의 시작 주소 */
+    uint32_t size;              /*!< 영역의 크기 (바이트) */
+} FontStoreMem_t;
+
+/**
+ * @brief  캐시 통계 구조체
+ */
+typedef struct {
+    uint32_t hits;       /*!< 캐시에서 찾은 블록 수 */
+    uint32_t misses;     /*!< 저장장치에서 읽은 블록 수 */
+    uint32_t readaheads; /*!< 미리 읽은 블록 수 */
+    uint32_t errors;     /*!< 읽기 오류 수 */
+    uint32_t bytes;      /*!< 저장장치에서 읽은 전체 바이트 수 */
+    uint32_t cycles;     /*!< 저장장치 읽기에 걸린 전체 사이클 수 */
+    uint32_t maxcycles;  /*!< 가장 오래 걸린 한 번의 읽기 사이클 수 */
+} FontStoreStats_t;
+
+/**
+ * @brief  저장장치 및 블록 캐시 구조체
+ * @note   여러 폰트가 하나의 저장장치와 캐시를 공유할 수 있다
+ */
+typedef struct {
+    FontStoreRead_t read;       /*!< 저장장치 읽기 함수 */
+    void     *ctx;              /*!< 읽기 함수에 넘겨줄 사용자 포인터 */
+    uint32_t  size;             /*!< 저장장치 크기 (바이트) */
+    uint8_t  *cache;            /*!< blocksize * nblocks 바이트의 캐시 메모리 */
+    uint16_t  blocksize;        /*!< 블록 크기 */
+    uint8_t   nblocks;          /*!< 블록 개수 */
+    uint8_t   readahead;        /*!< 캐시에 없는 블록을 읽을 때 미리 읽을 다음 블록 수 */
+    uint32_t  tag[FONTSTORE_MAX_BLOCKS]; /*!< 각 캐시 블록의 블록 번호 + 1, 0 은 빈 블록 */
+    uint32_t  age[FONTSTORE_MAX_BLOCKS]; /*!< 각 캐시 블록의 마지막 사용 시점 */
+    uint32_t  clock;            /*!< 사용 시점 카운터 */
+    FontStoreStats_t stats;     /*!< 캐시 통계 */
+    uint8_t   glyph[FONTSTORE_MAX_GLYPH]; /*!< 마지막으로 읽은 글자 */
+} FontStore_t;
+
+/**
+ * @brief  외부 저장장치 폰트 데이터 구조체. @ref STORE_FONT 폰트의 data.store 가 가리킨다
+ */
+struct StoreFont {
+    FontStore_t *store;         /*!< 글자 데이터를 읽을 저장장치 */
+    uint32_t     offset;        /*!< 저장장치에서 첫 글자의 주소 */
+};
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup FONTSTORE_함수
+ * @brief    FONTSTORE 함수
+ * @{
+ */
+
+/**
+ * @brief  저장장치와 블록 캐시를 초기화한다
+ * @param  *store: 초기화할 @ref FontStore_t 구조체의 포인터
+ * @param  read: 저장장치 읽기 함수
+ * @param  *ctx: 읽기 함수에 넘겨줄 사용자 포인터
+ * @param  size: 저장장치 크기 (바이트). 이 크기를 넘는 주소는 읽지 않는다
+ * @param  *cache: blocksize * nblocks 바이트의 캐시 메모리
+ * @param  blocksize: 블록 크기. 0이면 안 된다
+ * @param  nblocks: 블록 개수. 1 이상, 최대 @ref FONTSTORE_MAX_BLOCKS
+ * @param  readahead: 캐시에 없는 블록을 읽을 때 미리 읽을 다음 블록 수
+ * @retval 실행 상태, 1: 정상, -1: 오류(size, blocksize나 nblocks가 0)
+ */
+int fontstore_init(FontStore_t* store, FontStoreRead_t read, void* ctx, uint32_t size, uint8_t* cache, uint16_t blocksize, uint8_t nblocks, uint8_t readahead);
+
+/**
+ * @brief  캐시를 비운다
+ * @note   저장장치의 폰트 데이터를 바꾼 후에 호출한다
+ * @param  *store: 사용할 @ref FontStore_t 구조체의 포인터
+ * @retval 없음
+ */
+void fontstore_flush(FontStore_t* store);
+
+/**
+ * @brief  캐시를 통해 저장장치의 데이터를 읽는다
+ * @param  *store: 사용할 @ref FontStore_t 구조체의 포인터
+ * @param  addr: 읽을 주소
+ * @param  *buf: 읽은 데이터를 저장할 버퍼
+ * @param  len: 읽을 바이트 수
+ * @retval 1: 정상, -1: 오류(읽기 오류나 저장장치 크기를 넘는 범위)
+ */
+int fontstore_read(FontStore_t* store, uint32_t addr, uint8_t* buf, uint32_t len);
+
+/**
+ * @brief  @ref STORE_FONT 폰트의 글자 데이터를 읽는다
+ * @note   반환된 버퍼는 다음 호출 때까지만 유효하다
+ * @param  ch: 읽을 글자 코드
+ * @param  *font: 사용된 @ref Font_t 폰트 구조체의 포인터
+ * @retval 글자 데이터에 대한 포인터. 읽기 오류가 나면 빈 글자
+ */
+uint8_t* fontstore_getglyph(uint16_t ch, Font_t* font);
+
+/**
+ * @brief  캐시 통계를 얻는다
+ * @param  *store: 사용할 @ref FontStore_t 구조체의 포인터
+ * @param  *stats: 통계를 저장할 @ref FontStoreStats_t 구조체의 포인터
+ * @retval 없음
+ */
+void fontstore_getstats(FontStore_t* store, FontStoreStats_t* stats);
+
+/**
+ * @brief  캐시 통계를 0 으로 만든다
+ * @param  *store: 사용할 @ref FontStore_t 구조체의 포인터
+ * @retval 없음
+ */
+void fontstore_resetstats(FontStore_t* store);
+
+/**
+ * @brief  메모리 맵 영역을 저장장치로 사용하는 읽기 함수
+ * @note   ctx 에 영역을 나타내는 @ref FontStoreMem_t 구조체의 포인터를 넘겨준다. 예: QSPI 메모리 맵 모드, 외부 SRAM
+ * @retval 1: 정상, -1: 오류(영역을 넘는 범위)
+ */
+int fontstore_memread(void *ctx, uint32_t addr, uint8_t *buf, uint32_t len);
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,71 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+#include "../stm32lib/fontstore_file.h"
+
+#if FONTSTORE_FILE_STDIO
+
+int fontstore_fileread(void *ctx, uint32_t addr, uint8_t *buf, uint32_t len)
+{
+    FILE *fp = (FILE *)ctx;
+
+    if (fseek(fp, (long)addr, SEEK_SET) != 0)
+        return -1;
+    if (fread(buf, 1, len, fp) != len)
+        return -1;
+    return 1;
+}
+
+uint32_t fontstore_filesize(FontStoreFile_t* fp)
+{
+    long size;
+
+    if (fseek(fp, 0, SEEK_END) != 0 || (size = ftell(fp)) < 0)
+        return 0;
+    return (uint32_t)size;
+}
+
+#else
+
+int fontstore_fileread(void *ctx, uint32_t addr, uint8_t *buf, uint32_t len)
+{
+    FIL *fp = (FIL *)ctx;
+    UINT br;
+
+    if (f_lseek(fp, addr) != FR_OK)
+        return -1;
+    if (f_read(fp, buf, len, &br) != FR_OK || br != len)
+        return -1;
+    return 1;
+}
+
+uint32_t fontstore_filesize(FontStoreFile_t* fp)
+{
+    return (uint32_t)f_size(fp);
+}
+
+#endif
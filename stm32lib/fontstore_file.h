@@ -0,0 +1,164 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+#ifndef FONTSTORE_FILE_H
+#define FONTSTORE_FILE_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup stm32lib
+ * @{
+ */
+
+/**
+ * @defgroup FONTSTORE_FILE
+ * @brief    파일에 있는 폰트를 @ref FONTSTORE 로 읽는 읽기 함수
+ * @{
+ *
+ * 폰트 파일을 열어 둔 파일 객체를 @ref fontstore_init() 의 ctx 로 넘기고,
+ * @ref fontstore_fileread() 를 읽기 함수로, @ref fontstore_filesize() 를 저장장치 크기로 사용한다.
+ * 기본값은 FatFs 파일(FIL)이며, @ref FONTSTORE_FILE_STDIO 를 1 로 정의하면
+ * 표준 입출력 파일(FILE)을 사용하므로 호스트에서 같은 폰트 파일로 시험할 수 있다.
+ *
+ * \par 사용 예
+ *
+\code
+static FIL fp;
+static uint8_t cache[8 * 256];
+static FontStore_t store;
+static StoreFont_t hangul_data = {&store, 0};
+Font_t Hangul_16x16 = {STORE_FONT, 16, 16, 0xAC00, 0xD7A3, {.store = &hangul_data}};
+
+if (f_open(&fp, "hangul16.bin", FA_READ) == FR_OK)
+    fontstore_init(&store, fontstore_fileread, &fp, fontstore_filesize(&fp), cache, 256, 8, 1);
+\endcode
+ *
+ * \par Changelog
+ *
+\verbatim
+ 버전 1.0
+  - 최초 배포
+\endverbatim
+ *
+ * \par 의존성
+ *
+\verbatim
+ - FONTSTORE
+ - FatFs (ff.h), FONTSTORE_FILE_STDIO 가 1 이면 stdio.h
+\endverbatim
+ */
+#include "../stm32lib/fontstore.h"
+
+/**
+ * @defgroup FONTSTORE_FILE_매크로
+ * @brief    FONTSTORE_FILE 매크로
+ * @{
+ */
+
+/**
+ * @brief  1 이면 FatFs 대신 표준 입출력 파일을 사용한다
+ */
+#ifndef FONTSTORE_FILE_STDIO
+#define FONTSTORE_FILE_STDIO        0
+#endif
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup FONTSTORE_FILE_자료형
+ * @brief    FONTSTORE_FILE 자료형
+ * @{
+ */
+
+#if FONTSTORE_FILE_STDIO
+#include <stdio.h>
+
+/**
+ * @brief  폰트 파일 객체
+ */
+typedef FILE FontStoreFile_t;
+#else
+#include "ff.h"
+
+/**
+ * @brief  폰트 파일 객체
+ */
+typedef FIL FontStoreFile_t;
+#endif
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup FONTSTORE_FILE_함수
+ * @brief    FONTSTORE_FILE 함수
+ * @{
+ */
+
+/**
+ * @brief  열린 폰트 파일에서 읽는 @ref FontStoreRead_t 읽기 함수
+ * @note   ctx 에 읽기용으로 연 @ref FontStoreFile_t 의 포인터를 넘겨준다
+ * @param  *ctx: 폰트 파일 객체의 포인터
+ * @param  addr: 파일에서 읽을 위치
+ * @param  *buf: 읽은 데이터를 저장할 버퍼
+ * @param  len: 읽을 바이트 수
+ * @retval 1: 정상, -1: 오류(이동 또는 읽기 실패, 파일 끝)
+ */
+int fontstore_fileread(void *ctx, uint32_t addr, uint8_t *buf, uint32_t len);
+
+/**
+ * @brief  폰트 파일의 크기를 얻는다. @ref fontstore_init() 의 size 로 사용한다
+ * @param  *fp: 폰트 파일 객체의 포인터
+ * @retval 파일 크기 (바이트). 알 수 없으면 0
+ */
+uint32_t fontstore_filesize(FontStoreFile_t* fp);
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
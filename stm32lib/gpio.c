@@ -169,6 +169,106 @@ uint16_t gpio_read(GPIO_Pin_t GPIO_Pin)
     }
 }
 
+/* 값을 포트 비트로 바꾼다 */
+static inline uint16_t gpio_group_map(const GPIO_Group_t* group, uint16_t value)
+{
+    if (group->shift >= 0)
+        return (uint16_t)(value << group->shift) & group->mask;
+    return group->map[0][value & 0xF] | group->map[1][(value >> 4) & 0xF] |
+           group->map[2][(value >> 8) & 0xF] | group->map[3][value >> 12];
+}
+
+int gpio_group_init(GPIO_Group_t* group, const GPIO_Pin_t* pins, int count, GPIO_Mode_t GPIO_Mode)
+{
+    uint16_t bit;
+    int i, n, v;
+
+    if (count < 1 || count > 16 || pins[0] == GPIO_NC)
+        return -1;
+    group->port = gpio_get_port_base(pins[0]);
+    group->mask = 0;
+    for (i = 0; i < count; i++) {
+        /* 한 번의 BSRR 쓰기로 바꾸려면 모두 같은 포트의 서로 다른 핀이어야 한다 */
+        if (pins[i] == GPIO_NC || gpio_get_port_base(pins[i]) != group->port)
+            return -1;
+        bit = GPIO_REG_VALUE(pins[i]);
+        if (group->mask & bit)
+            return -1;
+        group->mask |= bit;
+        group->pin[i] = GPIO_PIN_VALUE(pins[i]);
+    }
+    group->count = count;
+
+    /* 값의 비트 순서대로 이어진 핀이면 시프트 한 번으로 바꾼다 */
+    group->shift = group->pin[0];
+    for (i = 1; i < count; i++) {
+        if (group->pin[i] != group->pin[0] + i) {
+            group->shift = -1;
+            break;
+        }
+    }
+    /* 그 외에는 값의 4 비트마다 16 가지 경우의 포트 비트를 미리 계산해 둔다 */
+    for (n = 0; n < 4; n++) {
+        for (v = 0; v < 16; v++) {
+            bit = 0;
+            for (i = 0; i < 4; i++)
+                if ((v & (1 << i)) && n * 4 + i < count)
+                    bit |= 1 << group->pin[n * 4 + i];
+            group->map[n][v] = bit;
+        }
+    }
+
+    for (i = 0; i < count; i++)
+        gpio_init(pins[i], GPIO_Mode);
+    return 1;
+}
+
+uint16_t gpio_group_bits(const GPIO_Group_t* group, uint16_t value)
+{
+    return gpio_group_map(group, value);
+}
+
+void gpio_group_write(const GPIO_Group_t* group, uint16_t value)
+{
+    uint16_t bits = gpio_group_map(group, value);
+
+    /* 상위 16 비트는 클리어, 하위 16 비트는 셋이며 같은 핀은 셋이 우선이다 */
+    group->port->BSRR = (uint32_t)bits | ((uint32_t)(group->mask & ~bits) << 16U);
+}
+
+void gpio_group_set(const GPIO_Group_t* group, uint16_t value)
+{
+    group->port->BSRR = (uint32_t)gpio_group_map(group, value);
+}
+
+void gpio_group_clear(const GPIO_Group_t* group, uint16_t value)
+{
+    group->port->BSRR = (uint32_t)gpio_group_map(group, value) << 16U;
+}
+
+void gpio_group_toggle(const GPIO_Group_t* group, uint16_t value)
+{
+    uint16_t bits = gpio_group_map(group, value);
+    uint16_t odr = (uint16_t)group->port->ODR;
+
+    /* ODR 를 직접 바꾸지 않으므로 다른 핀의 출력은 인터럽트와 겹쳐도 안전하다 */
+    group->port->BSRR = (uint32_t)(bits & ~odr) | ((uint32_t)(bits & odr) << 16U);
+}
+
+uint16_t gpio_group_read(const GPIO_Group_t* group)
+{
+    uint16_t idr = (uint16_t)group->port->IDR;
+    uint16_t value = 0;
+    int i;
+
+    if (group->shift >= 0)
+        return (idr & group->mask) >> group->shift;
+    for (i = 0; i < group->count; i++)
+        if (idr & (1 << group->pin[i]))
+            value |= 1 << i;
+    return value;
+}
+
 /* Private functions */
 void gpio_enable_clock(GPIO_TypeDef* GPIOx) {
     switch ((uint32_t)GPIOx) {
@@ -298,6 +298,19 @@ typedef enum {
     GPIO_PM_OPENDRAIN = 0x03  /*!< 오픈 드레인 활성화 */
 } GPIO_PullMode_t;
 
+/**
+ * @brief  한 포트의 여러 핀을 함께 다루는 핀 묶음 구조체
+ * @note   @ref gpio_group_init() 이 값의 각 비트가 갈 핀을 미리 계산해 둔다
+ */
+typedef struct {
+    GPIO_TypeDef *port;     /*!< 포트 베이스 주소 */
+    uint16_t mask;          /*!< 묶인 핀들의 포트 비트 마스크 */
+    uint8_t count;          /*!< 핀 수, 1 ~ 16 */
+    int8_t shift;           /*!< 값의 비트 순서대로 이어진 핀이면 첫 핀 번호, 아니면 -1 */
+    uint8_t pin[16];        /*!< 값의 i 번 비트가 가는 핀 번호 */
+    uint16_t map[4][16];    /*!< 값의 4 비트씩을 포트 비트로 바꾸는 표. shift 가 -1 일 때 사용 */
+} GPIO_Group_t;
+
 /**
  * @}
  */
@@ -367,6 +380,66 @@ void gpio_toggle(GPIO_Pin_t GPIO_Pin);
   */
 uint16_t gpio_read(GPIO_Pin_t GPIO_Pin);
 
+/**
+ * @brief  같은 포트의 핀들을 한 묶음으로 초기화한다
+ * @note   pins[0] 이 값의 0 번 비트, pins[1] 이 1 번 비트가 된다. 핀 순서는 자유롭다
+ * @param  *group: 초기화할 핀 묶음
+ * @param  *pins: 묶을 핀 배열. 모두 같은 포트여야 한다
+ * @param  count: 핀 수, 1 ~ 16
+ * @param  GPIO_Mode: 선택할 GPIO 모드. 이 매개변수는 @ref GPIO_Mode_t 값.
+ * @retval 실행 상태, 1: 정상, -1: 오류(다른 포트의 핀, 중복된 핀, 잘못된 핀 수)
+ */
+int gpio_group_init(GPIO_Group_t* group, const GPIO_Pin_t* pins, int count, GPIO_Mode_t GPIO_Mode);
+
+/**
+ * @brief  값을 묶음의 포트 비트로 바꾼다
+ * @param  *group: 핀 묶음
+ * @param  value: 값. 묶음의 핀 수보다 높은 비트는 무시한다
+ * @retval 포트 비트
+ */
+uint16_t gpio_group_bits(const GPIO_Group_t* group, uint16_t value);
+
+/**
+ * @brief  묶음의 핀들에 값을 한 번의 BSRR 쓰기로 출력한다
+ * @note   값의 1 인 비트의 핀은 셋, 0 인 비트의 핀은 클리어하며 모든 핀이 동시에 바뀐다.
+ *         같은 포트의 다른 핀은 바뀌지 않는다
+ * @param  *group: 핀 묶음
+ * @param  value: 출력할 값
+ * @retval 없음
+ */
+void gpio_group_write(const GPIO_Group_t* group, uint16_t value);
+
+/**
+ * @brief  값의 1 인 비트의 핀들만 한 번의 BSRR 쓰기로 셋한다
+ * @param  *group: 핀 묶음
+ * @param  value: 셋할 핀의 비트
+ * @retval 없음
+ */
+void gpio_group_set(const GPIO_Group_t* group, uint16_t value);
+
+/**
+ * @brief  값의 1 인 비트의 핀들만 한 번의 BSRR 쓰기로 클리어한다
+ * @param  *group: 핀 묶음
+ * @param  value: 클리어할 핀의 비트
+ * @retval 없음
+ */
+void gpio_group_clear(const GPIO_Group_t* group, uint16_t value);
+
+/**
+ * @brief  값의 1 인 비트의 핀들을 한 번의 BSRR 쓰기로 토글한다
+ * @param  *group: 핀 묶음
+ * @param  value: 토글할 핀의 비트
+ * @retval 없음
+ */
+void gpio_group_toggle(const GPIO_Group_t* group, uint16_t value);
+
+/**
+ * @brief  묶음의 핀들을 IDR 한 번 읽기로 읽는다
+ * @param  *group: 핀 묶음
+ * @retval pins[i] 의 입력이 i 번 비트인 값
+ */
+uint16_t gpio_group_read(const GPIO_Group_t* group);
+
 /** 
  * @brief  라이브러리에서 사용 중이며 해제되지 않은 핀들을 획득한다.
  * @param  *GPIOx: 조사할 사용 중인 GPIO 핀의 포트에 대한 포인터
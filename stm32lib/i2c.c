@@ -26,11 +26,42 @@
  *----------------------------------------------------------------------
  */
 #include "../stm32lib/i2c.h"
+#include "../stm32lib/i2ctrace.h"
+#include "../stm32lib/cyccnt.h"
+
+#include "../stm32lib/cmsis_nvic.h"
+
+/* Private I2C bus structure */
+typedef struct {
+    I2C_HandleTypeDef handle;
+    uint32_t hz;
+    I2C_Timing_t timing;
+    int slave;
+    int own;
+    uint32_t timeout;
+    uint8_t irq;
+    uint8_t failfast;
+    const I2C_Pins_t *pins;
+    I2C_Monitor_t monitor;
+    I2C_ErrorHandler_t error;
+    I2C_Stats_t stats;
+#if I2C_TRACE
+    uint32_t tstart;
+#endif
+} I2C_Context_t;
 
 /* Private variable */
-static I2C_HandleTypeDef i2cHandle;
-static int i2c_slave = HAL_I2C_MODE_MASTER;
-static uint16_t i2c_hz = 100000; // 100 kHz for default
+static I2C_Context_t i2c_context[] = {
+#ifdef I2C1
+    {.handle.Instance = I2C1, .hz = 100000, .slave = HAL_I2C_MODE_MASTER, .timeout = I2C_TIMEOUT},
+#endif
+#ifdef I2C2
+    {.handle.Instance = I2C2, .hz = 100000, .slave = HAL_I2C_MODE_MASTER, .timeout = I2C_TIMEOUT},
+#endif
+#ifdef I2C3
+    {.handle.Instance = I2C3, .hz = 100000, .slave = HAL_I2C_MODE_MASTER, .timeout = I2C_TIMEOUT},
+#endif
+};
 static I2C_Pins_t i2c_pins[] = {
     {I2C_1, GPIO_PB_6, GPIO_PB_7, GPIO_AF4_I2C1},
     {I2C_1, GPIO_PB_8, GPIO_PB_9, GPIO_AF4_I2C1},
@@ -41,11 +72,18 @@ static I2C_Pins_t i2c_pins[] = {
 };
 
 /* Private functions */
-static void i2c_internal_init(I2C_TypeDef* I2Cx, uint16_t hz, int slave);
+static I2C_Context_t* i2c_get_context(I2C_t I2C_Num);
+static void i2c_internal_init(I2C_Context_t* ctx);
+static void i2c_pins_init(const I2C_Pins_t* pins);
+static I2C_Context_t* i2c_begin(I2C_t I2C_Num, int address, int reg, I2C_TraceDir_t dir);
+static int i2c_result(I2C_Context_t* ctx, int address, int reg, I2C_TraceDir_t dir, HAL_StatusTypeDef status, int length);
 
 void i2c_init(I2C_t I2C_Num, I2C_PinsPack_t pack) {
+    I2C_Context_t *ctx = i2c_get_context(I2C_Num);
 
     assert_param(IS_I2C_PINS_VALID(I2C_Num, pack));
+    if (ctx == NULL)
+        return;
 
     /* 클록 활성화 */
 #ifdef I2C1
@@ -61,19 +99,26 @@ void i2c_init(I2C_t I2C_Num, I2C_PinsPack_t pack) {
         __HAL_RCC_I2C3_CLK_ENABLE();
 #endif
 
-    gpio_alternate_init(i2c_pins[pack].scl, GPIO_OD, i2c_pins[pack].alternate);
-    gpio_set_pinmode(i2c_pins[pack].scl, GPIO_PM_PULLUP);
-    gpio_alternate_init(i2c_pins[pack].sda, GPIO_OD, i2c_pins[pack].alternate);
-    gpio_set_pinmode(i2c_pins[pack].sda, GPIO_PM_PULLUP);
+    ctx->pins = &i2c_pins[pack];
+    i2c_pins_init(ctx->pins);
 
     /* 초기화 */
-    i2c_internal_init((I2C_TypeDef *)I2C_Num, 100000, HAL_I2C_MODE_MASTER);
+    ctx->hz = 100000;
+    ctx->slave = HAL_I2C_MODE_MASTER;
+    i2c_internal_init(ctx);
+#if I2C_TRACE
+    /* 첫 전송의 시작 시각을 재기 전에 추적용 사이클 카운터를 켠다 */
+    cyccnt_enable();
+#endif
 }
 
 void i2c_deinit(I2C_t I2C_Num) {
-    i2cHandle.Instance = (I2C_TypeDef *)I2C_Num;
+    I2C_Context_t *ctx = i2c_get_context(I2C_Num);
+
+    if (ctx == NULL)
+        return;
     /* 종료화 */
-    HAL_I2C_DeInit(&i2cHandle);
+    HAL_I2C_DeInit(&ctx->handle);
 /*
 #ifdef I2C1
     if (I2C_Num == I2C_1) {
@@ -106,170 +151,627 @@ void i2c_deinit(I2C_t I2C_Num) {
 */
 }
 
-static void i2c_internal_init(I2C_TypeDef* I2Cx, uint16_t hz, int slave) {
+static I2C_Context_t* i2c_get_context(I2C_t I2C_Num) {
+    uint8_t i;
+
+    for (i = 0; i < sizeof(i2c_context) / sizeof(i2c_context[0]); i++)
+        if (i2c_context[i].handle.Instance == (I2C_TypeDef *)I2C_Num)
+            return &i2c_context[i];
+    return NULL;
+}
+
+static void i2c_pins_init(const I2C_Pins_t* pins) {
+    gpio_alternate_init(pins->scl, GPIO_OD, pins->alternate);
+    gpio_set_pinmode(pins->scl, GPIO_PM_PULLUP);
+    gpio_alternate_init(pins->sda, GPIO_OD, pins->alternate);
+    gpio_set_pinmode(pins->sda, GPIO_PM_PULLUP);
+}
+
+#if defined(STM32F7xx) || defined(STM32F0xx)
+/* ns 를 올림하여 커널 클록 수로 바꾼다 */
+static uint32_t i2c_ns_to_clocks(uint32_t pclk, uint32_t ns) {
+    return (uint32_t)(((uint64_t)ns * pclk + 999999999) / 1000000000);
+}
 
-    i2cHandle.Instance = I2Cx;
+/* TIMINGR: PRESC[31:28], SCLDEL[23:20], SDADEL[19:16], SCLH[15:8], SCLL[7:0] */
+static int i2c_calc_timingr(uint32_t pclk, uint32_t hz, I2C_Timing_t* timing) {
+    uint32_t lowmin, highmin, rise, fall, setup;    /* ns, I2C 규격의 최소/최대값 */
+    uint32_t period, sync, presc, div, ticks, low, high, scldel, sdadel, hold;
 
-#if defined(STM32F7xx)
-    uint32_t timing;
+    if (hz > 1000000) {
+        hz = 1000000;
+    }
+    if (hz > 400000) {          /* Fast-mode Plus */
+        lowmin = 500; highmin = 260; rise = 120; fall = 120; setup = 50;
+    } else if (hz > 100000) {   /* Fast-mode */
+        lowmin = 1300; highmin = 600; rise = 300; fall = 300; setup = 100;
+    } else {                    /* Standard-mode */
+        lowmin = 4700; highmin = 4000; rise = 1000; fall = 300; setup = 250;
+    }
+
+    /* SCL 한 주기의 커널 클록 수와, LOW/HIGH 마다 들어가는 동기화 지연(아날로그 필터 + 약 3 클록) */
+    period = (pclk + hz - 1) / hz;
+    sync = 2 * (i2c_ns_to_clocks(pclk, 50) + 3);
+    /* SDA 홀드 시간: 하강 시간에서 아날로그 필터 지연을 뺀 만큼 */
+    hold = i2c_ns_to_clocks(pclk, fall - 50);
+    hold = (hold > 3) ? hold - 3 : 0;
+
+    /* 분해능이 가장 좋은 가장 작은 분주비를 찾는다 */
+    for (presc = 0; presc < 16; presc++) {
+        div = presc + 1;
+        ticks = (period > sync) ? (period - sync + div - 1) / div : 0;
+
+        /* 남는 시간은 최소 tLOW : tHIGH 비율로 나눈다 */
+        low = (ticks * lowmin + lowmin + highmin - 1) / (lowmin + highmin);
+        if (low < (i2c_ns_to_clocks(pclk, lowmin) + div - 1) / div)
+            low = (i2c_ns_to_clocks(pclk, lowmin) + div - 1) / div;
+        high = (ticks > low) ? ticks - low : 0;
+        if (high < (i2c_ns_to_clocks(pclk, highmin) + div - 1) / div)
+            high = (i2c_ns_to_clocks(pclk, highmin) + div - 1) / div;
+
+        scldel = (i2c_ns_to_clocks(pclk, rise + setup) + div - 1) / div;
+        if (scldel == 0)
+            scldel = 1;
+        sdadel = (hold + div - 1) / div;
+        if (presc == 15) {
+            /* 가장 큰 분주비에서도 넘치면 최대값으로 제한한다 (실제 상승 시간이 규격 최대값보다 짧다고 가정) */
+            if (scldel > 16)
+                scldel = 16;
+            if (sdadel > 15)
+                sdadel = 15;
+        }
+        if (low > 256 || high > 256 || scldel > 16 || sdadel > 15)
+            continue;
+
+        timing->timing = (presc << 28) | ((scldel - 1) << 20) | (sdadel << 16) |
+                         ((high - 1) << 8) | (low - 1);
+        timing->hz = pclk / ((low + high) * div + sync);
+        return 1;
+    }
+    return -1;
+}
+#else
+/* CCR: FS[15], DUTY[14], CCR[11:0] */
+static int i2c_calc_ccr(uint32_t pclk, uint32_t hz, I2C_Timing_t* timing) {
+    uint32_t mhz = pclk / 1000000;
+    uint32_t ccr, ccr169, hz2, hz169;
 
-    if (clockSpeed >= 3400000) {
-        /* 100kHz @ 50MHz APB clock */
-        timing = 0x40912732;
-    } else if (clockSpeed >= 1000000) {
-        /* 100kHz @ 50MHz APB clock */
-        timing = 0x40912732;
-    } else if (clockSpeed >= 400000) {
-        /* 100kHz @ 50MHz APB clock */
-        timing = 0x40912732;
+    if (hz > 400000) {
+        hz = 400000;
+    }
+    if (hz <= 100000) {
+        /* 표준 모드: tHIGH = tLOW = CCR * tPCLK */
+        if (mhz < 2)
+            return -1;
+        ccr = (pclk + 2 * hz - 1) / (2 * hz);
+        if (ccr < 4)
+            ccr = 4;
+        if (ccr > 0xFFF)
+            return -1;
+        timing->ccr = ccr;
+        timing->duty = I2C_DUTYCYCLE_2;
+        timing->trise = mhz + 1;                /* 최대 상승 시간 1000 ns */
+        timing->hz = pclk / (2 * ccr);
     } else {
-        /* 100kHz @ 50MHz APB clock */
-        timing = 0x40912732;
+        /* 고속 모드: 듀티 2 는 3 * CCR, 듀티 16/9 는 25 * CCR 클록이 한 주기 */
+        if (mhz < 4)
+            return -1;
+        ccr = (pclk + 3 * hz - 1) / (3 * hz);
+        ccr169 = (pclk + 25 * hz - 1) / (25 * hz);
+        if (ccr < 1)
+            ccr = 1;
+        if (ccr169 < 1)
+            ccr169 = 1;
+        hz2 = pclk / (3 * ccr);
+        hz169 = pclk / (25 * ccr169);
+        if (hz169 >= hz2) {
+            timing->ccr = I2C_CCR_FS | I2C_CCR_DUTY | ccr169;
+            timing->duty = I2C_DUTYCYCLE_16_9;
+            timing->hz = hz169;
+        } else {
+            timing->ccr = I2C_CCR_FS | ccr;
+            timing->duty = I2C_DUTYCYCLE_2;
+            timing->hz = hz2;
+        }
+        timing->trise = mhz * 300 / 1000 + 1;   /* 최대 상승 시간 300 ns */
     }
+    return 1;
+}
 #endif
-#if defined(STM32F0xx)
-    /* 100kHz @ 48MHz APB clock */
-    uint32_t timing = 0x10805E89;
+
+int i2c_calc_timing(uint32_t pclk, uint32_t hz, I2C_Timing_t* timing) {
+    memset(timing, 0, sizeof(I2C_Timing_t));
+    if (pclk == 0 || hz == 0)
+        return -1;
+#if defined(STM32F7xx) || defined(STM32F0xx)
+    return i2c_calc_timingr(pclk, hz, timing);
+#else
+    return i2c_calc_ccr(pclk, hz, timing);
 #endif
+}
+
+static void i2c_internal_init(I2C_Context_t* ctx) {
+    I2C_HandleTypeDef *i2cHandle = &ctx->handle;
+
+    if (i2c_calc_timing(I2C_KERNEL_CLOCK(), ctx->hz, &ctx->timing) < 0) {
+        /* 이 클록으로 만들 수 없는 주파수이면 표준 모드 100 kHz 를 쓴다 */
+        i2c_calc_timing(I2C_KERNEL_CLOCK(), 100000, &ctx->timing);
+    }
 
     /* I2C 설정 */
-    i2cHandle.Init.OwnAddress1 = 0x00;
-    i2cHandle.Init.OwnAddress2 = 0x00;
-    i2cHandle.Init.AddressingMode = I2C_ADDRESSINGMODE_7BIT;
-    i2cHandle.Init.DualAddressMode = I2C_DUALADDRESS_DISABLED;
-    i2cHandle.Init.GeneralCallMode = I2C_GENERALCALL_DISABLED;
-    i2cHandle.Init.NoStretchMode = I2C_NOSTRETCH_DISABLED;
+    i2cHandle->Init.OwnAddress1 = ctx->own;
+    i2cHandle->Init.OwnAddress2 = 0x00;
+    i2cHandle->Init.AddressingMode = I2C_ADDRESSINGMODE_7BIT;
+    i2cHandle->Init.DualAddressMode = I2C_DUALADDRESS_DISABLED;
+    i2cHandle->Init.GeneralCallMode = I2C_GENERALCALL_DISABLED;
+    i2cHandle->Init.NoStretchMode = I2C_NOSTRETCH_DISABLED;
 #if defined(STM32F7xx) || defined(STM32F0xx)
-    i2cHandle.Init.Timing = timing;
+    i2cHandle->Init.Timing = ctx->timing.timing;
 #else
-    i2cHandle.Init.ClockSpeed = hz;
-    i2cHandle.Init.DutyCycle = I2C_DUTYCYCLE_2;
+    i2cHandle->Init.ClockSpeed = (ctx->hz > 400000) ? 400000 : ctx->hz;
+    i2cHandle->Init.DutyCycle = ctx->timing.duty;
 #endif
 
-    if (slave == HAL_I2C_MODE_SLAVE) /* 주소 Acknowledge 활성화 */
-        i2cHandle.Instance->CR1 |= I2C_CR1_ACK;
+    if (ctx->slave == HAL_I2C_MODE_SLAVE) /* 주소 Acknowledge 활성화 */
+        i2cHandle->Instance->CR1 |= I2C_CR1_ACK;
 
     /* 초기화 */
-    HAL_I2C_Init(&i2cHandle);
+    HAL_I2C_Init(i2cHandle);
+
+#if defined(STM32F7xx) || defined(STM32F0xx)
+    /* Fast-mode Plus 는 핀의 20 mA 구동을 켜야 한다 */
+#if defined(I2C_FASTMODEPLUS_I2C1)
+    if (i2cHandle->Instance == I2C1 && ctx->hz > 400000)
+        HAL_I2CEx_EnableFastModePlus(I2C_FASTMODEPLUS_I2C1);
+#endif
+#if defined(I2C_FASTMODEPLUS_I2C2)
+    if (i2cHandle->Instance == I2C2 && ctx->hz > 400000)
+        HAL_I2CEx_EnableFastModePlus(I2C_FASTMODEPLUS_I2C2);
+#endif
+#else
+    /* HAL 은 CCR 을 내림하여 요청보다 빠른 SCL 이 될 수 있으므로 계산한 값으로 다시 쓴다 */
+    if (ctx->timing.ccr != 0) {
+        __HAL_I2C_DISABLE(i2cHandle);
+        i2cHandle->Instance->CCR = ctx->timing.ccr;
+        i2cHandle->Instance->TRISE = ctx->timing.trise;
+        __HAL_I2C_ENABLE(i2cHandle);
+    }
+#endif
+}
+
+/* 버스를 찾고, failfast 가 설정되어 있으면 SCL/SDA 가 풀려 있는지 확인한다 */
+static I2C_Context_t* i2c_begin(I2C_t I2C_Num, int address, int reg, I2C_TraceDir_t dir) {
+    I2C_Context_t *ctx = i2c_get_context(I2C_Num);
+
+    if (ctx == NULL)
+        return NULL;
+#if I2C_TRACE
+    ctx->tstart = I2C_TRACE_TIMESTAMP();
+#endif
+    if (ctx->failfast && ctx->pins != NULL &&
+        !(gpio_read(ctx->pins->scl) && gpio_read(ctx->pins->sda))) {
+        /* 타임아웃까지 기다리지 않고 바로 오류를 반환한다 */
+        ctx->stats.busy++;
+        i2c_result(ctx, address, reg, dir, HAL_BUSY, 0);
+        return NULL;
+    }
+    return ctx;
+}
+
+/* HAL 상태를 반환값으로 바꾸고 통계를 기록한다. 추적이 켜져 있으면 전송을 기록한다 */
+static int i2c_result(I2C_Context_t* ctx, int address, int reg, I2C_TraceDir_t dir, HAL_StatusTypeDef status, int length) {
+#if I2C_TRACE
+    i2c_trace_record((I2C_t)(uint32_t)ctx->handle.Instance, address, reg, dir, length, status, ctx->handle.ErrorCode, ctx->tstart);
+#endif
+    if (ctx->monitor != NULL)
+        ctx->monitor((I2C_t)(uint32_t)ctx->handle.Instance, address, status, ctx->handle.ErrorCode);
+    ctx->stats.transfers++;
+    if (status != HAL_OK) {
+        ctx->stats.errors++;
+        if (status == HAL_TIMEOUT)
+            ctx->stats.timeouts++;
+        /* 오류 반환 */
+        return -1;
+    }
+    ctx->stats.bytes += length;
+    /* 정상 반환 */
+    return 1;
 }
 
 void i2c_set_slave(I2C_t I2C_Num, int slave)
 {
-    i2c_slave = (slave) ? HAL_I2C_MODE_SLAVE : HAL_I2C_MODE_MASTER;
+    I2C_Context_t *ctx = i2c_get_context(I2C_Num);
+
+    if (ctx == NULL)
+        return;
+    ctx->slave = (slave) ? HAL_I2C_MODE_SLAVE : HAL_I2C_MODE_MASTER;
+    /* 초기화 */
+    i2c_internal_init(ctx);
+}
+
+void i2c_set_own_address(I2C_t I2C_Num, int address)
+{
+    I2C_Context_t *ctx = i2c_get_context(I2C_Num);
+
+    if (ctx == NULL)
+        return;
+    ctx->own = address & 0xFE;
     /* 초기화 */
-    i2c_internal_init((I2C_TypeDef *)I2C_Num, i2c_hz, i2c_slave);
+    i2c_internal_init(ctx);
 }
 
-void i2c_set_frequency(I2C_t I2C_Num, int hz)
+void i2c_set_frequency(I2C_t I2C_Num, uint32_t hz)
 {
-    i2c_hz = hz;
+    I2C_Context_t *ctx = i2c_get_context(I2C_Num);
+
+    if (ctx == NULL)
+        return;
+    ctx->hz = hz;
     /* 초기화 */
-    i2c_internal_init((I2C_TypeDef *)I2C_Num, i2c_hz, i2c_slave);
+    i2c_internal_init(ctx);
 }
 
-int i2c_readdata(I2C_t I2C_Num, int address, uint8_t* data, int length)
+uint32_t i2c_get_frequency(I2C_t I2C_Num)
 {
-    i2cHandle.Instance = (I2C_TypeDef *)I2C_Num;
+    I2C_Context_t *ctx = i2c_get_context(I2C_Num);
 
-    /* 다중 바이트 수신 */
-    if (HAL_I2C_Master_Receive(&i2cHandle, address, data, length, 1000) != HAL_OK) {
-        /* 오류 반환 */
+    return (ctx != NULL) ? ctx->timing.hz : 0;
+}
+
+void i2c_set_timeout(I2C_t I2C_Num, uint32_t timeout)
+{
+    I2C_Context_t *ctx = i2c_get_context(I2C_Num);
+
+    if (ctx != NULL)
+        ctx->timeout = timeout;
+}
+
+void i2c_get_stats(I2C_t I2C_Num, I2C_Stats_t* stats)
+{
+    I2C_Context_t *ctx = i2c_get_context(I2C_Num);
+
+    if (ctx != NULL)
+        *stats = ctx->stats;
+    else
+        memset(stats, 0, sizeof(I2C_Stats_t));
+}
+
+void i2c_reset_stats(I2C_t I2C_Num)
+{
+    I2C_Context_t *ctx = i2c_get_context(I2C_Num);
+
+    if (ctx != NULL)
+        memset(&ctx->stats, 0, sizeof(I2C_Stats_t));
+}
+
+void i2c_set_failfast(I2C_t I2C_Num, int enable)
+{
+    I2C_Context_t *ctx = i2c_get_context(I2C_Num);
+
+    if (ctx != NULL)
+        ctx->failfast = enable ? 1 : 0;
+}
+
+void i2c_set_monitor(I2C_t I2C_Num, I2C_Monitor_t monitor)
+{
+    I2C_Context_t *ctx = i2c_get_context(I2C_Num);
+
+    if (ctx != NULL)
+        ctx->monitor = monitor;
+}
+
+const I2C_Pins_t* i2c_get_pins(I2C_t I2C_Num)
+{
+    I2C_Context_t *ctx = i2c_get_context(I2C_Num);
+
+    return (ctx != NULL) ? ctx->pins : NULL;
+}
+
+int i2c_reset(I2C_t I2C_Num)
+{
+    I2C_Context_t *ctx = i2c_get_context(I2C_Num);
+
+    if (ctx == NULL || ctx->pins == NULL)
         return -1;
-    }
-    /* 정상 반환 */
+
+    /* 종료화 */
+    HAL_I2C_DeInit(&ctx->handle);
+#if !defined(STM32F7xx) && !defined(STM32F0xx)
+    /* 멈춘 BUSY 플래그를 지우기 위한 소프트웨어 리셋 */
+    ctx->handle.Instance->CR1 |= I2C_CR1_SWRST;
+    ctx->handle.Instance->CR1 &= ~I2C_CR1_SWRST;
+#endif
+
+    /* 핀을 다시 I2C 대체 기능으로 설정하고, 같은 설정으로 초기화 */
+    i2c_pins_init(ctx->pins);
+    i2c_internal_init(ctx);
     return 1;
 }
 
-int i2c_nread(I2C_t I2C_Num, int address, int reg, uint8_t* data, int length)
+I2C_HandleTypeDef* i2c_get_handle(I2C_t I2C_Num)
 {
-    i2cHandle.Instance = (I2C_TypeDef *)I2C_Num;
+    I2C_Context_t *ctx = i2c_get_context(I2C_Num);
 
-    /* 레지스터 주소 전송 */
-    if (HAL_I2C_Master_Transmit(&i2cHandle, (uint16_t)address, (uint8_t *)&reg, 1, 1000) != HAL_OK) {
-        /* 오류 반환 */
+    return (ctx != NULL) ? &ctx->handle : NULL;
+}
+
+int i2c_readdata(I2C_t I2C_Num, int address, uint8_t* data, int length)
+{
+    I2C_Context_t *ctx = i2c_begin(I2C_Num, address, I2C_TRACE_NOREG, I2C_TRACE_READ);
+
+    if (ctx == NULL)
         return -1;
-    }
     /* 다중 바이트 수신 */
-    return i2c_readdata(I2C_Num, address, data, length);
+    return i2c_result(ctx, address, I2C_TRACE_NOREG, I2C_TRACE_READ, HAL_I2C_Master_Receive(&ctx->handle, address, data, length, ctx->timeout), length);
 }
 
-int i2c_read(I2C_t I2C_Num, int address, uint8_t reg, uint8_t* data)
+int i2c_nread(I2C_t I2C_Num, int address, int reg, uint8_t* data, int length)
 {
-    i2cHandle.Instance = (I2C_TypeDef *)I2C_Num;
+    I2C_Context_t *ctx = i2c_begin(I2C_Num, address, reg, I2C_TRACE_READ);
 
-    /* 전송 시도 */
-    if (HAL_I2C_Master_Transmit(&i2cHandle, (uint16_t)address, (uint8_t *)&reg, 1, 1000) != HAL_OK) {
-        /* 오류 반환 */
+    if (ctx == NULL)
         return -1;
-    }
-    /* 한 바이트 수신 */
-    return i2c_readdata(I2C_Num, address, data, 1);
+    /* 레지스터 주소 전송 후 반복 시작으로 다중 바이트 수신 */
+    return i2c_result(ctx, address, reg, I2C_TRACE_READ, HAL_I2C_Mem_Read(&ctx->handle, (uint16_t)address, (uint8_t)reg, I2C_MEMADD_SIZE_8BIT, data, length, ctx->timeout), length);
 }
 
-int i2c_read16(I2C_t I2C_Num, int address, uint16_t reg, uint8_t* data)
+int i2c_nread16(I2C_t I2C_Num, int address, uint16_t reg, uint8_t* data, int length)
 {
-    uint8_t bytes[2] = {(reg >> 8) & 0xFF, reg & 0xFF};
-    i2cHandle.Instance = (I2C_TypeDef *)I2C_Num;
+    I2C_Context_t *ctx = i2c_begin(I2C_Num, address, reg, I2C_TRACE_READ);
 
-    /* 전송 시도 */
-    if (HAL_I2C_Master_Transmit(&i2cHandle, (uint16_t)address, (uint8_t *)bytes, 2, 1000) != HAL_OK) {
-        /* 오류 반환 */
+    if (ctx == NULL)
         return -1;
-    }
+    /* 16비트 레지스터 주소 전송 후 반복 시작으로 다중 바이트 수신 */
+    return i2c_result(ctx, address, reg, I2C_TRACE_READ, HAL_I2C_Mem_Read(&ctx->handle, (uint16_t)address, reg, I2C_MEMADD_SIZE_16BIT, data, length, ctx->timeout), length);
+}
+
+int i2c_read(I2C_t I2C_Num, int address, uint8_t reg, uint8_t* data)
+{
+    /* 한 바이트 수신 */
+    return i2c_nread(I2C_Num, address, reg, data, 1);
+}
+
+int i2c_read16(I2C_t I2C_Num, int address, uint16_t reg, uint8_t* data)
+{
     /* 한 바이트 수신 */
-    return i2c_readdata(I2C_Num, address, data, 1);
+    return i2c_nread16(I2C_Num, address, reg, data, 1);
 }
 
 int i2c_nwrite(I2C_t I2C_Num, int address, int reg, uint8_t *data, int length)
 {
-    i2cHandle.Instance = (I2C_TypeDef *)I2C_Num;
+    I2C_Context_t *ctx = i2c_begin(I2C_Num, address, reg, I2C_TRACE_WRITE);
 
-    /* 전송 시도 */
-    if (HAL_I2C_Mem_Write(&i2cHandle, address, reg, reg > 0xFF ? I2C_MEMADD_SIZE_16BIT : I2C_MEMADD_SIZE_8BIT, data, length, 1000) != HAL_OK) {
-        /* 오류 반환 */
+    if (ctx == NULL)
         return -1;
-    }
-    /* 정상 반환 */
-    return 1;
+    /* 전송 시도 */
+    return i2c_result(ctx, address, reg, I2C_TRACE_WRITE, HAL_I2C_Mem_Write(&ctx->handle, address, reg, reg > 0xFF ? I2C_MEMADD_SIZE_16BIT : I2C_MEMADD_SIZE_8BIT, data, length, ctx->timeout), length);
 }
 
 int i2c_write(I2C_t I2C_Num, int address, uint8_t reg, uint8_t data)
 {
     uint8_t bytes[2] = {reg, data};
-    i2cHandle.Instance = (I2C_TypeDef *)I2C_Num;
+    I2C_Context_t *ctx = i2c_begin(I2C_Num, address, reg, I2C_TRACE_WRITE);
 
-    /* 전송 시도 */
-    if (HAL_I2C_Master_Transmit(&i2cHandle, (uint16_t)address, (uint8_t *)bytes, 2, 1000) != HAL_OK) {
-        /* 오류 반환 */
+    if (ctx == NULL)
         return -1;
-    }
-    /* 정상 반환 */
-    return 1;
+    /* 전송 시도 */
+    return i2c_result(ctx, address, reg, I2C_TRACE_WRITE, HAL_I2C_Master_Transmit(&ctx->handle, (uint16_t)address, (uint8_t *)bytes, 2, ctx->timeout), 1);
 }
 
 int i2c_write16(I2C_t I2C_Num, int address, uint16_t reg, uint8_t data)
 {
     uint8_t bytes[3] = {(reg >> 8) & 0xFF, reg & 0xFF, data};
-    i2cHandle.Instance = (I2C_TypeDef *)I2C_Num;
+    I2C_Context_t *ctx = i2c_begin(I2C_Num, address, reg, I2C_TRACE_WRITE);
 
+    if (ctx == NULL)
+        return -1;
     /* 전송 시도 */
-    if (HAL_I2C_Master_Transmit(&i2cHandle, (uint16_t)address, (uint8_t *)bytes, 3, 1000) != HAL_OK) {
-        /* 오류 반환 */
+    return i2c_result(ctx, address, reg, I2C_TRACE_WRITE, HAL_I2C_Master_Transmit(&ctx->handle, (uint16_t)address, (uint8_t *)bytes, 3, ctx->timeout), 1);
+}
+
+/* 순차 전송 한 조각이 끝날 때까지 기다린다 */
+static HAL_StatusTypeDef i2c_wait_frame(I2C_Context_t* ctx, uint32_t start)
+{
+    while (HAL_I2C_GetState(&ctx->handle) != HAL_I2C_STATE_READY) {
+        if (HAL_GetTick() - start >= ctx->timeout)
+            return HAL_TIMEOUT;
+    }
+    return (HAL_I2C_GetError(&ctx->handle) == HAL_I2C_ERROR_NONE) ? HAL_OK : HAL_ERROR;
+}
+
+int i2c_writev(I2C_t I2C_Num, int address, uint8_t control, const I2C_Segment_t* segs, int count)
+{
+    I2C_Context_t *ctx = i2c_begin(I2C_Num, address, control, I2C_TRACE_WRITE);
+    HAL_StatusTypeDef status;
+    uint32_t start = HAL_GetTick();
+    int i, last, length = 0;
+
+    if (ctx == NULL)
         return -1;
+    if (!ctx->irq && i2c_irq_init(I2C_Num, I2C_NVIC_PRIORITY) < 0)
+        return -1;
+
+    /* 마지막으로 보낼 데이터 조각을 찾는다 */
+    for (last = count - 1; last >= 0 && segs[last].length == 0; last--);
+
+    /* 제어 바이트는 START 와 주소 뒤에 보내고, 조각들은 STOP 없이 이어 보낸다 */
+    status = HAL_I2C_Master_Sequential_Transmit_IT(&ctx->handle, (uint16_t)address, &control, 1,
+                                                   (last < 0) ? I2C_FIRST_AND_LAST_FRAME : I2C_FIRST_FRAME);
+    if (status == HAL_OK)
+        status = i2c_wait_frame(ctx, start);
+    for (i = 0; i <= last && status == HAL_OK; i++) {
+        if (segs[i].length == 0)
+            continue;
+        status = HAL_I2C_Master_Sequential_Transmit_IT(&ctx->handle, (uint16_t)address, (uint8_t *)segs[i].data, segs[i].length,
+                                                       (i == last) ? I2C_LAST_FRAME : I2C_NEXT_FRAME);
+        if (status == HAL_OK)
+            status = i2c_wait_frame(ctx, start);
+        length += segs[i].length;
     }
-    /* 정상 반환 */
-    return 1;
+
+    /* 끝나지 않은 전송은 중단한다 */
+    if (status == HAL_TIMEOUT)
+        HAL_I2C_Master_Abort_IT(&ctx->handle, (uint16_t)address);
+    return i2c_result(ctx, address, control, I2C_TRACE_WRITE, status, length);
 }
 
 int i2c_ready(I2C_t I2C_Num, int address)
 {
-    i2cHandle.Instance = (I2C_TypeDef *)I2C_Num;
+    I2C_Context_t *ctx = i2c_begin(I2C_Num, address, I2C_TRACE_NOREG, I2C_TRACE_PROBE);
+    HAL_StatusTypeDef status;
 
+    if (ctx == NULL)
+        return -1;
     /* 장치가 준비되었는지 점검 */
-    if (HAL_I2C_IsDeviceReady(&i2cHandle, (uint8_t)address, 2, 5) != HAL_OK) {
+    status = HAL_I2C_IsDeviceReady(&ctx->handle, (uint8_t)address, 2, 5);
+#if I2C_TRACE
+    i2c_trace_record(I2C_Num, address, I2C_TRACE_NOREG, I2C_TRACE_PROBE, 0, status, ctx->handle.ErrorCode, ctx->tstart);
+#endif
+    if (status != HAL_OK) {
         /* 오류 반환 */
         return -1;
     }
     /* 정상 반환 */
     return 1;
 }
+
+// I2C1 event and error interrupts
+#ifdef I2C1
+#if NVIC_RAM_IRQVECTOR
+static void i2c_ev_handler1(void)
+#else
+void I2C1_EV_IRQHandler(void)
+#endif
+{
+    HAL_I2C_EV_IRQHandler(i2c_get_handle(I2C_1));
+}
+
+#if NVIC_RAM_IRQVECTOR
+static void i2c_er_handler1(void)
+#else
+void I2C1_ER_IRQHandler(void)
+#endif
+{
+    HAL_I2C_ER_IRQHandler(i2c_get_handle(I2C_1));
+}
+#endif
+
+// I2C2 event and error interrupts
+#ifdef I2C2
+#if NVIC_RAM_IRQVECTOR
+static void i2c_ev_handler2(void)
+#else
+void I2C2_EV_IRQHandler(void)
+#endif
+{
+    HAL_I2C_EV_IRQHandler(i2c_get_handle(I2C_2));
+}
+
+#if NVIC_RAM_IRQVECTOR
+static void i2c_er_handler2(void)
+#else
+void I2C2_ER_IRQHandler(void)
+#endif
+{
+    HAL_I2C_ER_IRQHandler(i2c_get_handle(I2C_2));
+}
+#endif
+
+// I2C3 event and error interrupts
+#ifdef I2C3
+#if NVIC_RAM_IRQVECTOR
+static void i2c_ev_handler3(void)
+#else
+void I2C3_EV_IRQHandler(void)
+#endif
+{
+    HAL_I2C_EV_IRQHandler(i2c_get_handle(I2C_3));
+}
+
+#if NVIC_RAM_IRQVECTOR
+static void i2c_er_handler3(void)
+#else
+void I2C3_ER_IRQHandler(void)
+#endif
+{
+    HAL_I2C_ER_IRQHandler(i2c_get_handle(I2C_3));
+}
+#endif
+
+void i2c_set_error_handler(I2C_t I2C_Num, I2C_ErrorHandler_t handler)
+{
+    I2C_Context_t *ctx = i2c_get_context(I2C_Num);
+
+    if (ctx != NULL)
+        ctx->error = handler;
+}
+
+/* HAL 오류 콜백 함수들. 등록된 버스별 함수로 전달한다 */
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef* hi2c)
+{
+    I2C_Context_t *ctx = i2c_get_context((I2C_t)(uint32_t)hi2c->Instance);
+
+    if (ctx != NULL && ctx->error != NULL)
+        ctx->error(hi2c);
+}
+
+void HAL_I2C_AbortCpltCallback(I2C_HandleTypeDef* hi2c)
+{
+    HAL_I2C_ErrorCallback(hi2c);
+}
+
+int i2c_irq_init(I2C_t I2C_Num, uint32_t priority)
+{
+    IRQn_Type ev_irq, er_irq;
+#if NVIC_RAM_IRQVECTOR
+    uint32_t ev_vector, er_vector;
+#endif
+
+    // Select irq number and interrupt routine
+    switch (I2C_Num) {
+#ifdef I2C1
+        case I2C_1:
+            ev_irq = I2C1_EV_IRQn;
+            er_irq = I2C1_ER_IRQn;
+#if NVIC_RAM_IRQVECTOR
+            ev_vector = (uint32_t)&i2c_ev_handler1;
+            er_vector = (uint32_t)&i2c_er_handler1;
+#endif
+            break;
+#endif
+#ifdef I2C2
+        case I2C_2:
+            ev_irq = I2C2_EV_IRQn;
+            er_irq = I2C2_ER_IRQn;
+#if NVIC_RAM_IRQVECTOR
+            ev_vector = (uint32_t)&i2c_ev_handler2;
+            er_vector = (uint32_t)&i2c_er_handler2;
+#endif
+            break;
+#endif
+#ifdef I2C3
+        case I2C_3:
+            ev_irq = I2C3_EV_IRQn;
+            er_irq = I2C3_ER_IRQn;
+#if NVIC_RAM_IRQVECTOR
+            ev_vector = (uint32_t)&i2c_ev_handler3;
+            er_vector = (uint32_t)&i2c_er_handler3;
+#endif
+            break;
+#endif
+        default:
+            return -1;
+    }
+
+#if NVIC_RAM_IRQVECTOR
+    NVIC_SetVector(ev_irq, ev_vector);
+    NVIC_SetVector(er_irq, er_vector);
+#endif
+    /* Add to NVIC */
+    HAL_NVIC_SetPriority(ev_irq, priority, 0);
+    HAL_NVIC_SetPriority(er_irq, priority, 0);
+    NVIC_EnableIRQ(ev_irq);
+    NVIC_EnableIRQ(er_irq);
+    i2c_get_context(I2C_Num)->irq = 1;
+    return 1;
+}
@@ -45,6 +45,9 @@ extern "C" {
  *
  *	모든 I2C 버스 드라이버를 지원한다.
  *
+ * 각 I2C 버스는 자신의 HAL 핸들, 클록 주파수, 타임아웃, 통계를 따로 가지므로
+ * 여러 버스를 서로 다른 설정으로 동시에 사용할 수 있다.
+ *
  * \par Changelog
  *
 \verbatim
@@ -57,10 +60,12 @@ extern "C" {
 \verbatim
  - STM32F4xx HAL
  - GPIO
+ - string.h
 \endverbatim
  */
 #include "stm32f4xx_hal.h"
 #include "../stm32lib/gpio.h"
+#include "string.h"
 
 /**
  * @defgroup I2C_매크로
@@ -68,6 +73,37 @@ extern "C" {
  * @{
  */
 
+/**
+ * @brief  I2C 전송의 기본 타임아웃(밀리초 단위)
+ */
+#ifndef I2C_TIMEOUT
+#define I2C_TIMEOUT         1000
+#endif
+
+/**
+ * @brief  NVIC에 사용된 I2C 이벤트/오류 인터럽트의 기본 우선순위
+ */
+#ifndef I2C_NVIC_PRIORITY
+#define I2C_NVIC_PRIORITY   0x05
+#endif
+
+/**
+ * @brief  I2C 타이밍 계산에 사용하는 I2C 커널 클록(헤르쯔 단위)
+ * @note   F4 는 항상 APB1 클록이다. F0/F7 에서 RCC 로 I2C 클록 소스를 HSI 나 SYSCLK 로
+ *         바꾸었다면 이 매크로를 그 주파수로 다시 정의해야 한다
+ */
+#ifndef I2C_KERNEL_CLOCK
+#define I2C_KERNEL_CLOCK()  HAL_RCC_GetPCLK1Freq()
+#endif
+
+/**
+ * @brief  1 로 정의하면 모든 전송을 @ref I2CTRACE 링 버퍼에 기록한다.
+ *         0 이면 추적 코드가 만들어지지 않는다
+ */
+#ifndef I2C_TRACE
+#define I2C_TRACE           0
+#endif
+
 /**
  * @}
  */
@@ -114,6 +150,51 @@ typedef enum {
     I2C3_PINS2 = 5,  /*!< I2C3, PB_4(SCL), PC_9(SDA) */
 } I2C_PinsPack_t;
 
+/**
+ * @brief I2C 나누어 쓰기(scatter-gather)에 사용하는 데이터 조각 구조체
+ */
+typedef struct {
+    const uint8_t *data;  /*!< 데이터 조각의 시작 주소 */
+    uint16_t length;      /*!< 데이터 조각의 바이트 수 */
+} I2C_Segment_t;
+
+/**
+ * @brief I2C 클록 타이밍 구조체
+ */
+typedef struct {
+    uint32_t hz;      /*!< 계산된 레지스터 값으로 얻어지는 실제 SCL 주파수 */
+    uint32_t timing;  /*!< F0/F7: TIMINGR 레지스터 값 */
+    uint32_t duty;    /*!< F4: I2C_DUTYCYCLE_2 또는 I2C_DUTYCYCLE_16_9 */
+    uint16_t ccr;     /*!< F4: CCR 레지스터 값 (FS, DUTY 비트 포함) */
+    uint16_t trise;   /*!< F4: TRISE 레지스터 값 */
+} I2C_Timing_t;
+
+/**
+ * @brief I2C 버스 통계 구조체
+ */
+typedef struct {
+    uint32_t transfers;  /*!< 전송 시도 횟수 */
+    uint32_t errors;     /*!< 실패한 전송 횟수 */
+    uint32_t timeouts;   /*!< 실패한 전송 중 타임아웃 횟수 */
+    uint32_t busy;       /*!< 실패한 전송 중 SCL/SDA 가 잡혀 있어 시작하지 않은 횟수 */
+    uint32_t bytes;      /*!< 정상 전송된 데이터 바이트 수 */
+} I2C_Stats_t;
+
+/**
+ * @brief  전송이 끝날 때마다 호출되는 감시 함수
+ * @param  I2C_Num: 전송한 I2C 번호
+ * @param  address: I2C 장치 주소
+ * @param  status: HAL 전송 결과. 버스가 잡혀 있어 시작하지 않았으면 HAL_BUSY
+ * @param  error: HAL 오류 코드 (HAL_I2C_ERROR_AF 는 NACK)
+ */
+typedef void (*I2C_Monitor_t)(I2C_t I2C_Num, int address, HAL_StatusTypeDef status, uint32_t error);
+
+/**
+ * @brief  HAL 오류/중단 콜백에서 버스별로 호출되는 함수
+ * @param  hi2c: 오류가 난 I2C 의 HAL 핸들. 오류 코드는 hi2c->ErrorCode
+ */
+typedef void (*I2C_ErrorHandler_t)(I2C_HandleTypeDef* hi2c);
+
 /**
  * @}
  */
@@ -149,25 +230,151 @@ void i2c_deinit(I2C_t I2C_Num);
  */
 void i2c_set_slave(I2C_t I2C_Num, int slave);
 
+/**
+ * @brief  슬레이브로 동작할 때 응답할 자신의 주소를 설정한다
+ * @param  I2C_Num: 선택할 I2C 번호
+ * @param  address: 8 비트 형식의 자신의 주소 (7 비트 주소 << 1)
+ * @retval 없음
+ */
+void i2c_set_own_address(I2C_t I2C_Num, int address);
+
 /**
  * @brief  I2C 버스에 대한 클록 주파수를 설정한다
+ * @note   실제 주파수는 요청한 주파수를 넘지 않는 가장 가까운 값이다.
+ *         F4 는 최대 400 kHz, F0/F7 은 Fast-mode Plus 인 최대 1 MHz 로 제한된다
  * @param  I2C_Num: 선택할 I2C 번호
  * @param  hz: SCLK 주파수(헤르쯔 단위)
  * @retval 없음
  */
-void i2c_set_frequency(I2C_t I2C_Num, int hz);
+void i2c_set_frequency(I2C_t I2C_Num, uint32_t hz);
+
+/**
+ * @brief  I2C 버스의 실제 SCL 주파수를 얻는다
+ * @param  I2C_Num: 선택할 I2C 번호
+ * @retval 실제 SCL 주파수(헤르쯔 단위), 계산할 수 없었으면 0
+ */
+uint32_t i2c_get_frequency(I2C_t I2C_Num);
+
+/**
+ * @brief  I2C 커널 클록과 원하는 SCL 주파수로 타이밍 레지스터 값을 계산한다
+ * @note   F4 는 CCR/TRISE 값과 듀티(고속 모드에서 16/9 를 우선)를, F0/F7 은
+ *         표준/고속/Fast-mode Plus 의 최소 tLOW, tHIGH, 셋업/홀드 시간을 만족하는 TIMINGR 값을 계산한다.
+ *         F0/F7 의 실제 주파수는 SCL 상승/하강 시간을 제외한 값이다
+ * @param  pclk: I2C 커널 클록(헤르쯔 단위), @ref I2C_KERNEL_CLOCK
+ * @param  hz: 원하는 SCL 주파수(헤르쯔 단위)
+ * @param  timing: 계산 결과를 저장할 구조체
+ * @retval 실행 상태, 1: 정상, -1: 이 클록으로 만들 수 없는 주파수
+ */
+int i2c_calc_timing(uint32_t pclk, uint32_t hz, I2C_Timing_t* timing);
+
+/**
+ * @brief  I2C 버스의 전송 타임아웃을 설정한다
+ * @param  I2C_Num: 선택할 I2C 번호
+ * @param  timeout: 밀리초 단위 타임아웃. 기본값은 @ref I2C_TIMEOUT
+ * @retval 없음
+ */
+void i2c_set_timeout(I2C_t I2C_Num, uint32_t timeout);
+
+/**
+ * @brief  I2C 버스의 통계를 얻는다
+ * @param  I2C_Num: 선택할 I2C 번호
+ * @param  *stats: 통계를 저장할 @ref I2C_Stats_t 구조체의 포인터
+ * @retval 없음
+ */
+void i2c_get_stats(I2C_t I2C_Num, I2C_Stats_t* stats);
+
+/**
+ * @brief  I2C 버스의 통계를 0 으로 만든다
+ * @param  I2C_Num: 선택할 I2C 번호
+ * @retval 없음
+ */
+void i2c_reset_stats(I2C_t I2C_Num);
+
+/**
+ * @brief  전송 전에 SCL/SDA 가 모두 풀려 있는지 확인하도록 설정한다
+ * @note   잡혀 있으면 타임아웃까지 기다리지 않고 바로 -1 을 반환한다
+ * @param  I2C_Num: 선택할 I2C 번호
+ * @param  enable: 0이면 확인하지 않음, 그 외에는 확인함
+ * @retval 없음
+ */
+void i2c_set_failfast(I2C_t I2C_Num, int enable);
+
+/**
+ * @brief  전송이 끝날 때마다 호출될 감시 함수를 설정한다
+ * @param  I2C_Num: 선택할 I2C 번호
+ * @param  monitor: 감시 함수, NULL 이면 해제
+ * @retval 없음
+ */
+void i2c_set_monitor(I2C_t I2C_Num, I2C_Monitor_t monitor);
+
+/**
+ * @brief  I2C 버스에 사용된 핀 묶음을 얻는다
+ * @param  I2C_Num: 선택할 I2C 번호
+ * @retval 핀 묶음에 대한 포인터, 초기화되지 않은 버스이면 NULL
+ */
+const I2C_Pins_t* i2c_get_pins(I2C_t I2C_Num);
+
+/**
+ * @brief  I2C 주변장치를 리셋하고 같은 설정으로 다시 초기화한다
+ * @note   핀도 다시 I2C 대체 기능으로 설정한다
+ * @param  I2C_Num: 선택할 I2C 번호
+ * @retval 실행 상태, 1: 정상, -1: 오류
+ */
+int i2c_reset(I2C_t I2C_Num);
+
+/**
+ * @brief  I2C 버스의 HAL 핸들을 얻는다
+ * @note   HAL 의 인터럽트/DMA 함수를 직접 사용할 때 쓴다
+ * @param  I2C_Num: 선택할 I2C 번호
+ * @retval HAL 핸들에 대한 포인터, 지원하지 않는 버스이면 NULL
+ */
+I2C_HandleTypeDef* i2c_get_handle(I2C_t I2C_Num);
+
+/**
+ * @brief  HAL 오류/중단 콜백에서 호출될 함수를 설정한다
+ * @note   HAL_I2C_ErrorCallback() 과 HAL_I2C_AbortCpltCallback() 은 I2C 라이브러리가 정의하며,
+ *         이 함수로 등록된 버스별 함수를 호출한다. I2CASYNC, I2CSLAVE 가 이를 사용한다
+ * @param  I2C_Num: 선택할 I2C 번호
+ * @param  handler: 호출될 함수, NULL 이면 해제
+ * @retval 없음
+ */
+void i2c_set_error_handler(I2C_t I2C_Num, I2C_ErrorHandler_t handler);
 
 /**
- * @brief  I2C 슬레이브에 쓴 후에 데이터를 읽는다
+ * @brief  I2C 버스의 이벤트 및 오류 인터럽트를 활성화한다
+ * @note   인터럽트는 HAL_I2C_EV_IRQHandler()/HAL_I2C_ER_IRQHandler() 로 전달되며,
+ *         전송 결과는 HAL 의 완료 콜백 함수들로 알려진다
+ * @param  I2C_Num: 선택할 I2C 번호
+ * @param  priority: NVIC 우선순위. 보통 @ref I2C_NVIC_PRIORITY
+ * @retval 실행 상태, 1: 정상, -1: 오류
+ */
+int i2c_irq_init(I2C_t I2C_Num, uint32_t priority);
+
+/**
+ * @brief  I2C 슬레이브에 레지스터 주소를 쓴 후에 데이터를 읽는다
+ * @note   주소 쓰기와 읽기 사이에 STOP 없이 반복 시작(repeated start)을 사용하는 하나의 전송이다.
+ *         타임아웃은 @ref i2c_set_timeout() 으로 설정한다
  * @param  I2C_Num: 선택할 I2C 번호
  * @param  address: I2C 장치 주소
- * @param  reg: 쓰여질 값
+ * @param  reg: 8비트 레지스터 주소
  * @param  data: 읽을 값을 저장하는 메모리 주소
  * @param  length: 읽을 데이터 바이트 수
  * @retval 실행 상태, 1: 정상, -1: 오류
  */
 int i2c_nread(I2C_t I2C_Num, int address, int reg, uint8_t* data, int length);
 
+/**
+ * @brief  I2C 슬레이브에 16비트 레지스터 주소를 쓴 후에 데이터를 읽는다
+ * @note   레지스터 주소는 상위 바이트부터 보낸다. 그 외는 @ref i2c_nread() 와 같다
+ * @param  I2C_Num: 선택할 I2C 번호
+ * @param  address: I2C 장치 주소
+ * @param  reg: 16비트 레지스터 주소
+ * @param  data: 읽을 값을 저장하는 메모리 주소
+ * @param  length: 읽을 데이터 바이트 수
+ * @retval 실행 상태, 1: 정상, -1: 오류
+ */
+int i2c_nread16(I2C_t I2C_Num, int address, uint16_t reg, uint8_t* data, int length);
+
 /**
  * @brief  I2C 장치로부터 읽는다
  * @param  I2C_Num: 선택할 I2C 번호
@@ -194,6 +401,20 @@ int i2c_nwrite(I2C_t I2C_Num, int address, int reg, uint8_t *data, int length);
 int i2c_write(I2C_t I2C_Num, int address, uint8_t reg, uint8_t data);
 int i2c_write16(I2C_t I2C_Num, int address, uint16_t reg, uint8_t data);
 
+/**
+ * @brief  제어 바이트와 여러 데이터 조각을 하나의 전송으로 쓴다
+ * @note   데이터를 임시 버퍼에 복사하지 않고, 조각들 사이에 STOP/START 없이 이어서 보낸다.
+ *         I2C 인터럽트를 사용하며, 필요하면 @ref i2c_irq_init() 을 자동으로 호출한다.
+ *         타임아웃은 @ref i2c_set_timeout() 으로 설정한 값을 전체 전송에 적용한다
+ * @param  I2C_Num: 선택할 I2C 번호
+ * @param  address: I2C 장치 주소
+ * @param  control: 주소 다음에 처음 보낼 제어 바이트 (예: SSD1306 의 0x00, 0x40)
+ * @param  *segs: 데이터 조각 배열
+ * @param  count: 데이터 조각 수
+ * @retval 실행 상태, 1: 정상, -1: 오류
+ */
+int i2c_writev(I2C_t I2C_Num, int address, uint8_t control, const I2C_Segment_t* segs, int count);
+
 /**
  * @brief  I2C 장치의 준비 상태를 읽는다
  * @param  I2C_Num: 선택할 I2C 번호
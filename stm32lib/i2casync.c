@@ -0,0 +1,330 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+#include "../stm32lib/i2casync.h"
+#include "../stm32lib/cyccnt.h"
+
+/* Private I2C async bus structure */
+typedef struct {
+    I2C_HandleTypeDef *handle;  /* NULL 이면 초기화되지 않음 */
+    I2C_Async_t *head;          /* 전송 중인 기술자 */
+    I2C_Async_t *tail;
+    volatile uint8_t aborting;  /* 취소한 전송의 중단 완료를 기다리는 중 */
+    I2C_AsyncStats_t stats;
+} I2C_AsyncBus_t;
+
+/* Private variable */
+static I2C_AsyncBus_t i2c_async_bus[3];
+
+/* Private functions */
+static I2C_AsyncBus_t* i2c_async_find(I2C_HandleTypeDef* hi2c);
+static void i2c_async_start(I2C_AsyncBus_t* bus);
+static void i2c_async_finish(I2C_AsyncBus_t* bus, int result);
+static void i2c_async_error(I2C_HandleTypeDef* hi2c);
+
+int i2c_async_init(I2C_t I2C_Num)
+{
+    I2C_HandleTypeDef *hi2c = i2c_get_handle(I2C_Num);
+    I2C_AsyncBus_t *bus;
+    uint8_t i;
+
+    if (hi2c == NULL)
+        return -1;
+    if (i2c_async_find(hi2c) != NULL)
+        return 1;
+
+    for (i = 0; i < sizeof(i2c_async_bus) / sizeof(i2c_async_bus[0]); i++) {
+        bus = &i2c_async_bus[i];
+        if (bus->handle == NULL) {
+            memset(bus, 0, sizeof(I2C_AsyncBus_t));
+            bus->handle = hi2c;
+            i2c_set_error_handler(I2C_Num, i2c_async_error);
+            if (i2c_irq_init(I2C_Num, I2C_NVIC_PRIORITY) < 0) {
+                /* 다시 시도할 수 있도록 버스 자리와 오류 처리 함수를 되돌린다 */
+                i2c_set_error_handler(I2C_Num, NULL);
+                bus->handle = NULL;
+                return -1;
+            }
+            /* 대기 시간을 잴 사이클 카운터 */
+            cyccnt_enable();
+            return 1;
+        }
+    }
+    return -1;
+}
+
+int i2c_async_submit(I2C_t I2C_Num, I2C_Async_t* xfer)
+{
+    I2C_AsyncBus_t *bus = i2c_async_find(i2c_get_handle(I2C_Num));
+    uint32_t primask;
+    uint8_t start;
+
+    if (bus == NULL || xfer->state == I2C_ASYNC_PENDING)
+        return -1;
+
+    xfer->state = I2C_ASYNC_PENDING;
+    xfer->next = NULL;
+    xfer->queued = I2C_ASYNC_TIMESTAMP();
+
+    /* 인터럽트에서 큐를 바꾸지 못하도록 막고 큐 끝에 넣는다 */
+    primask = __get_PRIMASK();
+    __disable_irq();
+    /* 취소한 전송을 중단하는 중이면 중단 완료 콜백에서 시작된다 */
+    start = (bus->head == NULL && !bus->aborting);
+    if (bus->head == NULL)
+        bus->head = xfer;
+    else
+        bus->tail->next = xfer;
+    bus->tail = xfer;
+    bus->stats.submitted++;
+    if (++bus->stats.depth > bus->stats.maxdepth)
+        bus->stats.maxdepth = bus->stats.depth;
+    __set_PRIMASK(primask);
+
+    /* 버스가 비어 있었으면 바로 시작한다. 이후는 인터럽트에서 이어진다 */
+    if (start)
+        i2c_async_start(bus);
+    return 1;
+}
+
+int i2c_async_wait(I2C_Async_t* xfer, uint32_t timeout)
+{
+    uint32_t start = HAL_GetTick();
+
+    while (xfer->state == I2C_ASYNC_PENDING) {
+        if (HAL_GetTick() - start >= timeout)
+            return -1;
+    }
+    return (xfer->state == I2C_ASYNC_DONE) ? 1 : -1;
+}
+
+int i2c_async_cancel(I2C_t I2C_Num, I2C_Async_t* xfer)
+{
+    I2C_AsyncBus_t *bus = i2c_async_find(i2c_get_handle(I2C_Num));
+    I2C_HandleTypeDef *hi2c;
+    I2C_Async_t *prev = NULL, *x;
+    uint32_t primask;
+
+    if (bus == NULL)
+        return -1;
+    hi2c = bus->handle;
+
+    /* 인터럽트가 큐를 바꾸지 못하도록 막고 기술자를 찾는다 */
+    primask = __get_PRIMASK();
+    __disable_irq();
+    for (x = bus->head; x != NULL && x != xfer; x = x->next)
+        prev = x;
+    if (x == NULL) {
+        /* 이미 끝났거나 큐에 넣지 않은 기술자 */
+        __set_PRIMASK(primask);
+        return 0;
+    }
+
+    if (prev == NULL)
+        bus->head = xfer->next;
+    else
+        prev->next = xfer->next;
+    if (bus->tail == xfer)
+        bus->tail = prev;
+    bus->stats.depth--;
+    bus->stats.errors++;
+    xfer->state = I2C_ASYNC_ERROR;
+
+    /* 전송 중인 기술자이면 하드웨어를 멈춘다. 중단 중에는 아직 다음 기술자가 시작되지 않았다 */
+    if (prev == NULL && !bus->aborting) {
+        if (HAL_I2C_Master_Abort_IT(hi2c, xfer->address) == HAL_OK) {
+            /* 중단 완료 콜백에서 다음 기술자를 시작한다 */
+            bus->aborting = 1;
+        } else {
+            /* 메모리 전송처럼 중단할 수 없는 전송은 DMA 를 멈추고 주변장치를 다시 초기화한다 */
+            if (hi2c->hdmatx != NULL)
+                HAL_DMA_Abort(hi2c->hdmatx);
+            if (hi2c->hdmarx != NULL)
+                HAL_DMA_Abort(hi2c->hdmarx);
+            i2c_reset(I2C_Num);
+            i2c_async_start(bus);
+        }
+    }
+    __set_PRIMASK(primask);
+    return 1;
+}
+
+uint16_t i2c_async_pending(I2C_t I2C_Num)
+{
+    I2C_AsyncBus_t *bus = i2c_async_find(i2c_get_handle(I2C_Num));
+
+    return (bus != NULL) ? bus->stats.depth : 0;
+}
+
+void i2c_async_get_stats(I2C_t I2C_Num, I2C_AsyncStats_t* stats)
+{
+    I2C_AsyncBus_t *bus = i2c_async_find(i2c_get_handle(I2C_Num));
+
+    if (bus != NULL)
+        *stats = bus->stats;
+    else
+        memset(stats, 0, sizeof(I2C_AsyncStats_t));
+}
+
+void i2c_async_reset_stats(I2C_t I2C_Num)
+{
+    I2C_AsyncBus_t *bus = i2c_async_find(i2c_get_handle(I2C_Num));
+    uint16_t depth;
+
+    if (bus == NULL)
+        return;
+    depth = bus->stats.depth;
+    memset(&bus->stats, 0, sizeof(I2C_AsyncStats_t));
+    bus->stats.depth = depth;
+    bus->stats.maxdepth = depth;
+}
+
+static I2C_AsyncBus_t* i2c_async_find(I2C_HandleTypeDef* hi2c)
+{
+    uint8_t i;
+
+    if (hi2c == NULL)
+        return NULL;
+    for (i = 0; i < sizeof(i2c_async_bus) / sizeof(i2c_async_bus[0]); i++)
+        if (i2c_async_bus[i].handle == hi2c)
+            return &i2c_async_bus[i];
+    return NULL;
+}
+
+/* 큐의 첫 기술자를 시작한다. 시작하지 못한 기술자는 오류로 끝내고 다음으로 넘어간다 */
+static void i2c_async_start(I2C_AsyncBus_t* bus)
+{
+    I2C_HandleTypeDef *hi2c = bus->handle;
+    I2C_Async_t *xfer;
+    HAL_StatusTypeDef status;
+    uint16_t regsize;
+
+    while ((xfer = bus->head) != NULL) {
+        regsize = (xfer->regsize == 2) ? I2C_MEMADD_SIZE_16BIT : I2C_MEMADD_SIZE_8BIT;
+        switch (xfer->type) {
+            case I2C_ASYNC_WRITE:
+                status = (hi2c->hdmatx != NULL) ?
+                    HAL_I2C_Master_Transmit_DMA(hi2c, xfer->address, xfer->data, xfer->length) :
+                    HAL_I2C_Master_Transmit_IT(hi2c, xfer->address, xfer->data, xfer->length);
+                break;
+            case I2C_ASYNC_READ:
+                status = (hi2c->hdmarx != NULL) ?
+                    HAL_I2C_Master_Receive_DMA(hi2c, xfer->address, xfer->data, xfer->length) :
+                    HAL_I2C_Master_Receive_IT(hi2c, xfer->address, xfer->data, xfer->length);
+                break;
+            case I2C_ASYNC_REG_WRITE:
+                status = (hi2c->hdmatx != NULL) ?
+                    HAL_I2C_Mem_Write_DMA(hi2c, xfer->address, xfer->reg, regsize, xfer->data, xfer->length) :
+                    HAL_I2C_Mem_Write_IT(hi2c, xfer->address, xfer->reg, regsize, xfer->data, xfer->length);
+                break;
+            case I2C_ASYNC_REG_READ:
+                status = (hi2c->hdmarx != NULL) ?
+                    HAL_I2C_Mem_Read_DMA(hi2c, xfer->address, xfer->reg, regsize, xfer->data, xfer->length) :
+                    HAL_I2C_Mem_Read_IT(hi2c, xfer->address, xfer->reg, regsize, xfer->data, xfer->length);
+                break;
+            default:
+                status = HAL_ERROR;
+                break;
+        }
+        if (status == HAL_OK)
+            return;
+        i2c_async_finish(bus, -1);
+    }
+}
+
+/* 전송 중인 기술자를 큐에서 빼고 통계를 기록한 후 콜백 함수를 호출한다 */
+static void i2c_async_finish(I2C_AsyncBus_t* bus, int result)
+{
+    I2C_Async_t *xfer = bus->head;
+    uint32_t latency;
+
+    if (xfer == NULL)
+        return;
+    bus->head = xfer->next;
+    bus->stats.depth--;
+
+    latency = I2C_ASYNC_TIMESTAMP() - xfer->queued;
+    bus->stats.latency += latency;
+    if (latency > bus->stats.maxlatency)
+        bus->stats.maxlatency = latency;
+    if (result > 0) {
+        bus->stats.completed++;
+        bus->stats.bytes += xfer->length;
+    } else {
+        bus->stats.errors++;
+    }
+
+    xfer->state = (result > 0) ? I2C_ASYNC_DONE : I2C_ASYNC_ERROR;
+    if (xfer->callback != NULL)
+        xfer->callback(xfer, result);
+}
+
+/* 인터럽트 문맥에서 현재 전송을 끝내고 다음 전송을 시작한다 */
+static void i2c_async_complete(I2C_HandleTypeDef* hi2c, int result)
+{
+    I2C_AsyncBus_t *bus = i2c_async_find(hi2c);
+
+    if (bus == NULL)
+        return;
+    /* 취소한 전송의 중단 완료. 그 기술자는 이미 큐에서 빠졌다 */
+    if (bus->aborting) {
+        bus->aborting = 0;
+        i2c_async_start(bus);
+        return;
+    }
+    if (bus->head == NULL)
+        return;
+    i2c_async_finish(bus, result);
+    i2c_async_start(bus);
+}
+
+/* HAL 완료 콜백 함수들 */
+void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef* hi2c)
+{
+    i2c_async_complete(hi2c, 1);
+}
+
+void HAL_I2C_MasterRxCpltCallback(I2C_HandleTypeDef* hi2c)
+{
+    i2c_async_complete(hi2c, 1);
+}
+
+void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef* hi2c)
+{
+    i2c_async_complete(hi2c, 1);
+}
+
+void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef* hi2c)
+{
+    i2c_async_complete(hi2c, 1);
+}
+
+/* I2C 라이브러리의 HAL 오류/중단 콜백에서 호출된다 */
+static void i2c_async_error(I2C_HandleTypeDef* hi2c)
+{
+    i2c_async_complete(hi2c, -1);
+}
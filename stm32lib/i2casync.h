@@ -0,0 +1,255 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+#ifndef I2CASYNC_H
+#define I2CASYNC_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup stm32lib
+ * @{
+ */
+
+/**
+ * @defgroup I2CASYNC
+ * @brief    인터럽트/DMA 기반의 비동기 I2C 전송 라이브러리
+ * @{
+ *
+ * 호출자가 전송 기술자(@ref I2C_Async_t)를 큐에 넣으면, 버스가 비어 있을 때
+ * 바로 전송을 시작하고 이후의 전송들은 I2C 이벤트/DMA 인터럽트에서 이어서 실행한다.
+ * 각 전송이 끝나면 기술자의 콜백 함수가 인터럽트 문맥에서 호출된다.
+ *
+ * 기술자는 호출자가 소유하며, 전송이 끝날 때까지 유지되어야 한다.
+ * I2C 핸들에 DMA가 연결되어 있으면(@ref i2c_get_handle() 와 __HAL_LINKDMA 사용)
+ * DMA 전송을, 그렇지 않으면 인터럽트 전송을 사용한다.
+ * 같은 버스에서 블로킹 i2c_* 함수를 함께 쓰려면 큐가 빈 뒤(@ref i2c_async_pending())에 호출해야 한다.
+ *
+ * 기술자는 상태가 @ref I2C_ASYNC_PENDING 인 동안 큐에 연결되어 있고 인터럽트/DMA 가 그 버퍼를 읽고 쓴다.
+ * @ref i2c_async_wait() 가 타임아웃으로 끝났으면 기술자를 버리기 전에 @ref i2c_async_cancel() 로 큐에서 빼야 한다.
+ *
+ * \par 사용 예
+ *
+\code
+static uint8_t accel[6];
+static I2C_Async_t imu = {I2C_ASYNC_REG_READ, 0xD0, 0x3B, 1, accel, 6, imu_done, NULL};
+
+i2c_init(I2C_3, I2C3_PINS1);
+i2c_async_init(I2C_3);
+i2c_async_submit(I2C_3, &imu);
+\endcode
+ *
+ * \par Changelog
+ *
+\verbatim
+ 버전 1.0
+  - 최초 배포
+\endverbatim
+ *
+ * \par 의존성
+ *
+\verbatim
+ - STM32F4xx HAL
+ - I2C
+\endverbatim
+ */
+#include "stm32f4xx_hal.h"
+#include "../stm32lib/i2c.h"
+
+/**
+ * @defgroup I2CASYNC_매크로
+ * @brief    I2CASYNC 매크로
+ * @{
+ */
+
+/**
+ * @brief  대기 시간 측정에 사용하는 사이클 카운터
+ * @note   기본값은 DWT 사이클 카운터이며, 카운터가 동작하지 않으면 대기 시간은 0 으로 기록된다
+ */
+#ifndef I2C_ASYNC_TIMESTAMP
+#define I2C_ASYNC_TIMESTAMP()   (DWT->CYCCNT)
+#endif
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup I2CASYNC_자료형
+ * @brief    I2CASYNC 자료형
+ * @{
+ */
+
+/**
+ * @brief  비동기 전송 종류 열거형
+ */
+typedef enum {
+    I2C_ASYNC_WRITE = 0,    /*!< 데이터 쓰기 */
+    I2C_ASYNC_READ,         /*!< 데이터 읽기 */
+    I2C_ASYNC_REG_WRITE,    /*!< 레지스터 주소 쓰기 후 데이터 쓰기 */
+    I2C_ASYNC_REG_READ,     /*!< 레지스터 주소 쓰기 후 반복 시작(repeated start)으로 데이터 읽기 */
+} I2C_AsyncType_t;
+
+/**
+ * @brief  비동기 전송 상태 열거형
+ */
+typedef enum {
+    I2C_ASYNC_IDLE = 0,     /*!< 큐에 들어가지 않음 */
+    I2C_ASYNC_PENDING,      /*!< 큐에서 기다리거나 전송 중 */
+    I2C_ASYNC_DONE,         /*!< 정상 완료 */
+    I2C_ASYNC_ERROR,        /*!< 오류로 끝남 */
+} I2C_AsyncState_t;
+
+struct I2C_Async;
+
+/**
+ * @brief  전송 완료 콜백 함수. 인터럽트 문맥에서 호출된다
+ * @param  *xfer: 끝난 전송 기술자
+ * @param  result: 1: 정상, -1: 오류
+ */
+typedef void (*I2C_AsyncCallback_t)(struct I2C_Async *xfer, int result);
+
+/**
+ * @brief  비동기 전송 기술자
+ */
+typedef struct I2C_Async {
+    I2C_AsyncType_t type;         /*!< 전송 종류 */
+    uint16_t address;             /*!< I2C 장치 주소 */
+    uint16_t reg;                 /*!< 레지스터 주소 (REG_WRITE, REG_READ) */
+    uint8_t  regsize;             /*!< 레지스터 주소 바이트 수, 1 또는 2 */
+    uint8_t  *data;               /*!< 데이터 버퍼 */
+    uint16_t length;              /*!< 데이터 바이트 수 */
+    I2C_AsyncCallback_t callback; /*!< 완료 콜백 함수, NULL 가능 */
+    void     *arg;                /*!< 콜백 함수에서 사용할 사용자 포인터 */
+    /* 아래는 라이브러리 내부에서 사용 */
+    volatile I2C_AsyncState_t state; /*!< 전송 상태 */
+    uint32_t queued;              /*!< 큐에 넣은 시점 */
+    struct I2C_Async *next;       /*!< 큐의 다음 기술자 */
+} I2C_Async_t;
+
+/**
+ * @brief  비동기 전송 통계 구조체
+ */
+typedef struct {
+    uint32_t submitted;   /*!< 큐에 넣은 전송 수 */
+    uint32_t completed;   /*!< 정상 완료된 전송 수 */
+    uint32_t errors;      /*!< 오류로 끝난 전송 수 */
+    uint32_t bytes;       /*!< 정상 전송된 데이터 바이트 수 */
+    uint16_t depth;       /*!< 현재 큐 깊이 (전송 중인 것 포함) */
+    uint16_t maxdepth;    /*!< 최대 큐 깊이 */
+    uint32_t latency;     /*!< 큐에 넣은 후 완료까지 걸린 전체 사이클 수 */
+    uint32_t maxlatency;  /*!< 가장 오래 걸린 전송의 사이클 수 */
+} I2C_AsyncStats_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup I2CASYNC_함수
+ * @brief    I2CASYNC 함수
+ * @{
+ */
+
+/**
+ * @brief  I2C 버스의 비동기 전송을 초기화하고 인터럽트를 활성화한다
+ * @note   버스는 먼저 @ref i2c_init() 로 초기화되어야 한다
+ * @param  I2C_Num: 선택할 I2C 번호
+ * @retval 실행 상태, 1: 정상, -1: 오류
+ */
+int i2c_async_init(I2C_t I2C_Num);
+
+/**
+ * @brief  전송 기술자를 큐에 넣는다. 버스가 비어 있으면 바로 전송을 시작한다
+ * @param  I2C_Num: 선택할 I2C 번호
+ * @param  *xfer: 전송 기술자. 완료될 때까지 유지되어야 한다
+ * @retval 실행 상태, 1: 정상, -1: 오류(초기화되지 않은 버스 또는 이미 큐에 있는 기술자)
+ */
+int i2c_async_submit(I2C_t I2C_Num, I2C_Async_t* xfer);
+
+/**
+ * @brief  전송이 끝날 때까지 기다린다
+ * @note   타임아웃이면 기술자는 아직 큐에 있다. 기술자를 버리기 전에 @ref i2c_async_cancel() 을 호출해야 한다
+ * @param  *xfer: 기다릴 전송 기술자
+ * @param  timeout: 밀리초 단위 타임아웃
+ * @retval 실행 상태, 1: 정상, -1: 오류 또는 타임아웃
+ */
+int i2c_async_wait(I2C_Async_t* xfer, uint32_t timeout);
+
+/**
+ * @brief  기술자를 큐에서 뺀다. 전송 중이면 HAL 중단으로 멈추고, 중단이 끝나면 다음 기술자를 시작한다
+ * @note   취소된 기술자는 @ref I2C_ASYNC_ERROR 가 되고 오류로 집계된다. 콜백 함수는 호출되지 않는다.
+ *         중단할 수 없는 레지스터 전송은 DMA 를 멈추고 @ref i2c_reset() 으로 주변장치를 다시 초기화한다
+ * @param  I2C_Num: 선택할 I2C 번호
+ * @param  *xfer: 취소할 전송 기술자
+ * @retval 1: 취소함, 0: 이미 끝났거나 큐에 없는 기술자, -1: 오류(초기화되지 않은 버스)
+ */
+int i2c_async_cancel(I2C_t I2C_Num, I2C_Async_t* xfer);
+
+/**
+ * @brief  큐에 남은 전송 수를 얻는다
+ * @param  I2C_Num: 선택할 I2C 번호
+ * @retval 전송 중인 것을 포함한 큐 깊이
+ */
+uint16_t i2c_async_pending(I2C_t I2C_Num);
+
+/**
+ * @brief  비동기 전송 통계를 얻는다
+ * @param  I2C_Num: 선택할 I2C 번호
+ * @param  *stats: 통계를 저장할 @ref I2C_AsyncStats_t 구조체의 포인터
+ * @retval 없음
+ */
+void i2c_async_get_stats(I2C_t I2C_Num, I2C_AsyncStats_t* stats);
+
+/**
+ * @brief  비동기 전송 통계를 0 으로 만든다. 현재 큐 깊이는 유지된다
+ * @param  I2C_Num: 선택할 I2C 번호
+ * @retval 없음
+ */
+void i2c_async_reset_stats(I2C_t I2C_Num);
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,178 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+#include "../stm32lib/i2cbus.h"
+#include "../stm32lib/cyccnt.h"
+
+/* Private I2C shared bus structure */
+typedef struct {
+    I2C_t bus;                      /* 0 이면 초기화되지 않음 */
+    I2C_Device_t * volatile owner;  /* 점유한 장치 */
+    I2C_Device_t *devices;
+    uint32_t hz;                    /* 마지막으로 설정한 요청 주파수. 0 이면 모름 */
+    I2C_BusStats_t stats;
+} I2C_SharedBus_t;
+
+/* Private variable */
+static I2C_SharedBus_t i2c_shared_bus[3];
+
+/* Private functions */
+static I2C_SharedBus_t* i2c_bus_find(I2C_t I2C_Num);
+
+int i2c_bus_attach(I2C_Device_t* dev, I2C_t I2C_Num, I2C_PinsPack_t pack, int address, uint32_t hz)
+{
+    I2C_SharedBus_t *bus = i2c_bus_find(I2C_Num);
+    I2C_Device_t *d;
+    uint8_t i;
+
+    /* 버스를 점유 중인 장치는 다시 등록할 수 없다 */
+    for (i = 0; i < sizeof(i2c_shared_bus) / sizeof(i2c_shared_bus[0]); i++)
+        if (i2c_shared_bus[i].bus != 0 && i2c_shared_bus[i].owner == dev)
+            return -1;
+
+    /* 점유 시간을 잴 사이클 카운터 */
+    cyccnt_enable();
+
+    /* 처음 등록되는 버스이면 초기화한다 */
+    for (i = 0; bus == NULL && i < sizeof(i2c_shared_bus) / sizeof(i2c_shared_bus[0]); i++) {
+        if (i2c_shared_bus[i].bus == 0) {
+            bus = &i2c_shared_bus[i];
+            memset(bus, 0, sizeof(I2C_SharedBus_t));
+            i2c_init(I2C_Num, pack);
+            if (i2c_get_handle(I2C_Num) == NULL)
+                return -1;
+            bus->bus = I2C_Num;
+            bus->stats.hz = i2c_get_frequency(I2C_Num);
+        }
+    }
+    if (bus == NULL)
+        return -1;
+
+    dev->bus = I2C_Num;
+    dev->address = address;
+    dev->hz = hz;
+    dev->transactions = dev->waits = dev->fails = 0;
+    dev->cycles = dev->maxcycles = 0;
+    dev->depth = 0;
+
+    /* 이미 등록된 장치이면 설정만 바꾼다 */
+    for (d = bus->devices; d != NULL; d = d->next)
+        if (d == dev)
+            return 1;
+    dev->next = bus->devices;
+    bus->devices = dev;
+    bus->stats.devices++;
+    return 1;
+}
+
+int i2c_bus_acquire(I2C_Device_t* dev, uint32_t timeout)
+{
+    I2C_SharedBus_t *bus = i2c_bus_find(dev->bus);
+    uint32_t start = HAL_GetTick();
+    uint32_t primask, hz;
+    uint8_t owned, waited = 0;
+
+    if (bus == NULL)
+        return -1;
+
+    for (;;) {
+        /* 인터럽트를 막고 비어 있거나 자신이 점유한 버스이면 점유한다 */
+        primask = __get_PRIMASK();
+        __disable_irq();
+        owned = (bus->owner == NULL || bus->owner == dev);
+        if (owned) {
+            bus->owner = dev;
+            dev->depth++;
+        }
+        __set_PRIMASK(primask);
+        if (owned)
+            break;
+
+        if (!waited) {
+            dev->waits++;
+            waited = 1;
+        }
+        if (timeout == 0 || HAL_GetTick() - start >= timeout) {
+            dev->fails++;
+            return -1;
+        }
+    }
+
+    if (dev->depth == 1) {
+        /* 요청 주파수가 다를 때만 바꾸고, 실제 주파수가 달라졌을 때만 센다 */
+        if (bus->hz != dev->hz) {
+            i2c_set_frequency(dev->bus, dev->hz);
+            bus->hz = dev->hz;
+            hz = i2c_get_frequency(dev->bus);
+            if (hz != bus->stats.hz) {
+                bus->stats.hz = hz;
+                bus->stats.switches++;
+            }
+        }
+        dev->transactions++;
+        dev->start = I2C_BUS_TIMESTAMP();
+    }
+    return 1;
+}
+
+void i2c_bus_release(I2C_Device_t* dev)
+{
+    I2C_SharedBus_t *bus = i2c_bus_find(dev->bus);
+    uint32_t cycles;
+
+    if (bus == NULL || bus->owner != dev || dev->depth == 0)
+        return;
+    if (--dev->depth > 0)
+        return;
+
+    cycles = I2C_BUS_TIMESTAMP() - dev->start;
+    dev->cycles += cycles;
+    if (cycles > dev->maxcycles)
+        dev->maxcycles = cycles;
+    bus->owner = NULL;
+}
+
+void i2c_bus_get_stats(I2C_t I2C_Num, I2C_BusStats_t* stats)
+{
+    I2C_SharedBus_t *bus = i2c_bus_find(I2C_Num);
+
+    if (bus != NULL)
+        *stats = bus->stats;
+    else
+        memset(stats, 0, sizeof(I2C_BusStats_t));
+}
+
+static I2C_SharedBus_t* i2c_bus_find(I2C_t I2C_Num)
+{
+    uint8_t i;
+
+    for (i = 0; i < sizeof(i2c_shared_bus) / sizeof(i2c_shared_bus[0]); i++) {
+        if (i2c_shared_bus[i].bus != 0 && i2c_shared_bus[i].bus == I2C_Num)
+            return &i2c_shared_bus[i];
+    }
+    return NULL;
+}
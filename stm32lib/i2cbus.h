@@ -0,0 +1,208 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+#ifndef I2CBUS_H
+#define I2CBUS_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup stm32lib
+ * @{
+ */
+
+/**
+ * @defgroup I2CBUS
+ * @brief    여러 장치 드라이버가 하나의 I2C 버스를 나누어 쓰기 위한 버스 관리 라이브러리
+ * @{
+ *
+ * 각 드라이버는 자신의 장치를 원하는 SCL 주파수와 함께 등록(@ref i2c_bus_attach())하고,
+ * 전송 전후에 버스를 점유(@ref i2c_bus_acquire())하고 놓는다(@ref i2c_bus_release()).
+ *
+ *  - 버스는 처음 등록될 때 한 번만 초기화되므로, 다른 드라이버가 나중에 초기화해도
+ *    앞의 드라이버의 설정이 바뀌지 않는다
+ *  - 점유는 인터럽트를 잠시 막는 가벼운 잠금으로, 스레드와 인터럽트 문맥에서 모두 쓸 수 있다.
+ *    같은 장치는 중첩하여 점유할 수 있다
+ *  - 점유한 장치의 주파수가 현재 버스 주파수와 다를 때만 주파수를 바꾼다
+ *  - 장치별 점유 횟수, 대기 횟수, 점유 시간을 기록한다
+ *
+ * 인터럽트 문맥에서는 다른 문맥이 점유를 끝낼 수 없으므로 timeout 을 0 으로 하여
+ * 점유하지 못하면 바로 돌아와야 한다.
+ *
+ * \par 사용 예
+ *
+\code
+static I2C_Device_t oled;
+
+i2c_bus_attach(&oled, I2C_1, I2C1_PINS2, 0x78, 400000);
+if (i2c_bus_acquire(&oled, I2C_BUS_TIMEOUT) > 0) {
+    i2c_write(I2C_1, 0x78, 0x00, 0xAF);
+    i2c_bus_release(&oled);
+}
+\endcode
+ *
+ * \par Changelog
+ *
+\verbatim
+ 버전 1.0
+  - 최초 배포
+\endverbatim
+ *
+ * \par 의존성
+ *
+\verbatim
+ - STM32F4xx HAL
+ - I2C
+\endverbatim
+ */
+#include "stm32f4xx_hal.h"
+#include "../stm32lib/i2c.h"
+
+/**
+ * @defgroup I2CBUS_매크로
+ * @brief    I2CBUS 매크로
+ * @{
+ */
+
+/**
+ * @brief  드라이버들이 버스 점유를 기다리는 기본 시간(밀리초 단위)
+ */
+#ifndef I2C_BUS_TIMEOUT
+#define I2C_BUS_TIMEOUT         100
+#endif
+
+/**
+ * @brief  점유 시간 측정에 사용하는 사이클 카운터
+ */
+#ifndef I2C_BUS_TIMESTAMP
+#define I2C_BUS_TIMESTAMP()     (DWT->CYCCNT)
+#endif
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup I2CBUS_자료형
+ * @brief    I2CBUS 자료형
+ * @{
+ */
+
+typedef struct I2C_Device I2C_Device_t;
+
+/**
+ * @brief  버스에 등록된 장치 구조체
+ */
+struct I2C_Device {
+    I2C_t bus;              /*!< I2C 번호 */
+    int address;            /*!< I2C 장치 주소 */
+    uint32_t hz;            /*!< 장치가 원하는 SCL 주파수 */
+    uint32_t transactions;  /*!< 버스를 점유한 횟수 */
+    uint32_t waits;         /*!< 다른 장치가 점유 중이어서 기다린 횟수 */
+    uint32_t fails;         /*!< 타임아웃으로 점유하지 못한 횟수 */
+    uint32_t cycles;        /*!< 버스를 점유한 시간 합계 (사이클 카운터 단위) */
+    uint32_t maxcycles;     /*!< 가장 긴 점유 시간 */
+    uint32_t start;         /*!< 점유를 시작한 시각. 내부용 */
+    uint8_t depth;          /*!< 중첩 점유 깊이. 내부용 */
+    I2C_Device_t *next;     /*!< 같은 버스의 다음 장치. 내부용 */
+};
+
+/**
+ * @brief  버스 통계 구조체
+ */
+typedef struct {
+    uint32_t devices;       /*!< 등록된 장치 수 */
+    uint32_t switches;      /*!< 실제 주파수가 바뀐 횟수 */
+    uint32_t hz;            /*!< 현재 버스의 실제 주파수(@ref i2c_get_frequency()) */
+} I2C_BusStats_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup I2CBUS_함수
+ * @brief    I2CBUS 함수
+ * @{
+ */
+
+/**
+ * @brief  장치를 버스에 등록한다. 버스가 처음 등록되면 초기화한다
+ * @note   이미 등록된 장치는 설정과 통계만 새로 한다. 버스를 점유 중인 장치는 다시 등록할 수 없다
+ * @param  dev: 장치 구조체. 프로그램이 끝날 때까지 유지되어야 한다
+ * @param  I2C_Num: I2C 번호
+ * @param  pack: 버스를 처음 초기화할 때 사용할 핀 묶음
+ * @param  address: I2C 장치 주소
+ * @param  hz: 장치가 원하는 SCL 주파수(헤르쯔 단위)
+ * @retval 실행 상태, 1: 정상, -1: 오류(버스를 초기화할 수 없거나 장치가 버스를 점유 중)
+ */
+int i2c_bus_attach(I2C_Device_t* dev, I2C_t I2C_Num, I2C_PinsPack_t pack, int address, uint32_t hz);
+
+/**
+ * @brief  장치가 버스를 점유한다. 필요하면 버스 주파수를 장치의 주파수로 바꾼다
+ * @param  dev: 장치 구조체
+ * @param  timeout: 다른 장치가 점유 중일 때 기다릴 시간(밀리초 단위). 0 이면 기다리지 않는다
+ * @retval 실행 상태, 1: 점유, -1: 타임아웃 또는 오류
+ */
+int i2c_bus_acquire(I2C_Device_t* dev, uint32_t timeout);
+
+/**
+ * @brief  장치가 점유한 버스를 놓는다
+ * @param  dev: 장치 구조체
+ * @retval 없음
+ */
+void i2c_bus_release(I2C_Device_t* dev);
+
+/**
+ * @brief  버스 통계를 얻는다
+ * @param  I2C_Num: I2C 번호
+ * @param  stats: 통계를 저장할 구조체
+ * @retval 없음
+ */
+void i2c_bus_get_stats(I2C_t I2C_Num, I2C_BusStats_t* stats);
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
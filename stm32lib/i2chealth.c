@@ -0,0 +1,283 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+#include "../stm32lib/i2chealth.h"
+#include "../stm32lib/cyccnt.h"
+
+/* Private I2C health bus structure */
+typedef struct {
+    I2C_t bus;                  /* 0 이면 초기화되지 않음 */
+    I2C_HealthStats_t stats;
+    I2C_HealthDevice_t devices[I2C_HEALTH_MAX_DEVICES];
+} I2C_HealthBus_t;
+
+/* Private variable */
+static I2C_HealthBus_t i2c_health_bus[3];
+
+/* Private functions */
+static I2C_HealthBus_t* i2c_health_find(I2C_t I2C_Num);
+static void i2c_health_monitor(I2C_t I2C_Num, int address, HAL_StatusTypeDef status, uint32_t error);
+static void i2c_health_delay(uint32_t us);
+static uint8_t i2c_health_pin_read(GPIO_Pin_t pin);
+static void i2c_health_pin_write(GPIO_Pin_t pin, uint8_t state);
+static int i2c_health_clock(GPIO_Pin_t scl);
+
+int i2c_health_init(I2C_t I2C_Num)
+{
+    I2C_HealthBus_t *bus;
+    uint8_t i;
+
+    if (i2c_get_pins(I2C_Num) == NULL)
+        return -1;
+
+    bus = i2c_health_find(I2C_Num);
+    for (i = 0; bus == NULL && i < sizeof(i2c_health_bus) / sizeof(i2c_health_bus[0]); i++) {
+        if (i2c_health_bus[i].bus == 0) {
+            bus = &i2c_health_bus[i];
+            memset(bus, 0, sizeof(I2C_HealthBus_t));
+            bus->bus = I2C_Num;
+        }
+    }
+    if (bus == NULL)
+        return -1;
+
+    /* 복구 지연에 쓸 사이클 카운터 */
+    cyccnt_enable();
+
+    i2c_set_monitor(I2C_Num, i2c_health_monitor);
+    i2c_set_failfast(I2C_Num, 1);
+    return 1;
+}
+
+I2C_HealthState_t i2c_health_check(I2C_t I2C_Num)
+{
+    const I2C_Pins_t *pins = i2c_get_pins(I2C_Num);
+
+    if (pins == NULL)
+        return I2C_HEALTH_UNKNOWN;
+    if (!i2c_health_pin_read(pins->scl))
+        return I2C_HEALTH_SCL_LOW;
+    if (!i2c_health_pin_read(pins->sda))
+        return I2C_HEALTH_SDA_LOW;
+    return I2C_HEALTH_OK;
+}
+
+int i2c_health_recover(I2C_t I2C_Num)
+{
+    const I2C_Pins_t *pins = i2c_get_pins(I2C_Num);
+    I2C_HealthBus_t *bus = i2c_health_find(I2C_Num);
+    int result = 1;
+    uint8_t i;
+
+    if (pins == NULL || bus == NULL)
+        return -1;
+    bus->stats.recoveries++;
+
+    /* 두 핀을 놓은 상태로 범용 출력 드레인으로 바꾼다 */
+    i2c_health_pin_write(pins->scl, 1);
+    i2c_health_pin_write(pins->sda, 1);
+    gpio_alternate_init(pins->scl, (GPIO_Mode_t)GPIO_MODE_OUTPUT_OD, 0);
+    gpio_set_pinmode(pins->scl, GPIO_PM_PULLUP);
+    gpio_alternate_init(pins->sda, (GPIO_Mode_t)GPIO_MODE_OUTPUT_OD, 0);
+    gpio_set_pinmode(pins->sda, GPIO_PM_PULLUP);
+    i2c_health_delay(I2C_HEALTH_HALF_PERIOD_US);
+
+    /* 슬레이브가 남은 비트를 모두 내보내고 SDA 를 놓을 때까지 최대 9 클록 */
+    for (i = 0; i < 9 && !i2c_health_pin_read(pins->sda); i++) {
+        if (i2c_health_clock(pins->scl) < 0) {
+            result = -1;
+            break;
+        }
+        bus->stats.clocks++;
+    }
+
+    /* STOP: SCL 이 HIGH 인 동안 SDA 를 LOW 에서 HIGH 로 */
+    if (result > 0) {
+        i2c_health_pin_write(pins->scl, 0);
+        i2c_health_delay(I2C_HEALTH_HALF_PERIOD_US);
+        i2c_health_pin_write(pins->sda, 0);
+        i2c_health_delay(I2C_HEALTH_HALF_PERIOD_US);
+        i2c_health_pin_write(pins->scl, 1);
+        i2c_health_delay(I2C_HEALTH_HALF_PERIOD_US);
+        i2c_health_pin_write(pins->sda, 1);
+        i2c_health_delay(I2C_HEALTH_HALF_PERIOD_US);
+        if (!i2c_health_pin_read(pins->scl) || !i2c_health_pin_read(pins->sda))
+            result = -1;
+    }
+
+    /* 핀을 I2C 로 되돌리고 주변장치의 BUSY 상태를 지운다 */
+    i2c_reset(I2C_Num);
+    if (result < 0)
+        bus->stats.failures++;
+    return result;
+}
+
+int i2c_health_scan(I2C_t I2C_Num, uint8_t map[16])
+{
+    I2C_HandleTypeDef *hi2c = i2c_get_handle(I2C_Num);
+    int address, count = 0;
+
+    if (hi2c == NULL || i2c_health_check(I2C_Num) != I2C_HEALTH_OK)
+        return -1;
+    if (map != NULL)
+        memset(map, 0, 16);
+
+    /* 0x00~0x07, 0x78~0x7F 는 예약된 주소 */
+    for (address = 0x08; address <= 0x77; address++) {
+        if (HAL_I2C_IsDeviceReady(hi2c, (uint16_t)(address << 1), 1, I2C_HEALTH_SCAN_TIMEOUT) == HAL_OK) {
+            if (map != NULL)
+                map[address >> 3] |= 1 << (address & 0x07);
+            count++;
+        }
+    }
+    return count;
+}
+
+int i2c_health_get_device(I2C_t I2C_Num, int address, I2C_HealthDevice_t* device)
+{
+    I2C_HealthBus_t *bus = i2c_health_find(I2C_Num);
+    uint8_t i;
+
+    if (bus == NULL)
+        return -1;
+    for (i = 0; i < I2C_HEALTH_MAX_DEVICES; i++) {
+        if (bus->devices[i].address != 0 && bus->devices[i].address == (uint8_t)address) {
+            *device = bus->devices[i];
+            return 1;
+        }
+    }
+    return -1;
+}
+
+void i2c_health_get_stats(I2C_t I2C_Num, I2C_HealthStats_t* stats)
+{
+    I2C_HealthBus_t *bus = i2c_health_find(I2C_Num);
+
+    if (bus != NULL)
+        *stats = bus->stats;
+    else
+        memset(stats, 0, sizeof(I2C_HealthStats_t));
+}
+
+void i2c_health_reset(I2C_t I2C_Num)
+{
+    I2C_HealthBus_t *bus = i2c_health_find(I2C_Num);
+
+    if (bus != NULL) {
+        memset(&bus->stats, 0, sizeof(I2C_HealthStats_t));
+        memset(bus->devices, 0, sizeof(bus->devices));
+    }
+}
+
+static I2C_HealthBus_t* i2c_health_find(I2C_t I2C_Num)
+{
+    uint8_t i;
+
+    for (i = 0; i < sizeof(i2c_health_bus) / sizeof(i2c_health_bus[0]); i++) {
+        if (i2c_health_bus[i].bus != 0 && i2c_health_bus[i].bus == I2C_Num)
+            return &i2c_health_bus[i];
+    }
+    return NULL;
+}
+
+static void i2c_health_monitor(I2C_t I2C_Num, int address, HAL_StatusTypeDef status, uint32_t error)
+{
+    I2C_HealthBus_t *bus = i2c_health_find(I2C_Num);
+    I2C_HealthDevice_t *dev = NULL;
+    uint8_t i;
+
+    if (bus == NULL)
+        return;
+
+    /* 주소를 찾고, 없으면 빈 칸을 쓴다 */
+    for (i = 0; i < I2C_HEALTH_MAX_DEVICES; i++) {
+        if (bus->devices[i].address == (uint8_t)address) {
+            dev = &bus->devices[i];
+            break;
+        }
+        if (dev == NULL && bus->devices[i].address == 0)
+            dev = &bus->devices[i];
+    }
+    if (dev == NULL) {
+        bus->stats.dropped++;
+        return;
+    }
+
+    dev->address = (uint8_t)address;
+    dev->transfers++;
+    if (status == HAL_OK)
+        return;
+    dev->errors++;
+    if (status == HAL_TIMEOUT)
+        dev->timeouts++;
+    else if (status == HAL_BUSY)
+        dev->busy++;
+    else if (error & HAL_I2C_ERROR_AF)
+        dev->nacks++;
+}
+
+static void i2c_health_delay(uint32_t us)
+{
+    uint32_t start = I2C_HEALTH_TIMESTAMP();
+    uint32_t cycles = (SystemCoreClock / 1000000) * us;
+
+    while (I2C_HEALTH_TIMESTAMP() - start < cycles)
+        ;
+}
+
+/* 출력 드레인 핀은 ODR 이 아닌 실제 버스 레벨(IDR)을 읽어야 한다 */
+static uint8_t i2c_health_pin_read(GPIO_Pin_t pin)
+{
+    return (gpio_get_port_base(pin)->IDR & GPIO_REG_VALUE(pin)) ? 1 : 0;
+}
+
+static void i2c_health_pin_write(GPIO_Pin_t pin, uint8_t state)
+{
+    GPIO_TypeDef *GPIOx = gpio_get_port_base(pin);
+
+    if (state)
+        GPIOx->BSRR = (uint32_t)GPIO_REG_VALUE(pin);
+    else
+        GPIOx->BSRR = (uint32_t)GPIO_REG_VALUE(pin) << 16U;
+}
+
+/* SCL 한 클록. 슬레이브가 SCL 을 잡고 있으면 I2C_HEALTH_STRETCH_US 까지 기다린다 */
+static int i2c_health_clock(GPIO_Pin_t scl)
+{
+    uint32_t waited = 0;
+
+    i2c_health_pin_write(scl, 0);
+    i2c_health_delay(I2C_HEALTH_HALF_PERIOD_US);
+    i2c_health_pin_write(scl, 1);
+    while (!i2c_health_pin_read(scl)) {
+        if (waited++ >= I2C_HEALTH_STRETCH_US)
+            return -1;
+        i2c_health_delay(1);
+    }
+    i2c_health_delay(I2C_HEALTH_HALF_PERIOD_US);
+    return 1;
+}
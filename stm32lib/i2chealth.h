@@ -0,0 +1,250 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+#ifndef I2CHEALTH_H
+#define I2CHEALTH_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup stm32lib
+ * @{
+ */
+
+/**
+ * @defgroup I2CHEALTH
+ * @brief    I2C 버스 검사, 복구 및 장치 상태 감시 라이브러리
+ * @{
+ *
+ * 전원이 불안정하여 슬레이브가 SDA 를 LOW 로 잡고 있으면 모든 i2c_* 함수가
+ * HAL 타임아웃(@ref I2C_TIMEOUT)만큼 멈추게 된다. 이 라이브러리는
+ *
+ *  - 전송 전에 SCL/SDA 를 확인하여 잡혀 있으면 기다리지 않고 바로 실패하게 하고
+ *  - SCL 을 최대 9 번 직접 토글하고 STOP 을 만들어 버스를 복구한 뒤 주변장치를 다시 초기화하며
+ *  - 장치 주소별로 전송/오류/NACK/타임아웃 횟수를 기록하고
+ *  - 7 비트 주소 전체를 짧은 타임아웃으로 검색한다.
+ *
+ * 비동기 전송(I2CASYNC)은 장치별 횟수에 포함되지 않는다.
+ *
+ * \par 사용 예
+ *
+\code
+i2c_init(I2C_1, I2C1_PINS1);
+i2c_health_init(I2C_1);
+
+if (i2c_read(I2C_1, 0xD0, 0x75) < 0 && i2c_health_check(I2C_1) != I2C_HEALTH_OK)
+    i2c_health_recover(I2C_1);
+\endcode
+ *
+ * \par Changelog
+ *
+\verbatim
+ 버전 1.0
+  - 최초 배포
+\endverbatim
+ *
+ * \par 의존성
+ *
+\verbatim
+ - STM32F4xx HAL
+ - GPIO
+ - I2C
+\endverbatim
+ */
+#include "stm32f4xx_hal.h"
+#include "../stm32lib/gpio.h"
+#include "../stm32lib/i2c.h"
+
+/**
+ * @defgroup I2CHEALTH_매크로
+ * @brief    I2CHEALTH 매크로
+ * @{
+ */
+
+/**
+ * @brief  버스마다 횟수를 기록할 장치 수
+ */
+#ifndef I2C_HEALTH_MAX_DEVICES
+#define I2C_HEALTH_MAX_DEVICES      8
+#endif
+
+/**
+ * @brief  복구할 때 SCL 반 주기 (us). 기본값 5 는 약 100 kHz
+ */
+#ifndef I2C_HEALTH_HALF_PERIOD_US
+#define I2C_HEALTH_HALF_PERIOD_US   5
+#endif
+
+/**
+ * @brief  복구할 때 슬레이브의 클록 늘이기(clock stretching)를 기다리는 최대 시간 (us)
+ */
+#ifndef I2C_HEALTH_STRETCH_US
+#define I2C_HEALTH_STRETCH_US       1000
+#endif
+
+/**
+ * @brief  주소 검색할 때 주소마다 기다리는 최대 시간 (ms)
+ */
+#ifndef I2C_HEALTH_SCAN_TIMEOUT
+#define I2C_HEALTH_SCAN_TIMEOUT     1
+#endif
+
+/**
+ * @brief  복구 지연에 사용하는 사이클 카운터
+ */
+#ifndef I2C_HEALTH_TIMESTAMP
+#define I2C_HEALTH_TIMESTAMP()      (DWT->CYCCNT)
+#endif
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup I2CHEALTH_자료형
+ * @brief    I2CHEALTH 자료형
+ * @{
+ */
+
+/**
+ * @brief  버스 상태 열거형
+ */
+typedef enum {
+    I2C_HEALTH_OK = 0,      /*!< SCL, SDA 모두 HIGH */
+    I2C_HEALTH_SDA_LOW,     /*!< 슬레이브가 SDA 를 잡고 있음. 복구 가능 */
+    I2C_HEALTH_SCL_LOW,     /*!< SCL 이 LOW. 배선 단락 또는 클록 늘이기 중 */
+    I2C_HEALTH_UNKNOWN,     /*!< 초기화되지 않은 버스 */
+} I2C_HealthState_t;
+
+/**
+ * @brief  장치별 횟수 구조체
+ */
+typedef struct {
+    uint8_t address;     /*!< I2C 장치 주소 (8 비트 형식), 0 이면 비어 있음 */
+    uint32_t transfers;  /*!< 전송 횟수 */
+    uint32_t errors;     /*!< 실패한 전송 횟수 */
+    uint32_t nacks;      /*!< 실패한 전송 중 NACK 횟수 */
+    uint32_t timeouts;   /*!< 실패한 전송 중 타임아웃 횟수 */
+    uint32_t busy;       /*!< 버스가 잡혀 있어 시작하지 않은 횟수 */
+} I2C_HealthDevice_t;
+
+/**
+ * @brief  버스 상태 구조체
+ */
+typedef struct {
+    uint32_t recoveries; /*!< 복구 시도 횟수 */
+    uint32_t failures;   /*!< 복구 후에도 버스가 풀리지 않은 횟수 */
+    uint32_t clocks;     /*!< 복구에 사용한 SCL 클록 수 합계 */
+    uint32_t dropped;    /*!< 장치 표가 가득 차 기록하지 못한 전송 횟수 */
+} I2C_HealthStats_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup I2CHEALTH_함수
+ * @brief    I2CHEALTH 함수
+ * @{
+ */
+
+/**
+ * @brief  I2C 버스의 상태 감시를 시작한다
+ * @note   전송 감시 함수를 등록하고, 버스가 잡혀 있으면 바로 실패하도록 설정한다.
+ *         복구 지연을 위해 DWT 사이클 카운터를 켠다
+ * @param  I2C_Num: 감시할 I2C 번호. @ref i2c_init() 로 먼저 초기화해야 한다
+ * @retval 실행 상태, 1: 정상, -1: 오류
+ */
+int i2c_health_init(I2C_t I2C_Num);
+
+/**
+ * @brief  SCL, SDA 핀의 현재 레벨로 버스 상태를 얻는다
+ * @param  I2C_Num: 검사할 I2C 번호
+ * @retval 버스 상태, @ref I2C_HealthState_t
+ */
+I2C_HealthState_t i2c_health_check(I2C_t I2C_Num);
+
+/**
+ * @brief  SCL 을 최대 9 번 토글하고 STOP 을 만들어 버스를 복구한 뒤 I2C 를 다시 초기화한다
+ * @param  I2C_Num: 복구할 I2C 번호
+ * @retval 실행 상태, 1: 버스가 풀림, -1: 풀리지 않음 또는 오류
+ */
+int i2c_health_recover(I2C_t I2C_Num);
+
+/**
+ * @brief  0x08 ~ 0x77 의 7 비트 주소를 검색한다
+ * @param  I2C_Num: 검색할 I2C 번호
+ * @param  map: 응답한 주소의 비트를 1 로 설정할 128 비트 배열 (7 비트 주소 n 은 map[n / 8] 의 비트 n % 8), NULL 가능
+ * @retval 응답한 장치 수, 버스가 잡혀 있거나 오류이면 -1
+ */
+int i2c_health_scan(I2C_t I2C_Num, uint8_t map[16]);
+
+/**
+ * @brief  장치 주소의 횟수를 얻는다
+ * @param  I2C_Num: I2C 번호
+ * @param  address: I2C 장치 주소 (8 비트 형식)
+ * @param  device: 횟수를 저장할 구조체
+ * @retval 실행 상태, 1: 정상, -1: 기록된 적 없는 주소
+ */
+int i2c_health_get_device(I2C_t I2C_Num, int address, I2C_HealthDevice_t* device);
+
+/**
+ * @brief  버스의 복구 횟수를 얻는다
+ * @param  I2C_Num: I2C 번호
+ * @param  stats: 횟수를 저장할 구조체
+ * @retval 없음
+ */
+void i2c_health_get_stats(I2C_t I2C_Num, I2C_HealthStats_t* stats);
+
+/**
+ * @brief  버스의 복구 횟수와 장치 표를 지운다
+ * @param  I2C_Num: I2C 번호
+ * @retval 없음
+ */
+void i2c_health_reset(I2C_t I2C_Num);
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
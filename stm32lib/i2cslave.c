@@ -0,0 +1,290 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+#include "../stm32lib/i2cslave.h"
+
+/* Private transfer direction */
+#define I2C_SLAVE_IDLE  0
+#define I2C_SLAVE_RX    1   /* 마스터가 쓰는 중 */
+#define I2C_SLAVE_TX    2   /* 마스터가 읽는 중 */
+
+/* Private I2C slave bus structure */
+typedef struct {
+    I2C_HandleTypeDef *handle;  /* NULL 이면 초기화되지 않음 */
+    I2C_Slave_t *slave;
+    uint8_t dir;
+    uint8_t first;              /* 다음에 받는 바이트가 레지스터 주소 */
+    uint16_t ptr;               /* 현재 레지스터 포인터 */
+    uint16_t start;             /* 이번 쓰기의 시작 레지스터 */
+    uint16_t written;           /* 이번 쓰기로 바뀐 레지스터 수 */
+    uint16_t armed;             /* 현재 걸어 둔 전송의 바이트 수 */
+    uint8_t rxbuf[I2C_SLAVE_BUFFER_SIZE];
+    I2C_SlaveStats_t stats;
+} I2C_SlaveBus_t;
+
+/* Private variable */
+static I2C_SlaveBus_t i2c_slave_bus[3];
+
+/* Private functions */
+static I2C_SlaveBus_t* i2c_slave_find(I2C_HandleTypeDef* hi2c);
+static uint16_t i2c_slave_remaining(I2C_SlaveBus_t* bus);
+static void i2c_slave_consume(I2C_SlaveBus_t* bus, uint16_t length);
+static void i2c_slave_receive(I2C_SlaveBus_t* bus, uint32_t option);
+static void i2c_slave_transmit(I2C_SlaveBus_t* bus, uint32_t option);
+static void i2c_slave_finish(I2C_SlaveBus_t* bus);
+static void i2c_slave_error(I2C_HandleTypeDef* hi2c);
+
+int i2c_slave_init(I2C_t I2C_Num, int address, I2C_Slave_t* slave)
+{
+    I2C_HandleTypeDef *hi2c = i2c_get_handle(I2C_Num);
+    I2C_SlaveBus_t *bus;
+    uint8_t i;
+
+    if (hi2c == NULL || slave == NULL || slave->regs == NULL || slave->size == 0 || slave->size > 256)
+        return -1;
+
+    bus = i2c_slave_find(hi2c);
+    for (i = 0; bus == NULL && i < sizeof(i2c_slave_bus) / sizeof(i2c_slave_bus[0]); i++) {
+        if (i2c_slave_bus[i].handle == NULL)
+            bus = &i2c_slave_bus[i];
+    }
+    if (bus == NULL)
+        return -1;
+    memset(bus, 0, sizeof(I2C_SlaveBus_t));
+    bus->handle = hi2c;
+    bus->slave = slave;
+
+    /* 자신의 주소로 다시 초기화하고 주소 일치 인터럽트를 기다린다 */
+    i2c_set_own_address(I2C_Num, address);
+    i2c_set_slave(I2C_Num, 1);
+    i2c_set_error_handler(I2C_Num, i2c_slave_error);
+    if (i2c_irq_init(I2C_Num, I2C_NVIC_PRIORITY) < 0 || HAL_I2C_EnableListen_IT(hi2c) != HAL_OK) {
+        /* 마스터 모드로 되돌린다 */
+        i2c_set_error_handler(I2C_Num, NULL);
+        bus->handle = NULL;
+        i2c_set_slave(I2C_Num, 0);
+        return -1;
+    }
+    return 1;
+}
+
+void i2c_slave_deinit(I2C_t I2C_Num)
+{
+    I2C_SlaveBus_t *bus = i2c_slave_find(i2c_get_handle(I2C_Num));
+
+    if (bus == NULL)
+        return;
+    HAL_I2C_DisableListen_IT(bus->handle);
+    i2c_set_error_handler(I2C_Num, NULL);
+    bus->handle = NULL;
+    i2c_set_slave(I2C_Num, 0);
+}
+
+void i2c_slave_get_stats(I2C_t I2C_Num, I2C_SlaveStats_t* stats)
+{
+    I2C_SlaveBus_t *bus = i2c_slave_find(i2c_get_handle(I2C_Num));
+
+    if (bus != NULL)
+        *stats = bus->stats;
+    else
+        memset(stats, 0, sizeof(I2C_SlaveStats_t));
+}
+
+void i2c_slave_reset_stats(I2C_t I2C_Num)
+{
+    I2C_SlaveBus_t *bus = i2c_slave_find(i2c_get_handle(I2C_Num));
+
+    if (bus != NULL)
+        memset(&bus->stats, 0, sizeof(I2C_SlaveStats_t));
+}
+
+static I2C_SlaveBus_t* i2c_slave_find(I2C_HandleTypeDef* hi2c)
+{
+    uint8_t i;
+
+    if (hi2c == NULL)
+        return NULL;
+    for (i = 0; i < sizeof(i2c_slave_bus) / sizeof(i2c_slave_bus[0]); i++)
+        if (i2c_slave_bus[i].handle == hi2c)
+            return &i2c_slave_bus[i];
+    return NULL;
+}
+
+/* 현재 전송에서 아직 받거나 보내지 않은 바이트 수 */
+static uint16_t i2c_slave_remaining(I2C_SlaveBus_t* bus)
+{
+    I2C_HandleTypeDef *hi2c = bus->handle;
+
+    if (bus->dir == I2C_SLAVE_RX && hi2c->hdmarx != NULL)
+        return (uint16_t)__HAL_DMA_GET_COUNTER(hi2c->hdmarx);
+    if (bus->dir == I2C_SLAVE_TX && hi2c->hdmatx != NULL)
+        return (uint16_t)__HAL_DMA_GET_COUNTER(hi2c->hdmatx);
+    return hi2c->XferCount;
+}
+
+/* 받기 버퍼의 바이트들을 레지스터 주소와 레지스터 값으로 처리한다 */
+static void i2c_slave_consume(I2C_SlaveBus_t* bus, uint16_t length)
+{
+    I2C_Slave_t *slave = bus->slave;
+    uint16_t i;
+
+    bus->stats.rxbytes += length;
+    for (i = 0; i < length; i++) {
+        if (bus->first) {
+            bus->ptr = bus->rxbuf[i] % slave->size;
+            bus->start = bus->ptr;
+            bus->first = 0;
+            continue;
+        }
+        if (slave->writable == NULL || (slave->writable[bus->ptr >> 3] & (1 << (bus->ptr & 0x07)))) {
+            slave->regs[bus->ptr] = bus->rxbuf[i];
+            bus->written++;
+        }
+        if (++bus->ptr >= slave->size)
+            bus->ptr = 0;
+    }
+}
+
+static void i2c_slave_receive(I2C_SlaveBus_t* bus, uint32_t option)
+{
+    I2C_HandleTypeDef *hi2c = bus->handle;
+
+    bus->dir = I2C_SLAVE_RX;
+    bus->armed = I2C_SLAVE_BUFFER_SIZE;
+    if (hi2c->hdmarx != NULL)
+        HAL_I2C_Slave_Seq_Receive_DMA(hi2c, bus->rxbuf, bus->armed, option);
+    else
+        HAL_I2C_Slave_Seq_Receive_IT(hi2c, bus->rxbuf, bus->armed, option);
+}
+
+/* 현재 레지스터부터 맵의 끝까지 보낸다. 더 읽으면 완료 콜백에서 0 번부터 이어 보낸다 */
+static void i2c_slave_transmit(I2C_SlaveBus_t* bus, uint32_t option)
+{
+    I2C_HandleTypeDef *hi2c = bus->handle;
+    I2C_Slave_t *slave = bus->slave;
+
+    bus->dir = I2C_SLAVE_TX;
+    bus->armed = slave->size - bus->ptr;
+    if (hi2c->hdmatx != NULL)
+        HAL_I2C_Slave_Seq_Transmit_DMA(hi2c, &slave->regs[bus->ptr], bus->armed, option);
+    else
+        HAL_I2C_Slave_Seq_Transmit_IT(hi2c, &slave->regs[bus->ptr], bus->armed, option);
+}
+
+/* STOP 이나 반복 시작에서 현재 전송을 끝낸다 */
+static void i2c_slave_finish(I2C_SlaveBus_t* bus)
+{
+    I2C_Slave_t *slave = bus->slave;
+    uint16_t remaining = i2c_slave_remaining(bus);
+    uint16_t length = (remaining < bus->armed) ? bus->armed - remaining : 0;
+
+    if (bus->dir == I2C_SLAVE_RX) {
+        i2c_slave_consume(bus, length);
+        bus->stats.writes++;
+        if (bus->written > 0 && slave->callback != NULL)
+            slave->callback(slave, (uint8_t)bus->start, bus->written);
+    } else if (bus->dir == I2C_SLAVE_TX) {
+        bus->stats.txbytes += length;
+        bus->stats.reads++;
+        bus->ptr = (bus->ptr + length) % slave->size;
+    }
+    bus->dir = I2C_SLAVE_IDLE;
+}
+
+/* I2C 라이브러리의 HAL 오류 콜백에서 호출된다. 읽기 끝의 NACK 은 정상 종료이다 */
+static void i2c_slave_error(I2C_HandleTypeDef* hi2c)
+{
+    I2C_SlaveBus_t *bus = i2c_slave_find(hi2c);
+
+    if (bus == NULL)
+        return;
+    if (hi2c->ErrorCode & ~HAL_I2C_ERROR_AF)
+        bus->stats.errors++;
+    if (bus->dir != I2C_SLAVE_IDLE)
+        i2c_slave_finish(bus);
+    HAL_I2C_EnableListen_IT(hi2c);
+}
+
+/* HAL 슬레이브 콜백 함수들 */
+void HAL_I2C_AddrCallback(I2C_HandleTypeDef* hi2c, uint8_t TransferDirection, uint16_t AddrMatchCode)
+{
+    I2C_SlaveBus_t *bus = i2c_slave_find(hi2c);
+
+    (void)AddrMatchCode;
+    if (bus == NULL)
+        return;
+    /* 반복 시작이면 앞의 전송을 먼저 끝낸다 */
+    if (bus->dir != I2C_SLAVE_IDLE)
+        i2c_slave_finish(bus);
+
+    if (TransferDirection == I2C_DIRECTION_TRANSMIT) {
+        /* 마스터가 쓴다 */
+        bus->first = 1;
+        bus->written = 0;
+        i2c_slave_receive(bus, I2C_FIRST_FRAME);
+    } else {
+        /* 마스터가 읽는다 */
+        i2c_slave_transmit(bus, I2C_LAST_FRAME);
+    }
+}
+
+void HAL_I2C_SlaveRxCpltCallback(I2C_HandleTypeDef* hi2c)
+{
+    I2C_SlaveBus_t *bus = i2c_slave_find(hi2c);
+
+    if (bus == NULL || bus->dir != I2C_SLAVE_RX)
+        return;
+    /* 받기 버퍼가 찼다. 처리하고 처음부터 다시 받는다 */
+    i2c_slave_consume(bus, bus->armed);
+    bus->stats.wraps++;
+    i2c_slave_receive(bus, I2C_NEXT_FRAME);
+}
+
+void HAL_I2C_SlaveTxCpltCallback(I2C_HandleTypeDef* hi2c)
+{
+    I2C_SlaveBus_t *bus = i2c_slave_find(hi2c);
+
+    if (bus == NULL || bus->dir != I2C_SLAVE_TX)
+        return;
+    /* 맵의 끝까지 보냈다. 0 번 레지스터부터 이어 보낸다 */
+    bus->stats.txbytes += bus->armed;
+    bus->stats.wraps++;
+    bus->ptr = 0;
+    i2c_slave_transmit(bus, I2C_NEXT_FRAME);
+}
+
+void HAL_I2C_ListenCpltCallback(I2C_HandleTypeDef* hi2c)
+{
+    I2C_SlaveBus_t *bus = i2c_slave_find(hi2c);
+
+    if (bus == NULL)
+        return;
+    if (bus->dir != I2C_SLAVE_IDLE)
+        i2c_slave_finish(bus);
+    /* 다음 주소 일치를 기다린다 */
+    HAL_I2C_EnableListen_IT(hi2c);
+}
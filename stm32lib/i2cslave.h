@@ -0,0 +1,204 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+#ifndef I2CSLAVE_H
+#define I2CSLAVE_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup stm32lib
+ * @{
+ */
+
+/**
+ * @defgroup I2CSLAVE
+ * @brief    레지스터 맵을 제공하는 I2C 슬레이브 라이브러리
+ * @{
+ *
+ * STM32 를 다른 프로세서의 I2C 주변장치로 동작시킨다. 마스터가 보는 장치는 일반적인
+ * 레지스터 장치와 같다.
+ *
+ *  - 쓰기: 첫 바이트는 레지스터 주소이고, 이어지는 바이트들은 그 주소부터 차례로 레지스터에 쓰인다
+ *  - 읽기: 마지막 레지스터 주소부터 차례로 읽는다. 맵의 끝에 닿으면 0 번 레지스터로 돌아간다
+ *
+ * 주소가 일치하면 한 번의 전송 전체를 DMA 로 받거나 보내므로, CPU 는 바이트마다가 아니라
+ * 전송(주소 일치, STOP)마다 인터럽트를 받는다. 받기 버퍼(@ref I2C_SLAVE_BUFFER_SIZE)와
+ * 보내기 영역(레지스터 맵)은 원형으로 사용되어, 버퍼보다 긴 쓰기나 맵보다 긴 읽기도 이어서 처리된다.
+ * I2C 핸들에 DMA 가 연결되어 있지 않으면 인터럽트 전송을 사용한다.
+ *
+ * 마스터가 레지스터를 쓰면 전송이 끝난 뒤 인터럽트 문맥에서 콜백 함수가 호출된다.
+ * 마스터가 읽는 동안 바뀔 수 있는 여러 바이트 값은 인터럽트를 막고 갱신해야 한다.
+ *
+ * \par 사용 예
+ *
+\code
+static uint8_t regs[32] = {0x5A};
+static I2C_Slave_t dev = {regs, sizeof(regs), NULL, regs_written, NULL};
+
+i2c_init(I2C_1, I2C1_PINS1);
+i2c_slave_init(I2C_1, 0x84, &dev);
+\endcode
+ *
+ * \par Changelog
+ *
+\verbatim
+ 버전 1.0
+  - 최초 배포
+\endverbatim
+ *
+ * \par 의존성
+ *
+\verbatim
+ - STM32F4xx HAL
+ - I2C
+\endverbatim
+ */
+#include "stm32f4xx_hal.h"
+#include "../stm32lib/i2c.h"
+
+/**
+ * @defgroup I2CSLAVE_매크로
+ * @brief    I2CSLAVE 매크로
+ * @{
+ */
+
+/**
+ * @brief  마스터가 쓴 데이터를 받는 원형 버퍼의 크기(바이트 단위)
+ * @note   쓰기가 이보다 길면 버퍼가 찰 때마다 한 번 인터럽트가 추가된다
+ */
+#ifndef I2C_SLAVE_BUFFER_SIZE
+#define I2C_SLAVE_BUFFER_SIZE   64
+#endif
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup I2CSLAVE_자료형
+ * @brief    I2CSLAVE 자료형
+ * @{
+ */
+
+typedef struct I2C_Slave I2C_Slave_t;
+
+/**
+ * @brief  마스터가 레지스터를 쓴 뒤 호출되는 함수 (인터럽트 문맥)
+ * @param  slave: 슬레이브 구조체
+ * @param  reg: 쓰기를 시작한 레지스터 주소
+ * @param  length: 쓰인 레지스터 수. 읽기 전용 레지스터는 세지 않는다
+ */
+typedef void (*I2C_SlaveCallback_t)(I2C_Slave_t* slave, uint8_t reg, uint16_t length);
+
+/**
+ * @brief  레지스터 맵 구조체
+ */
+struct I2C_Slave {
+    uint8_t *regs;                 /*!< 레지스터 맵 */
+    uint16_t size;                 /*!< 레지스터 수 (1 ~ 256) */
+    const uint8_t *writable;       /*!< 쓰기 가능한 레지스터 비트맵 (레지스터 n 은 writable[n / 8] 의 비트 n % 8), NULL 이면 모두 쓰기 가능 */
+    I2C_SlaveCallback_t callback;  /*!< 쓰기 완료 콜백 함수, NULL 가능 */
+    void *arg;                     /*!< 콜백 함수에서 사용할 사용자 인자 */
+};
+
+/**
+ * @brief  슬레이브 통계 구조체
+ */
+typedef struct {
+    uint32_t writes;     /*!< 마스터가 쓴 전송 수 */
+    uint32_t reads;      /*!< 마스터가 읽은 전송 수 */
+    uint32_t rxbytes;    /*!< 받은 바이트 수 (레지스터 주소 포함) */
+    uint32_t txbytes;    /*!< 보낸 바이트 수 */
+    uint32_t wraps;      /*!< 받기 버퍼나 레지스터 맵 끝에서 되돌아간 횟수 */
+    uint32_t errors;     /*!< 버스 오류 횟수 (읽기 끝의 NACK 은 제외) */
+} I2C_SlaveStats_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup I2CSLAVE_함수
+ * @brief    I2CSLAVE 함수
+ * @{
+ */
+
+/**
+ * @brief  I2C 버스를 슬레이브로 설정하고 주소 일치를 기다린다
+ * @note   @ref i2c_init() 로 먼저 초기화해야 한다. DMA 를 쓰려면 이 함수보다 먼저
+ *         @ref i2c_get_handle() 과 __HAL_LINKDMA 로 DMA 를 연결하고 DMA 인터럽트를 설정한다
+ * @param  I2C_Num: 선택할 I2C 번호
+ * @param  address: 8 비트 형식의 자신의 주소
+ * @param  slave: 레지스터 맵 구조체. 슬레이브가 동작하는 동안 유지되어야 한다
+ * @retval 실행 상태, 1: 정상, -1: 오류
+ */
+int i2c_slave_init(I2C_t I2C_Num, int address, I2C_Slave_t* slave);
+
+/**
+ * @brief  슬레이브 동작을 멈춘다
+ * @param  I2C_Num: 선택할 I2C 번호
+ * @retval 없음
+ */
+void i2c_slave_deinit(I2C_t I2C_Num);
+
+/**
+ * @brief  슬레이브 통계를 얻는다
+ * @param  I2C_Num: I2C 번호
+ * @param  stats: 통계를 저장할 구조체
+ * @retval 없음
+ */
+void i2c_slave_get_stats(I2C_t I2C_Num, I2C_SlaveStats_t* stats);
+
+/**
+ * @brief  슬레이브 통계를 지운다
+ * @param  I2C_Num: I2C 번호
+ * @retval 없음
+ */
+void i2c_slave_reset_stats(I2C_t I2C_Num);
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,164 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+#include "../stm32lib/i2ctrace.h"
+
+#if I2C_TRACE
+
+#if (I2C_TRACE_SIZE & (I2C_TRACE_SIZE - 1)) != 0
+#error "I2C_TRACE_SIZE must be a power of 2"
+#endif
+
+/* Private variable */
+static I2C_TraceEntry_t i2c_trace_buffer[I2C_TRACE_SIZE];
+static volatile uint32_t i2c_trace_head;    /* 예약된 기록 수 */
+static uint32_t i2c_trace_tail;             /* 읽은 기록 수 */
+static uint32_t i2c_trace_lost;
+
+/* Private functions */
+static uint32_t i2c_trace_reserve(void);
+static uint8_t i2c_trace_busnum(I2C_t I2C_Num);
+
+void i2c_trace_record(I2C_t I2C_Num, int address, int reg, I2C_TraceDir_t dir, int length,
+                      HAL_StatusTypeDef status, uint32_t error, uint32_t start)
+{
+    uint32_t end, index;
+    I2C_TraceEntry_t *slot;
+
+    end = I2C_TRACE_TIMESTAMP();
+    index = i2c_trace_reserve();
+    slot = &i2c_trace_buffer[index & (I2C_TRACE_SIZE - 1)];
+
+    /* 다 쓰기 전에는 읽지 못하도록 순번을 0 으로 두었다가 마지막에 채운다 */
+    slot->seq = 0;
+    __DMB();
+    slot->start = start;
+    slot->end = end;
+    slot->error = error;
+    slot->reg = (uint16_t)reg;
+    slot->length = (uint16_t)length;
+    slot->bus = i2c_trace_busnum(I2C_Num);
+    slot->address = (uint8_t)address;
+    slot->dir = (uint8_t)dir;
+    slot->status = (uint8_t)status;
+    __DMB();
+    slot->seq = index + 1;
+}
+
+int i2c_trace_read(I2C_TraceEntry_t* entry)
+{
+    I2C_TraceEntry_t *slot;
+    uint32_t head, seq;
+
+    for (;;) {
+        head = i2c_trace_head;
+        /* 덮어써진 기록은 건너뛴다 */
+        if (head - i2c_trace_tail > I2C_TRACE_SIZE) {
+            i2c_trace_lost += head - i2c_trace_tail - I2C_TRACE_SIZE;
+            i2c_trace_tail = head - I2C_TRACE_SIZE;
+        }
+        if (i2c_trace_tail == head)
+            return 0;
+
+        slot = &i2c_trace_buffer[i2c_trace_tail & (I2C_TRACE_SIZE - 1)];
+        seq = slot->seq;
+        if (seq == 0)
+            return 0;   /* 아직 쓰는 중 */
+        *entry = *slot;
+        __DMB();
+        /* 복사하는 동안 덮어써지지 않았으면 꺼낸다. 덮어써졌으면 head 가 앞서 있다 */
+        if (seq == i2c_trace_tail + 1 && slot->seq == seq) {
+            i2c_trace_tail++;
+            return 1;
+        }
+        /* head 가 그대로이면 앞 바퀴의 순번이 남은 것이다. 쓰는 쪽이 아직 순번을 지우지 않았다 */
+        if (i2c_trace_head == head)
+            return 0;
+    }
+}
+
+uint32_t i2c_trace_dropped(void)
+{
+    return i2c_trace_lost;
+}
+
+void i2c_trace_clear(void)
+{
+    i2c_trace_tail = i2c_trace_head;
+    i2c_trace_lost = 0;
+}
+
+void i2c_trace_dump(void)
+{
+    I2C_TraceEntry_t entry;
+
+    printf("# i2ctrace clock=%lu\r\n", (unsigned long)SystemCoreClock);
+    while (i2c_trace_read(&entry) > 0) {
+        printf("I2C%u %02X %04X %c %u %u %lX %lu %lu\r\n",
+               entry.bus, entry.address, entry.reg, entry.dir, entry.length,
+               entry.status, (unsigned long)entry.error,
+               (unsigned long)entry.start, (unsigned long)entry.end);
+    }
+    printf("# dropped=%lu\r\n", (unsigned long)i2c_trace_lost);
+}
+
+/* 기록할 슬롯 번호를 잠금 없이 예약한다 */
+static uint32_t i2c_trace_reserve(void)
+{
+    uint32_t index;
+#if defined(__CORTEX_M) && (__CORTEX_M >= 3U)
+    do {
+        index = __LDREXW(&i2c_trace_head);
+    } while (__STREXW(index + 1, &i2c_trace_head) != 0);
+#else
+    /* Cortex-M0 에는 LDREX/STREX 가 없으므로 짧게 인터럽트를 막는다 */
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    index = i2c_trace_head++;
+    __set_PRIMASK(primask);
+#endif
+    return index;
+}
+
+static uint8_t i2c_trace_busnum(I2C_t I2C_Num)
+{
+#ifdef I2C1
+    if (I2C_Num == I2C_1)
+        return 1;
+#endif
+#ifdef I2C2
+    if (I2C_Num == I2C_2)
+        return 2;
+#endif
+#ifdef I2C3
+    if (I2C_Num == I2C_3)
+        return 3;
+#endif
+    return 0;
+}
+
+#endif
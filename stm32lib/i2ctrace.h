@@ -0,0 +1,219 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+#ifndef I2CTRACE_H
+#define I2CTRACE_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup stm32lib
+ * @{
+ */
+
+/**
+ * @defgroup I2CTRACE
+ * @brief    I2C 전송 추적 라이브러리
+ * @{
+ *
+ * @ref I2C_TRACE 를 1 로 정의하여 빌드하면 I2C 라이브러리의 모든 전송이 끝날 때마다
+ * 버스, 장치 주소, 레지스터, 길이, 방향, 시작/끝 사이클 카운터, HAL 상태와 오류 코드가
+ * 링 버퍼에 기록된다. 0 이면(기본값) 이 라이브러리와 I2C 라이브러리의 추적 코드는
+ * 전혀 만들어지지 않는다.
+ *
+ * 기록은 잠금 없이 슬롯을 예약하므로 인터럽트에서 일어나는 전송도 기록할 수 있다.
+ * 버퍼가 가득 차면 오래된 기록부터 덮어쓰고, 읽을 때 잃어버린 수를 센다.
+ *
+ * @ref i2c_trace_dump() 는 기록을 한 줄씩 printf 로 출력한다. 이 출력을 그대로 저장하여
+ * 호스트에서 tools/i2ctrace.c 로 해석하면 전송 시간표와 장치별 대역폭 요약을 얻는다.
+ *
+ * \par 사용 예
+ *
+\code
+// 컴파일러 옵션: -DI2C_TRACE=1
+mpu6050_readall(&mpu6050);
+ssd1306_updatescreen();
+i2c_trace_dump();
+\endcode
+ *
+ * \par Changelog
+ *
+\verbatim
+ 버전 1.0
+  - 최초 배포
+\endverbatim
+ *
+ * \par 의존성
+ *
+\verbatim
+ - STM32F4xx HAL
+ - I2C
+ - stdio.h
+\endverbatim
+ */
+#include "stm32f4xx_hal.h"
+#include "../stm32lib/i2c.h"
+#include "stdio.h"
+
+/**
+ * @defgroup I2CTRACE_매크로
+ * @brief    I2CTRACE 매크로
+ * @{
+ */
+
+/**
+ * @brief  링 버퍼에 보관하는 기록 수. 2의 거듭제곱이어야 한다
+ */
+#ifndef I2C_TRACE_SIZE
+#define I2C_TRACE_SIZE          64
+#endif
+
+/**
+ * @brief  전송 시간을 재는 사이클 카운터. 호스트 시험에서는 가짜 카운터로 바꿀 수 있다
+ * @note   기본값인 DWT 사이클 카운터는 @ref i2c_init() 이 켠다
+ */
+#ifndef I2C_TRACE_TIMESTAMP
+#define I2C_TRACE_TIMESTAMP()   (DWT->CYCCNT)
+#endif
+
+/**
+ * @brief  레지스터 주소 없이 보낸 전송의 reg 값
+ */
+#define I2C_TRACE_NOREG         0xFFFF
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup I2CTRACE_자료형
+ * @brief    I2CTRACE 자료형
+ * @{
+ */
+
+/**
+ * @brief  전송 방향 열거형
+ */
+typedef enum {
+    I2C_TRACE_WRITE = 'W',  /*!< 장치로 쓰기 */
+    I2C_TRACE_READ = 'R',   /*!< 장치에서 읽기 */
+    I2C_TRACE_PROBE = 'P'   /*!< 장치 응답 확인 */
+} I2C_TraceDir_t;
+
+/**
+ * @brief  전송 기록 구조체
+ */
+typedef struct {
+    uint32_t seq;       /*!< 기록 순번 + 1. 0 이면 쓰는 중. 내부용 */
+    uint32_t start;     /*!< 전송 시작 사이클 카운터 */
+    uint32_t end;       /*!< 전송 끝 사이클 카운터 */
+    uint32_t error;     /*!< HAL 오류 코드 (HAL_I2C_ERROR_xxx) */
+    uint16_t reg;       /*!< 레지스터 주소. 없으면 @ref I2C_TRACE_NOREG */
+    uint16_t length;    /*!< 데이터 바이트 수 */
+    uint8_t bus;        /*!< I2C 번호 (1, 2, 3) */
+    uint8_t address;    /*!< I2C 장치 주소 */
+    uint8_t dir;        /*!< @ref I2C_TraceDir_t */
+    uint8_t status;     /*!< HAL 상태 (HAL_OK, HAL_ERROR, HAL_BUSY, HAL_TIMEOUT) */
+} I2C_TraceEntry_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup I2CTRACE_함수
+ * @brief    I2CTRACE 함수
+ * @{
+ */
+
+#if I2C_TRACE
+
+/**
+ * @brief  전송 하나를 기록한다. I2C 라이브러리에서 호출한다
+ * @param  I2C_Num: I2C 번호
+ * @param  address: I2C 장치 주소
+ * @param  reg: 레지스터 주소 또는 @ref I2C_TRACE_NOREG
+ * @param  dir: @ref I2C_TraceDir_t
+ * @param  length: 데이터 바이트 수
+ * @param  status: HAL 상태
+ * @param  error: HAL 오류 코드
+ * @param  start: 전송을 시작한 @ref I2C_TRACE_TIMESTAMP() 값
+ * @note   DWT 사이클 카운터는 I2C_TRACE 가 1 이면 @ref i2c_init() 에서 켠다
+ * @retval 없음
+ */
+void i2c_trace_record(I2C_t I2C_Num, int address, int reg, I2C_TraceDir_t dir, int length,
+                      HAL_StatusTypeDef status, uint32_t error, uint32_t start);
+
+/**
+ * @brief  가장 오래된 기록 하나를 꺼낸다
+ * @note   기록 중인 슬롯을 만나면 기다리지 않고 0 을 돌려준다. 나중에 다시 읽으면 된다
+ * @param  entry: 기록을 저장할 구조체
+ * @retval 1: 꺼냄, 0: 기록 없음
+ */
+int i2c_trace_read(I2C_TraceEntry_t* entry);
+
+/**
+ * @brief  덮어써서 잃어버린 기록 수를 얻는다
+ * @retval 잃어버린 기록 수
+ */
+uint32_t i2c_trace_dropped(void);
+
+/**
+ * @brief  남은 기록을 모두 지운다
+ * @retval 없음
+ */
+void i2c_trace_clear(void);
+
+/**
+ * @brief  남은 기록을 모두 꺼내 tools/i2ctrace.c 가 해석하는 형식으로 printf 출력한다
+ * @retval 없음
+ */
+void i2c_trace_dump(void);
+
+#endif
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
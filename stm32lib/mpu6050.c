@@ -26,7 +26,7 @@
  *----------------------------------------------------------------------
  */
 
-#include "../stm32lib/i2c.h"
+#include "../stm32lib/i2cbus.h"
 #include "../stm32lib/mpu6050.h"
 
 /* 자신에 대한 레지스터 값 */
@@ -87,12 +87,15 @@ MPU6050_Res_t mpu6050_init(MPU6050_t* mpu6050, MPU6050_Dev_t devnum, MPU6050_Acc
     /* I2C 주소 구성 */
     mpu6050->address = MPU6050_I2C_ADDR | (uint8_t)devnum;
     
-    /* I2C 초기화 */
-    i2c_init(MPU6050_I2C, MPU6050_I2C_PINSPACK);
-    i2c_set_frequency(MPU6050_I2C, 400000);
+    /* 공유 I2C 버스에 장치 등록 */
+    if (i2c_bus_attach(&mpu6050->dev, MPU6050_I2C, MPU6050_I2C_PINSPACK, mpu6050->address, MPU6050_I2C_CLOCK) < 0)
+        return MPU6050_RES_ERR;
+    if (i2c_bus_acquire(&mpu6050->dev, I2C_BUS_TIMEOUT) < 0)
+        return MPU6050_RES_ERR;
     
     /* 장치 연결 점검 */
     if (i2c_ready(MPU6050_I2C, mpu6050->address) < 0) {
+        i2c_bus_release(&mpu6050->dev);
         /* 오류 반환 */
         return MPU6050_RES_NOTCONNECT;
     }
@@ -100,6 +103,7 @@ MPU6050_Res_t mpu6050_init(MPU6050_t* mpu6050, MPU6050_Dev_t devnum, MPU6050_Acc
     /* MPU6050 장치 확인 */
     i2c_read(MPU6050_I2C, mpu6050->address, MPU6050_WHO_AM_I, &temp);
     if (temp != MPU6050_I_AM) {
+        i2c_bus_release(&mpu6050->dev);
         /* 오류 반환 */
         return MPU6050_RES_INVALID;
     }
@@ -115,6 +119,7 @@ MPU6050_Res_t mpu6050_init(MPU6050_t* mpu6050, MPU6050_Dev_t devnum, MPU6050_Acc
     
     /* 자이로스코프 설정 */
     mpu6050_setgyro(mpu6050, gyro);
+    i2c_bus_release(&mpu6050->dev);
     
     /* 정상 반환 */
     return MPU6050_RES_OK;
@@ -125,9 +130,12 @@ MPU6050_Res_t mpu6050_setacc(MPU6050_t* mpu6050, MPU6050_Acc_t acc)
     uint8_t temp;
     
     /* 가속도계 설정 */
+    if (i2c_bus_acquire(&mpu6050->dev, I2C_BUS_TIMEOUT) < 0)
+        return MPU6050_RES_ERR;
     i2c_read(MPU6050_I2C, mpu6050->address, MPU6050_ACCEL_CONFIG, &temp);
     temp = (temp & 0xE7) | (uint8_t)acc << 3;
     i2c_write(MPU6050_I2C, mpu6050->address, MPU6050_ACCEL_CONFIG, temp);
+    i2c_bus_release(&mpu6050->dev);
     
     switch (acc) {
     case MPU6050_ACC_2G:
@@ -154,9 +162,12 @@ MPU6050_Res_t mpu6050_setgyro(MPU6050_t* mpu6050, MPU6050_Gyro_t gyro)
     uint8_t temp;
     
     /* 자이로스코프 설정 */
+    if (i2c_bus_acquire(&mpu6050->dev, I2C_BUS_TIMEOUT) < 0)
+        return MPU6050_RES_ERR;
     i2c_read(MPU6050_I2C, mpu6050->address, MPU6050_GYRO_CONFIG, &temp);
     temp = (temp & 0xE7) | (uint8_t)gyro << 3;
     i2c_write(MPU6050_I2C, mpu6050->address, MPU6050_GYRO_CONFIG, temp);
+    i2c_bus_release(&mpu6050->dev);
     
     switch (gyro) {
     case MPU6050_GYRO_250S:
@@ -180,8 +191,14 @@ MPU6050_Res_t mpu6050_setgyro(MPU6050_t* mpu6050, MPU6050_Gyro_t gyro)
 
 MPU6050_Res_t mpu6050_setrate(MPU6050_t* mpu6050, uint8_t rate)
 {
+    int result;
+    
     /* 데이터 처리율 설정 */
-    if (i2c_write(MPU6050_I2C, mpu6050->address, MPU6050_SMPLRT_DIV, rate) < 0) {
+    if (i2c_bus_acquire(&mpu6050->dev, I2C_BUS_TIMEOUT) < 0)
+        return MPU6050_RES_ERR;
+    result = i2c_write(MPU6050_I2C, mpu6050->address, MPU6050_SMPLRT_DIV, rate);
+    i2c_bus_release(&mpu6050->dev);
+    if (result < 0) {
         /* 오류 반환 */
         return MPU6050_RES_ERR;
     }
@@ -195,7 +212,10 @@ MPU6050_Res_t mpu6050_readacc(MPU6050_t* mpu6050)
     uint8_t data[6];
     
     /* 가속도계 데이터 읽기 */
+    if (i2c_bus_acquire(&mpu6050->dev, I2C_BUS_TIMEOUT) < 0)
+        return MPU6050_RES_ERR;
     i2c_nread(MPU6050_I2C, mpu6050->address, MPU6050_ACCEL_XOUT_H, data, 6);
+    i2c_bus_release(&mpu6050->dev);
     
     /* Format */
     mpu6050->acc_x = (int16_t)(data[0] << 8 | data[1]);    
@@ -211,7 +231,10 @@ MPU6050_Res_t mpu6050_readgyro(MPU6050_t* mpu6050)
     uint8_t data[6];
     
     /* 자이로스코프 데이터 읽기 */
+    if (i2c_bus_acquire(&mpu6050->dev, I2C_BUS_TIMEOUT) < 0)
+        return MPU6050_RES_ERR;
     i2c_nread(MPU6050_I2C, mpu6050->address, MPU6050_GYRO_XOUT_H, data, 6);
+    i2c_bus_release(&mpu6050->dev);
     
     /* Format */
     mpu6050->gyro_x = (int16_t)(data[0] << 8 | data[1]);
@@ -228,7 +251,10 @@ MPU6050_Res_t mpu6050_readtemp(MPU6050_t* mpu6050)
     int16_t temp;
     
     /* 온도 데이터 읽기 */
+    if (i2c_bus_acquire(&mpu6050->dev, I2C_BUS_TIMEOUT) < 0)
+        return MPU6050_RES_ERR;
     i2c_nread(MPU6050_I2C, mpu6050->address, MPU6050_TEMP_OUT_H, data, 2);
+    i2c_bus_release(&mpu6050->dev);
     
     /* 온도 값 구성 */
     temp = (data[0] << 8 | data[1]);
@@ -244,7 +270,10 @@ MPU6050_Res_t mpu6050_readall(MPU6050_t* mpu6050)
     int16_t temp;
     
     /* 전체 원시 데이터(14바이트) 읽기 */
+    if (i2c_bus_acquire(&mpu6050->dev, I2C_BUS_TIMEOUT) < 0)
+        return MPU6050_RES_ERR;
     i2c_nread(MPU6050_I2C, mpu6050->address, MPU6050_ACCEL_XOUT_H, data, 14);
+    i2c_bus_release(&mpu6050->dev);
     
     /* 가속도 값 구성 */
     mpu6050->acc_x = (int16_t)(data[0] << 8 | data[1]);    
@@ -99,11 +99,12 @@ AD0         -             핀이 low이면 I2C 주소는 0xD0, 핀이 high이면
 \verbatim
  - STM32F4xx HAL
  - I2C
+ - I2CBUS
 @endverbatim
  */
 
 #include "stm32f4xx_hal.h"
-#include "../stm32lib/i2c.h"
+#include "../stm32lib/i2cbus.h"
 
 /**
  * @defgroup MPU6050_매크로
@@ -202,6 +203,7 @@ typedef struct MPU6050_t {
 	uint8_t address;    /*!< I2C 장치 주소. 내부용 */
 	float gyro_mult;    /*!< 자이로스코프 범위 "degrees/s". 내부용 */
 	float acc_mult;     /*!< 가속도계 범위 "g". 내부용 */
+	I2C_Device_t dev;   /*!< 공유 I2C 버스에 등록된 장치. 내부용 */
 	/* Public */
 	int16_t acc_x;      /*!< 가속도계의 X축 값 */
 	int16_t acc_y;      /*!< 가속도계의 Y축 값 */
@@ -29206,7 +29206,7 @@ const GFXglyph NanumGothic13pt8bGlyphs[] PROGMEM = {
 const GFXFont_t NanumGothic13pt8b PROGMEM = {
   (uint8_t  *)NanumGothic13pt8bBitmaps,
   (GFXglyph *)NanumGothic13pt8bGlyphs,
-  0xAC00, 0xD7A3, 16 };
+  0xAC00, 0xD7A3, 16, NULL, 0 };
 
 Font_t NanumGothicFont_16x16 = {
     GFX_FONT,
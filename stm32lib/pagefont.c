@@ -0,0 +1,480 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ * 
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+/*
+ * 이 파일은 tools/pagefontgen.c 로 생성되었다. 직접 수정하지 말 것.
+ */
+#include "../stm32lib/pagefont.h"
+
+const uint8_t PageFont7x10 [] = {
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [ ]
+0x00,0x00,0x00,0xBF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [!]
+0x00,0x00,0x07,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = ["]
+0x00,0xF4,0x2F,0x24,0xF4,0x2F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [#]
+0x00,0x66,0x89,0xFF,0x89,0x72,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00, // Ascii = [$]
+0x00,0x26,0x19,0x6E,0x94,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [%]
+0x00,0x60,0x96,0x99,0x66,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [&]
+0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [']
+0x00,0x00,0xFC,0x02,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x02,0x00,0x00, // Ascii = [(]
+0x00,0x00,0x01,0x02,0xFC,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x00, // Ascii = [)]
+0x00,0x00,0x0A,0x07,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [*]
+0x00,0x10,0x10,0x7C,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [+]
+0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00, // Ascii = [,]
+0x00,0x00,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [-]
+0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [.]
+0x00,0x00,0xC0,0x3C,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [/]
+0x00,0x7E,0x81,0x89,0x81,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [0]
+0x00,0x04,0x02,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [1]
+0x00,0x86,0xC1,0xA1,0x91,0x8E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [2]
+0x00,0x42,0x81,0x89,0x89,0x76,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [3]
+0x00,0x30,0x2C,0x22,0xFF,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [4]
+0x00,0x4F,0x89,0x89,0x89,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [5]
+0x00,0x7E,0x89,0x89,0x89,0x72,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [6]
+0x00,0x01,0xE1,0x19,0x05,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [7]
+0x00,0x76,0x89,0x89,0x89,0x76,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [8]
+0x00,0x4E,0x91,0x91,0x91,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [9]
+0x00,0x00,0x00,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [:]
+0x00,0x00,0x00,0x88,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00, // Ascii = [;]
+0x00,0x10,0x28,0x28,0x44,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [<]
+0x00,0x28,0x28,0x28,0x28,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [=]
+0x00,0x44,0x44,0x28,0x28,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [>]
+0x00,0x02,0x01,0xB1,0x09,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [?]
+0x00,0x7E,0x81,0x99,0x95,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [@]
+0x00,0xE0,0x3E,0x21,0x3E,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [A]
+0x00,0xFF,0x89,0x89,0x89,0x76,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [B]
+0x00,0x7E,0x81,0x81,0x81,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [C]
+0x00,0xFF,0x81,0x81,0x42,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [D]
+0x00,0xFF,0x89,0x89,0x89,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [E]
+0x00,0xFF,0x09,0x09,0x09,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [F]
+0x00,0x7E,0x81,0x91,0x91,0x72,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [G]
+0x00,0xFF,0x08,0x08,0x08,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [H]
+0x00,0x00,0x81,0xFF,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [I]
+0x00,0x40,0x80,0x80,0x80,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [J]
+0x00,0xFF,0x08,0x14,0x62,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [K]
+0x00,0xFF,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [L]
+0x00,0xFF,0x06,0x08,0x06,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [M]
+0x00,0xFF,0x06,0x18,0x60,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [N]
+0x00,0x7E,0x81,0x81,0x81,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [O]
+0x00,0xFF,0x11,0x11,0x11,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [P]
+0x00,0x7E,0x81,0xC1,0x81,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00, // Ascii = [Q]
+0x00,0xFF,0x11,0x11,0x71,0x8E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [R]
+0x00,0x46,0x89,0x89,0x91,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [S]
+0x00,0x01,0x01,0xFF,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [T]
+0x00,0x7F,0x80,0x80,0x80,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [U]
+0x00,0x07,0x38,0xC0,0x38,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [V]
+0x00,0x3F,0xE0,0x1C,0xE0,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [W]
+0x00,0x81,0x66,0x18,0x66,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [X]
+0x00,0x03,0x0C,0xF0,0x0C,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [Y]
+0x00,0xC1,0xA1,0x99,0x85,0x83,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [Z]
+0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x02,0x00,0x00, // Ascii = [[]
+0x00,0x00,0x03,0x3C,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [\]
+0x00,0x00,0x01,0xFF,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x00,0x00, // Ascii = []]
+0x00,0x08,0x06,0x01,0x06,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [^]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x02,0x02,0x02,0x02,0x02, // Ascii = [_]
+0x00,0x00,0x01,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [`]
+0x00,0x68,0x94,0x94,0x54,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [a]
+0x00,0xFF,0x48,0x84,0x84,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [b]
+0x00,0x78,0x84,0x84,0x84,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [c]
+0x00,0x78,0x84,0x84,0x48,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [d]
+0x00,0x78,0x94,0x94,0x94,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [e]
+0x00,0x04,0x04,0xFE,0x05,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [f]
+0x00,0x78,0x84,0x84,0x48,0xFC,0x00,0x00,0x02,0x02,0x02,0x02,0x01,0x00, // Ascii = [g]
+0x00,0xFF,0x08,0x04,0x04,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [h]
+0x00,0x04,0x04,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [i]
+0x00,0x04,0x04,0xFD,0x00,0x00,0x00,0x02,0x02,0x02,0x01,0x00,0x00,0x00, // Ascii = [j]
+0x00,0xFF,0x10,0x28,0x44,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [k]
+0x00,0x01,0x01,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [l]
+0x00,0xFC,0x04,0xFC,0x04,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [m]
+0x00,0xFC,0x08,0x04,0x04,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [n]
+0x00,0x78,0x84,0x84,0x84,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [o]
+0x00,0xFC,0x48,0x84,0x84,0x78,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00, // Ascii = [p]
+0x00,0x78,0x84,0x84,0x48,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00, // Ascii = [q]
+0x00,0xFC,0x08,0x04,0x04,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [r]
+0x00,0x48,0x94,0x94,0xA4,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [s]
+0x00,0x04,0x7F,0x84,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [t]
+0x00,0x7C,0x80,0x80,0x40,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [u]
+0x00,0x0C,0x70,0x80,0x70,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [v]
+0x00,0x3C,0xE0,0x1C,0xE0,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [w]
+0x00,0x84,0x48,0x30,0x48,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [x]
+0x00,0x0C,0x30,0xC0,0x30,0x0C,0x00,0x00,0x02,0x02,0x01,0x00,0x00,0x00, // Ascii = [y]
+0x00,0xC4,0xA4,0x94,0x8C,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [z]
+0x00,0x00,0x30,0xCF,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x02,0x00,0x00, // Ascii = [{]
+0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00, // Ascii = [|]
+0x00,0x00,0x01,0xCF,0x30,0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x00,0x00, // Ascii = [}]
+0x00,0x18,0x08,0x08,0x10,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [~]
+};
+
+const uint8_t PageFont8x16 [] = {
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [ ]
+0x00,0x00,0x7C,0xFE,0xFE,0x7C,0x00,0x00,0x00,0x00,0x00,0x33,0x33,0x00,0x00,0x00, // Ascii = [!]
+0x00,0x1C,0x1C,0x00,0x00,0x1C,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = ["]
+0x10,0xFC,0xFC,0x10,0xFC,0xFC,0x10,0x00,0x04,0x1F,0x1F,0x04,0x1F,0x1F,0x04,0x00, // Ascii = [#]
+0x30,0x78,0x48,0xCE,0x8E,0xB8,0x30,0x00,0x06,0x0E,0x08,0x38,0x38,0x0F,0x07,0x00, // Ascii = [$]
+0x18,0x3C,0x24,0xBC,0xD8,0x60,0x30,0x00,0x0C,0x06,0x1B,0x3D,0x24,0x3C,0x18,0x00, // Ascii = [%]
+0x18,0xBC,0xE4,0xFC,0x18,0x00,0x00,0x00,0x0F,0x1F,0x10,0x13,0x0F,0x1C,0x12,0x00, // Ascii = [&]
+0x00,0x00,0x1C,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [']
+0x00,0xE0,0xF8,0x1C,0x04,0x00,0x00,0x00,0x00,0x03,0x0F,0x1C,0x10,0x00,0x00,0x00, // Ascii = [(]
+0x00,0x00,0x04,0x1C,0xF8,0xE0,0x00,0x00,0x00,0x00,0x10,0x1C,0x0F,0x03,0x00,0x00, // Ascii = [)]
+0x80,0xB0,0xF0,0xC0,0xF0,0xB0,0x80,0x00,0x00,0x06,0x07,0x01,0x07,0x06,0x00,0x00, // Ascii = [*]
+0x00,0x80,0x80,0xF8,0xF8,0x80,0x80,0x00,0x00,0x00,0x00,0x0F,0x0F,0x00,0x00,0x00, // Ascii = [+]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x58,0x78,0x38,0x00,0x00, // Ascii = [,]
+0x00,0x80,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [-]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x30,0x00,0x00, // Ascii = [.]
+0x00,0x00,0x80,0xE0,0x78,0x18,0x00,0x00,0x18,0x1E,0x07,0x01,0x00,0x00,0x00,0x00, // Ascii = [/]
+0xFC,0xFE,0x02,0x02,0xFE,0xFC,0x00,0x00,0x1F,0x3F,0x20,0x20,0x3F,0x1F,0x00,0x00, // Ascii = [0]
+0x00,0x10,0x18,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x3F,0x00,0x00,0x00, // Ascii = [1]
+0x18,0x1C,0x06,0x82,0xC6,0x7C,0x38,0x00,0x3C,0x3E,0x23,0x21,0x20,0x20,0x20,0x00, // Ascii = [2]
+0x18,0x1C,0x86,0x82,0xC6,0x7C,0x38,0x00,0x0C,0x1C,0x30,0x20,0x31,0x1F,0x0E,0x00, // Ascii = [3]
+0x00,0xE0,0xF8,0x18,0xFE,0xFE,0x00,0x00,0x0F,0x0F,0x08,0x08,0x3F,0x3F,0x08,0x00, // Ascii = [4]
+0x7E,0x7E,0x42,0x42,0xC2,0x82,0x02,0x00,0x18,0x18,0x20,0x20,0x30,0x1F,0x0F,0x00, // Ascii = [5]
+0xF8,0xFC,0x86,0x82,0x86,0x1C,0x18,0x00,0x0F,0x1F,0x31,0x20,0x31,0x1F,0x0E,0x00, // Ascii = [6]
+0x02,0x02,0x02,0xC2,0xF2,0x3E,0x0E,0x00,0x00,0x00,0x3F,0x3F,0x00,0x00,0x00,0x00, // Ascii = [7]
+0x38,0x7C,0xC6,0x82,0xC6,0x7C,0x38,0x00,0x0E,0x1F,0x31,0x20,0x31,0x1F,0x0E,0x00, // Ascii = [8]
+0x38,0x7C,0xC6,0x82,0xC6,0xFC,0xF8,0x00,0x0C,0x1C,0x30,0x20,0x30,0x1F,0x0F,0x00, // Ascii = [9]
+0x00,0x00,0x00,0x60,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x0C,0x00,0x00,0x00, // Ascii = [:]
+0x00,0x00,0x00,0x60,0x60,0x00,0x00,0x00,0x00,0x00,0x20,0x3C,0x1C,0x00,0x00,0x00, // Ascii = [;]
+0x00,0x00,0x00,0x80,0xC0,0x60,0x20,0x00,0x00,0x02,0x07,0x0D,0x18,0x30,0x20,0x00, // Ascii = [<]
+0x00,0x40,0x40,0x40,0x40,0x40,0x40,0x00,0x00,0x02,0x02,0x02,0x02,0x02,0x02,0x00, // Ascii = [=]
+0x00,0x20,0x60,0xC0,0x80,0x00,0x00,0x00,0x00,0x20,0x30,0x18,0x0D,0x07,0x02,0x00, // Ascii = [>]
+0x00,0x0C,0x0E,0x82,0xC2,0x7E,0x3C,0x00,0x00,0x00,0x00,0x33,0x33,0x00,0x00,0x00, // Ascii = [?]
+0xF8,0xFC,0xC4,0xE4,0x24,0xFC,0xF8,0x00,0x0F,0x1F,0x13,0x17,0x14,0x17,0x17,0x00, // Ascii = [@]
+0xE0,0xF8,0x1C,0x06,0x1C,0xF8,0xE0,0x00,0x3F,0x3F,0x01,0x01,0x01,0x3F,0x3F,0x00, // Ascii = [A]
+0xFE,0xFE,0x82,0x82,0xC6,0x7C,0x38,0x00,0x3F,0x3F,0x20,0x20,0x31,0x1F,0x0E,0x00, // Ascii = [B]
+0xF8,0xFC,0x06,0x02,0x06,0x1C,0x18,0x00,0x0F,0x1F,0x30,0x20,0x30,0x1C,0x0C,0x00, // Ascii = [C]
+0xFE,0xFE,0x02,0x02,0x06,0xFC,0xF8,0x00,0x3F,0x3F,0x20,0x20,0x30,0x1F,0x0F,0x00, // Ascii = [D]
+0xFE,0xFE,0x82,0x82,0x82,0x82,0x02,0x00,0x3F,0x3F,0x20,0x20,0x20,0x20,0x20,0x00, // Ascii = [E]
+0xFE,0xFE,0x82,0x82,0x82,0x82,0x02,0x00,0x3F,0x3F,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [F]
+0xF8,0xFC,0x06,0x02,0x06,0x1C,0x18,0x00,0x0F,0x1F,0x30,0x20,0x31,0x1F,0x0F,0x00, // Ascii = [G]
+0xFE,0xFE,0x80,0x80,0x80,0xFE,0xFE,0x00,0x3F,0x3F,0x00,0x00,0x00,0x3F,0x3F,0x00, // Ascii = [H]
+0x00,0x00,0x02,0xFE,0xFE,0x02,0x00,0x00,0x00,0x00,0x20,0x3F,0x3F,0x20,0x00,0x00, // Ascii = [I]
+0x00,0x00,0x00,0x00,0x00,0xFE,0xFE,0x00,0x1C,0x3C,0x20,0x20,0x20,0x3F,0x1F,0x00, // Ascii = [J]
+0xFE,0xFE,0xC0,0xE0,0x38,0x1E,0x06,0x00,0x3F,0x3F,0x00,0x01,0x07,0x3E,0x38,0x00, // Ascii = [K]
+0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x3F,0x20,0x20,0x20,0x20,0x20,0x00, // Ascii = [L]
+0xFE,0xFE,0x70,0xC0,0x70,0xFE,0xFE,0x00,0x3F,0x3F,0x00,0x01,0x00,0x3F,0x3F,0x00, // Ascii = [M]
+0xFE,0xFE,0x38,0xE0,0x00,0xFE,0xFE,0x00,0x3F,0x3F,0x00,0x01,0x07,0x3F,0x3F,0x00, // Ascii = [N]
+0xF8,0xFC,0x06,0x02,0x06,0xFC,0xF8,0x00,0x0F,0x1F,0x30,0x20,0x30,0x1F,0x0F,0x00, // Ascii = [O]
+0xFE,0xFE,0x82,0x82,0xC6,0x7C,0x38,0x00,0x3F,0x3F,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [P]
+0xF8,0xFC,0x06,0x02,0x06,0xFC,0xF8,0x00,0x0F,0x1F,0x30,0x28,0x30,0x7F,0x4F,0x00, // Ascii = [Q]
+0xFE,0xFE,0x82,0x82,0xC6,0x7C,0x38,0x00,0x3F,0x3F,0x00,0x00,0x01,0x3F,0x3E,0x00, // Ascii = [R]
+0x38,0x7C,0x46,0xC2,0x86,0x9C,0x18,0x00,0x0C,0x1C,0x30,0x20,0x30,0x1F,0x0F,0x00, // Ascii = [S]
+0x02,0x02,0x02,0xFE,0xFE,0x02,0x02,0x02,0x00,0x00,0x00,0x3F,0x3F,0x00,0x00,0x00, // Ascii = [T]
+0xFE,0xFE,0x00,0x00,0x00,0xFE,0xFE,0x00,0x1F,0x3F,0x20,0x20,0x20,0x3F,0x1F,0x00, // Ascii = [U]
+0xFE,0xFE,0x00,0x00,0x00,0xFE,0xFE,0x00,0x01,0x0F,0x1E,0x30,0x1E,0x0F,0x01,0x00, // Ascii = [V]
+0xFE,0xFE,0x00,0xE0,0x00,0xFE,0xFE,0x00,0x3F,0x3F,0x07,0x01,0x07,0x3F,0x3F,0x00, // Ascii = [W]
+0x1E,0x3E,0x60,0x80,0x60,0x3E,0x1E,0x00,0x3C,0x3E,0x03,0x00,0x03,0x3E,0x3C,0x00, // Ascii = [X]
+0x00,0x3E,0x7E,0xC0,0xC0,0x7E,0x3E,0x00,0x00,0x00,0x00,0x3F,0x3F,0x00,0x00,0x00, // Ascii = [Y]
+0x02,0x02,0x82,0xE2,0x7A,0x1E,0x06,0x00,0x38,0x3E,0x27,0x21,0x20,0x20,0x20,0x00, // Ascii = [Z]
+0x00,0x00,0xFC,0xFC,0x04,0x04,0x00,0x00,0x00,0x00,0x1F,0x1F,0x10,0x10,0x00,0x00, // Ascii = [[]
+0xFC,0xFC,0x40,0xF0,0x40,0xFC,0xFC,0x40,0x01,0x1F,0x1E,0x01,0x1E,0x1F,0x01,0x00, // Ascii = [\]
+0x00,0x00,0x04,0x04,0xFC,0xFC,0x00,0x00,0x00,0x00,0x10,0x10,0x1F,0x1F,0x00,0x00, // Ascii = []]
+0x00,0x10,0x18,0x0C,0x0C,0x18,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [^]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40, // Ascii = [_]
+0x00,0x00,0x04,0x0C,0x1C,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [`]
+0x00,0x40,0x60,0x20,0x20,0xE0,0xC0,0x00,0x00,0x1C,0x3E,0x22,0x22,0x3F,0x3F,0x00, // Ascii = [a]
+0x00,0xF8,0xF8,0x80,0x80,0x80,0x00,0x00,0x00,0x3F,0x3F,0x20,0x20,0x3F,0x1F,0x00, // Ascii = [b]
+0x00,0xC0,0xE0,0x20,0x20,0x60,0x40,0x00,0x00,0x1F,0x3F,0x20,0x20,0x30,0x10,0x00, // Ascii = [c]
+0x00,0x00,0x80,0x80,0x80,0xF8,0xF8,0x00,0x00,0x1F,0x3F,0x20,0x20,0x3F,0x3F,0x00, // Ascii = [d]
+0x00,0xC0,0xE0,0x20,0x20,0xE0,0xC0,0x00,0x00,0x1F,0x3F,0x22,0x22,0x23,0x13,0x00, // Ascii = [e]
+0x00,0x80,0xF0,0xF8,0x88,0x88,0x88,0x00,0x00,0x00,0x3F,0x3F,0x00,0x00,0x00,0x00, // Ascii = [f]
+0x00,0xE0,0xF0,0x10,0x10,0xF0,0xF0,0x00,0x00,0x43,0x47,0x44,0x44,0x7F,0x3F,0x00, // Ascii = [g]
+0x00,0xF8,0xF8,0x80,0x80,0x80,0x00,0x00,0x00,0x3F,0x3F,0x00,0x00,0x3F,0x3F,0x00, // Ascii = [h]
+0x00,0x40,0x40,0xCC,0xCC,0x00,0x00,0x00,0x00,0x20,0x20,0x3F,0x3F,0x20,0x20,0x00, // Ascii = [i]
+0x00,0x00,0x20,0x20,0xEC,0xEC,0x00,0x00,0x00,0x40,0x40,0x40,0x7F,0x3F,0x00,0x00, // Ascii = [j]
+0x00,0xF8,0xF8,0x00,0x00,0xC0,0xC0,0x00,0x00,0x3F,0x3F,0x06,0x0F,0x39,0x30,0x00, // Ascii = [k]
+0x00,0x08,0x08,0xF8,0xF8,0x00,0x00,0x00,0x00,0x20,0x20,0x3F,0x3F,0x20,0x20,0x00, // Ascii = [l]
+0x00,0xE0,0xE0,0x20,0xE0,0x20,0xE0,0xC0,0x00,0x3F,0x3F,0x00,0x1F,0x00,0x3F,0x3F, // Ascii = [m]
+0x00,0xE0,0xE0,0x20,0x20,0xE0,0xC0,0x00,0x00,0x3F,0x3F,0x00,0x00,0x3F,0x3F,0x00, // Ascii = [n]
+0x00,0xC0,0xE0,0x20,0x20,0xE0,0xC0,0x00,0x00,0x1F,0x3F,0x20,0x20,0x3F,0x1F,0x00, // Ascii = [o]
+0x00,0xE0,0xE0,0x20,0x20,0xE0,0xC0,0x00,0x00,0x7F,0x7F,0x04,0x04,0x07,0x03,0x00, // Ascii = [p]
+0x00,0xC0,0xE0,0x20,0x20,0xE0,0xE0,0x00,0x00,0x03,0x07,0x04,0x04,0x7F,0x7F,0x00, // Ascii = [q]
+0x00,0xE0,0xE0,0x80,0x40,0x60,0x60,0x00,0x00,0x3F,0x3F,0x00,0x00,0x00,0x00,0x00, // Ascii = [r]
+0x00,0xC0,0xE0,0x20,0x20,0x20,0x20,0x00,0x00,0x21,0x23,0x22,0x22,0x3E,0x1C,0x00, // Ascii = [s]
+0x00,0x20,0xF8,0xF8,0x20,0x20,0x20,0x00,0x00,0x00,0x1F,0x3F,0x20,0x20,0x20,0x00, // Ascii = [t]
+0x00,0xE0,0xE0,0x00,0x00,0xE0,0xE0,0x00,0x00,0x1F,0x3F,0x20,0x20,0x3F,0x3F,0x00, // Ascii = [u]
+0x00,0xE0,0xE0,0x00,0x00,0xE0,0xE0,0x00,0x00,0x0F,0x1F,0x30,0x30,0x1F,0x0F,0x00, // Ascii = [v]
+0x00,0xE0,0xE0,0x00,0xC0,0x00,0xE0,0xE0,0x00,0x07,0x3F,0x38,0x07,0x38,0x3F,0x07, // Ascii = [w]
+0x00,0xE0,0xE0,0x00,0x00,0xE0,0xE0,0x00,0x00,0x38,0x3D,0x07,0x07,0x3D,0x38,0x00, // Ascii = [x]
+0x00,0xE0,0xE0,0x00,0x00,0xE0,0xE0,0x00,0x40,0x47,0x4F,0x68,0x38,0x1F,0x07,0x00, // Ascii = [y]
+0x00,0x20,0x20,0x20,0x20,0xE0,0xE0,0x00,0x00,0x38,0x3C,0x26,0x23,0x21,0x20,0x00, // Ascii = [z]
+0x00,0x00,0x80,0xF0,0x78,0x08,0x00,0x00,0x00,0x01,0x03,0x1E,0x3C,0x20,0x00,0x00, // Ascii = [{]
+0x00,0x00,0x00,0xFC,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x3F,0x00,0x00,0x00, // Ascii = [|]
+0x00,0x00,0x08,0x78,0xF0,0x80,0x00,0x00,0x00,0x00,0x20,0x3C,0x1E,0x03,0x01,0x00, // Ascii = [}]
+0x0C,0x06,0x02,0x06,0x0C,0x08,0x0C,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [~]
+};
+
+const uint8_t PageFont11x18 [] = {
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [ ]
+0x00,0x00,0x00,0x00,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6F,0x6F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [!]
+0x00,0x00,0x00,0x3E,0x3E,0x00,0x3E,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = ["]
+0x00,0x60,0x60,0xFE,0xFE,0x60,0x60,0xFE,0xFE,0x60,0x00,0x00,0x06,0x7F,0x7F,0x06,0x06,0x7F,0x7F,0x06,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [#]
+0x00,0x38,0x7C,0xEE,0xC6,0xFE,0x86,0x1C,0x18,0x00,0x00,0x00,0x1C,0x3C,0x70,0x60,0xFF,0x61,0x3F,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00, // Ascii = [$]
+0x3C,0x7E,0x42,0x7E,0x3C,0x80,0xC0,0x60,0x30,0x18,0x00,0x00,0x18,0x0C,0x06,0x03,0x3D,0x7E,0x42,0x7E,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [%]
+0x00,0x00,0x3C,0x7E,0xC6,0xC6,0x7E,0x3C,0x00,0x00,0x00,0x00,0x1E,0x3F,0x61,0x61,0x63,0x36,0x1C,0x7F,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [&]
+0x00,0x00,0x00,0x00,0x3E,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [']
+0x00,0x00,0x00,0x00,0xC0,0xF8,0x1C,0x06,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x7F,0xE0,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x02,0x00,0x00, // Ascii = [(]
+0x00,0x00,0x01,0x06,0x1C,0xF8,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xE0,0x7F,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [)]
+0x00,0x00,0x2C,0x38,0x1E,0x1E,0x38,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [*]
+0x80,0x80,0x80,0x80,0xF8,0xF8,0x80,0x80,0x80,0x80,0x00,0x01,0x01,0x01,0x01,0x1F,0x1F,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [+]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x00,0x00,0x00, // Ascii = [,]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x06,0x06,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [-]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [.]
+0x00,0x00,0x00,0x00,0x00,0xF0,0xFE,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x7F,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [/]
+0x00,0xF0,0xFC,0x0E,0x86,0x86,0x0E,0xFC,0xF0,0x00,0x00,0x00,0x0F,0x3F,0x70,0x61,0x61,0x70,0x3F,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [0]
+0x00,0x00,0x30,0x18,0x0C,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [1]
+0x00,0x38,0x3C,0x0E,0x06,0x06,0x8E,0xFC,0x78,0x00,0x00,0x00,0x70,0x78,0x6C,0x66,0x63,0x61,0x60,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [2]
+0x00,0x18,0x1C,0x06,0xC6,0xC6,0xFC,0x38,0x00,0x00,0x00,0x00,0x18,0x38,0x70,0x60,0x60,0x71,0x3F,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [3]
+0x00,0x00,0x80,0xF0,0x3C,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x0E,0x0F,0x0D,0x0C,0x7F,0x7F,0x0C,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [4]
+0x00,0xFE,0xFE,0x86,0xC6,0xC6,0xC6,0x86,0x00,0x00,0x00,0x00,0x19,0x39,0x70,0x60,0x60,0x71,0x3F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [5]
+0x00,0xF0,0xFC,0x8E,0xC6,0xC6,0xCE,0x9C,0x18,0x00,0x00,0x00,0x0F,0x3F,0x71,0x60,0x60,0x71,0x3F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [6]
+0x00,0x06,0x06,0x06,0x06,0xC6,0xF6,0x3E,0x0E,0x00,0x00,0x00,0x00,0x00,0x70,0x7F,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [7]
+0x00,0x38,0x7C,0x86,0x86,0x86,0x8E,0x7C,0x38,0x00,0x00,0x00,0x1E,0x3F,0x61,0x61,0x61,0x61,0x3F,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [8]
+0x00,0xF8,0xFC,0x8E,0x06,0x06,0x8E,0xFC,0xF0,0x00,0x00,0x00,0x18,0x39,0x73,0x63,0x63,0x71,0x3F,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [9]
+0x00,0x00,0x00,0x00,0x60,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [:]
+0x00,0x00,0x00,0x00,0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x00,0x00,0x00, // Ascii = [;]
+0x00,0x00,0x80,0x80,0xC0,0x40,0x60,0x20,0x30,0x00,0x00,0x00,0x01,0x03,0x02,0x06,0x04,0x0C,0x08,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [<]
+0x00,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x00,0x00,0x00,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [=]
+0x00,0x30,0x20,0x60,0x40,0xC0,0x80,0x80,0x00,0x00,0x00,0x00,0x18,0x08,0x0C,0x04,0x06,0x02,0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [>]
+0x00,0x18,0x1C,0x0E,0x06,0x06,0x86,0xCE,0xFC,0x78,0x00,0x00,0x00,0x00,0x00,0x6E,0x6F,0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [?]
+0x00,0xF0,0xFC,0x1E,0xC6,0xC6,0x66,0xFC,0xF8,0x00,0x00,0x00,0x0F,0x3F,0x70,0x63,0x67,0x36,0x07,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [@]
+0x00,0x00,0x80,0xF8,0x7E,0x06,0x7E,0xF8,0x80,0x00,0x00,0x00,0x70,0x7F,0x0F,0x06,0x06,0x06,0x0F,0x7F,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [A]
+0x00,0xFE,0xFE,0x86,0x86,0x86,0xFC,0x78,0x00,0x00,0x00,0x00,0x7F,0x7F,0x61,0x61,0x61,0x73,0x3E,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [B]
+0x00,0xF0,0xFC,0x0E,0x06,0x06,0x06,0x1C,0x18,0x00,0x00,0x00,0x0F,0x3F,0x70,0x60,0x60,0x60,0x38,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [C]
+0x00,0xFE,0xFE,0x06,0x06,0x06,0x1C,0xFC,0xF0,0x00,0x00,0x00,0x7F,0x7F,0x60,0x60,0x60,0x38,0x1F,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [D]
+0x00,0xFE,0xFE,0x86,0x86,0x86,0x86,0x86,0x06,0x00,0x00,0x00,0x7F,0x7F,0x61,0x61,0x61,0x61,0x61,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [E]
+0x00,0xFE,0xFE,0x86,0x86,0x86,0x86,0x86,0x06,0x00,0x00,0x00,0x7F,0x7F,0x01,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [F]
+0x00,0xF0,0xFC,0x0E,0x06,0x06,0x06,0x1C,0x18,0x00,0x00,0x00,0x0F,0x3F,0x70,0x60,0x60,0x63,0x3F,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [G]
+0x00,0xFE,0xFE,0x80,0x80,0x80,0x80,0xFE,0xFE,0x00,0x00,0x00,0x7F,0x7F,0x01,0x01,0x01,0x01,0x7F,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [H]
+0x00,0x00,0x06,0x06,0xFE,0xFE,0x06,0x06,0x00,0x00,0x00,0x00,0x00,0x60,0x60,0x7F,0x7F,0x60,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [I]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xFE,0x00,0x00,0x00,0x1C,0x3C,0x70,0x60,0x60,0x70,0x3F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [J]
+0x00,0xFE,0xFE,0x80,0xC0,0x70,0x38,0x0C,0x06,0x02,0x00,0x00,0x7F,0x7F,0x01,0x01,0x07,0x0E,0x38,0x70,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [K]
+0x00,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x7F,0x60,0x60,0x60,0x60,0x60,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [L]
+0x00,0xFE,0xFE,0x1E,0xF8,0x80,0xF8,0x0E,0xFE,0xFE,0x00,0x00,0x7F,0x7F,0x00,0x00,0x01,0x00,0x00,0x7F,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [M]
+0x00,0xFE,0xFE,0x3E,0xF8,0xC0,0x00,0xFE,0xFE,0x00,0x00,0x00,0x7F,0x7F,0x00,0x01,0x1F,0x7C,0x7F,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [N]
+0x00,0xF0,0xFC,0x0E,0x06,0x06,0x0E,0xFC,0xF0,0x00,0x00,0x00,0x0F,0x3F,0x70,0x60,0x60,0x70,0x3F,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [O]
+0x00,0xFE,0xFE,0x06,0x06,0x06,0x8E,0xFC,0xF8,0x00,0x00,0x00,0x7F,0x7F,0x03,0x03,0x03,0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [P]
+0x00,0xF0,0xFC,0x0E,0x06,0x06,0x0E,0xFC,0xF0,0x00,0x00,0x00,0x0F,0x3F,0x70,0x60,0x6C,0x78,0x3F,0x2F,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [Q]
+0x00,0xFE,0xFE,0x86,0x86,0x86,0xCE,0xFC,0x78,0x00,0x00,0x00,0x7F,0x7F,0x01,0x01,0x03,0x0F,0x3C,0x70,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [R]
+0x00,0x00,0x78,0xFC,0xC6,0x86,0x86,0x1C,0x18,0x00,0x00,0x00,0x0C,0x3C,0x70,0x60,0x61,0x63,0x3F,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [S]
+0x06,0x06,0x06,0x06,0xFE,0xFE,0x06,0x06,0x06,0x06,0x00,0x00,0x00,0x00,0x00,0x7F,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [T]
+0x00,0xFE,0xFE,0x00,0x00,0x00,0x00,0xFE,0xFE,0x00,0x00,0x00,0x1F,0x3F,0x70,0x60,0x60,0x70,0x3F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [U]
+0x00,0x0E,0x7E,0xF0,0x80,0x00,0x80,0xF0,0x7E,0x0E,0x00,0x00,0x00,0x00,0x07,0x3F,0x78,0x3F,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [V]
+0x7E,0xFE,0x00,0x00,0xC0,0xC0,0x00,0x00,0xFE,0x7E,0x00,0x00,0x7F,0x70,0x1E,0x03,0x03,0x1E,0x70,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [W]
+0x02,0x0E,0x3C,0x70,0xE0,0xC0,0x70,0x38,0x0E,0x02,0x00,0x40,0x70,0x38,0x1E,0x0F,0x07,0x0E,0x3C,0x70,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [X]
+0x02,0x0E,0x3C,0xF0,0xC0,0xC0,0xF0,0x3C,0x0E,0x02,0x00,0x00,0x00,0x00,0x00,0x7F,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [Y]
+0x00,0x00,0x06,0x06,0x86,0xC6,0x76,0x3E,0x0E,0x00,0x00,0x00,0x70,0x78,0x6E,0x67,0x61,0x60,0x60,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [Z]
+0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x03,0x00,0x00,0x00, // Ascii = [[]
+0x00,0x00,0x00,0x0E,0xFE,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x7F,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [\]
+0x00,0x00,0x00,0x03,0x03,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x03,0x00,0x00,0x00,0x00, // Ascii = []]
+0x00,0x80,0xE0,0x78,0x0E,0x0E,0x78,0xE0,0x80,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [^]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01, // Ascii = [_]
+0x00,0x00,0x02,0x06,0x0E,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [`]
+0x00,0x80,0xC0,0x60,0x60,0x60,0x60,0xE0,0xC0,0x00,0x00,0x00,0x38,0x7C,0x66,0x66,0x26,0x36,0x3F,0x7F,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [a]
+0x00,0xFE,0xFE,0xC0,0x60,0x60,0xE0,0xC0,0x80,0x00,0x00,0x00,0x7F,0x7F,0x30,0x60,0x60,0x70,0x3F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [b]
+0x00,0x80,0xC0,0xE0,0x60,0x60,0xE0,0xC0,0x80,0x00,0x00,0x00,0x1F,0x3F,0x70,0x60,0x60,0x70,0x39,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [c]
+0x00,0x80,0xC0,0xE0,0x60,0x60,0xC0,0xFE,0xFE,0x00,0x00,0x00,0x1F,0x3F,0x70,0x60,0x60,0x30,0x7F,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [d]
+0x00,0x80,0xC0,0xE0,0x60,0x60,0xE0,0xC0,0x00,0x00,0x00,0x00,0x1F,0x3F,0x76,0x66,0x66,0x66,0x37,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [e]
+0x00,0x60,0x60,0x60,0xFC,0xFE,0x66,0x66,0x66,0x06,0x00,0x00,0x00,0x00,0x00,0x7F,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [f]
+0x00,0xC0,0xE0,0x70,0x30,0x30,0x60,0xF0,0xF0,0x00,0x00,0x00,0x8F,0x9F,0x38,0x30,0x30,0x98,0xFF,0xFF,0x00,0x00,0x00,0x01,0x03,0x03,0x03,0x03,0x03,0x01,0x00,0x00,0x00, // Ascii = [g]
+0x00,0xFE,0xFE,0xC0,0x60,0x60,0x60,0xE0,0xC0,0x00,0x00,0x00,0x7F,0x7F,0x00,0x00,0x00,0x00,0x7F,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [h]
+0x00,0x00,0x60,0x60,0x60,0xE6,0xE6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [i]
+0x00,0x00,0x30,0x30,0x30,0xF3,0xF3,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x03,0x03,0x03,0x01,0x00,0x00,0x00,0x00, // Ascii = [j]
+0x00,0xFE,0xFE,0x00,0x00,0x80,0xC0,0x60,0x20,0x00,0x00,0x00,0x7F,0x7F,0x06,0x03,0x07,0x1C,0x38,0x60,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [k]
+0x00,0x00,0x06,0x06,0x06,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [l]
+0xE0,0xE0,0x40,0x60,0xE0,0xE0,0xC0,0x60,0xE0,0xC0,0x00,0x7F,0x7F,0x00,0x00,0x7F,0x7F,0x00,0x00,0x7F,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [m]
+0x00,0xE0,0xE0,0xC0,0x60,0x60,0x60,0xE0,0xC0,0x00,0x00,0x00,0x7F,0x7F,0x00,0x00,0x00,0x00,0x7F,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [n]
+0x00,0x80,0xC0,0xE0,0x60,0x60,0xE0,0xC0,0x80,0x00,0x00,0x00,0x1F,0x3F,0x70,0x60,0x60,0x70,0x3F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [o]
+0x00,0xF0,0xF0,0x60,0x30,0x30,0x70,0xE0,0xC0,0x00,0x00,0x00,0xFF,0xFF,0x18,0x30,0x30,0x38,0x1F,0x0F,0x00,0x00,0x00,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [p]
+0x00,0xC0,0xE0,0x70,0x30,0x30,0x60,0xF0,0xF0,0x00,0x00,0x00,0x0F,0x1F,0x38,0x30,0x30,0x18,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x00,0x00, // Ascii = [q]
+0x00,0x20,0xE0,0xC0,0xC0,0x60,0x60,0xE0,0x40,0x00,0x00,0x00,0x00,0x7F,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [r]
+0x00,0x80,0xC0,0x60,0x60,0x60,0x60,0xC0,0xC0,0x00,0x00,0x00,0x33,0x37,0x66,0x66,0x66,0x66,0x3E,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [s]
+0x00,0x60,0x60,0xF8,0xFC,0x60,0x60,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x7F,0x60,0x60,0x60,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [t]
+0x00,0xE0,0xE0,0x00,0x00,0x00,0x00,0xE0,0xE0,0x00,0x00,0x00,0x3F,0x7F,0x60,0x60,0x60,0x30,0x7F,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [u]
+0x00,0x20,0xE0,0xC0,0x00,0x00,0x00,0xC0,0xE0,0x20,0x00,0x00,0x00,0x01,0x0F,0x3E,0x70,0x7E,0x0F,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [v]
+0xE0,0xE0,0x00,0xE0,0xE0,0xE0,0x00,0xE0,0xE0,0x00,0x00,0x00,0x1F,0x78,0x1F,0x00,0x1F,0x78,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [w]
+0x00,0x20,0xE0,0xC0,0x00,0x00,0xC0,0xE0,0x20,0x00,0x00,0x00,0x40,0x70,0x39,0x0F,0x0F,0x39,0x70,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [x]
+0x00,0x30,0xF0,0xC0,0x00,0x00,0x80,0xF0,0x70,0x00,0x00,0x00,0x00,0x01,0x8F,0xFE,0xF0,0x7F,0x0F,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x01,0x01,0x00,0x00,0x00,0x00,0x00, // Ascii = [y]
+0x00,0x60,0x60,0x60,0x60,0x60,0x60,0xE0,0xE0,0x60,0x00,0x00,0x60,0x70,0x78,0x6C,0x66,0x63,0x61,0x60,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [z]
+0x00,0x00,0x00,0x00,0x80,0xFE,0xFF,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x03,0x07,0xFF,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x03,0x03,0x00,0x00, // Ascii = [{]
+0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x00,0x00,0x00,0x00, // Ascii = [|]
+0x00,0x00,0x03,0x03,0xFF,0xFE,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xFF,0x07,0x03,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x01,0x00,0x00,0x00,0x00,0x00, // Ascii = [}]
+0x00,0x00,0x80,0x80,0x80,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x03,0x01,0x01,0x01,0x03,0x03,0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [~]
+};
+
+const uint8_t PageFont16x26 [] = {
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [ ]
+0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x7F,0x7F,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x1C,0x1C,0x1C,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [!]
+0x00,0x00,0x00,0x7F,0x7F,0x7F,0x7F,0x00,0x00,0x00,0x7F,0x7F,0x7F,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = ["]
+0x00,0x80,0xC0,0xC0,0xC0,0xE0,0xFE,0xFF,0xFF,0xC7,0xC0,0xFC,0xFF,0xFF,0xCF,0xC0,0x60,0x60,0x60,0xE0,0xFE,0xFF,0xFF,0x6F,0xE0,0xFC,0xFF,0xFF,0x7F,0x60,0x60,0x60,0x00,0x00,0x1C,0x1F,0x1F,0x0F,0x00,0x18,0x1F,0x1F,0x1F,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [#]
+0x00,0x00,0x00,0xFC,0xFE,0xFE,0xFF,0x87,0xFF,0xFF,0xFF,0x03,0x07,0x07,0x06,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x07,0xFF,0xFF,0xFF,0xFF,0xFC,0xF8,0xF8,0xF0,0x00,0x00,0x00,0x0C,0x0C,0x1C,0x1C,0x18,0x7F,0x7F,0x7F,0x7F,0x1F,0x0F,0x0F,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [$]
+0xFE,0xFE,0xFF,0x03,0x01,0xCF,0xFF,0xFE,0xFC,0x80,0xE0,0xF0,0xFC,0x3E,0x1F,0x07,0x01,0x01,0x03,0x83,0xC2,0xF3,0xFB,0x7F,0xFF,0xFF,0xFB,0xF9,0x18,0x18,0xF8,0xF8,0x18,0x1C,0x1F,0x0F,0x07,0x01,0x00,0x00,0x07,0x0F,0x1F,0x1F,0x18,0x18,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [%]
+0x00,0x00,0x00,0x38,0xFE,0xFF,0xFF,0xFF,0x83,0xFF,0xFF,0xFE,0x7E,0x00,0x00,0x00,0xF8,0xFC,0xFC,0xFE,0x0F,0x07,0x1F,0x3F,0xFF,0xFD,0xF1,0xE0,0x80,0xF0,0xFC,0xFC,0x03,0x07,0x0F,0x1F,0x1E,0x1C,0x18,0x18,0x18,0x1D,0x1F,0x0F,0x1F,0x1F,0x1F,0x1D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [&]
+0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x7F,0x7F,0x7F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [']
+0x00,0x00,0x00,0x00,0x00,0xE0,0xF0,0xFC,0xFC,0x3E,0x0F,0x07,0x03,0x03,0x01,0x01,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x0F,0x3F,0x3F,0x7C,0xF0,0xE0,0xC0,0xC0,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01, // Ascii = [(]
+0x00,0x01,0x01,0x03,0x03,0x07,0x0F,0x3E,0xFC,0xFC,0xF0,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x80,0x80,0xC0,0xC0,0xE0,0xF0,0x7C,0x3F,0x3F,0x0F,0x07,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [)]
+0x00,0x00,0x38,0x38,0x38,0x30,0xF3,0xFF,0x1F,0xBF,0xF1,0xB0,0x38,0x38,0x38,0x30,0x00,0x00,0x00,0x04,0x06,0x0F,0x0F,0x07,0x01,0x03,0x0F,0x0F,0x0F,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [*]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0xFF,0xFF,0xFF,0x60,0x60,0x60,0x60,0x60,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [+]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0xFE,0xFE,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [,]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [-]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x1E,0x1E,0x1E,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [.]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xF0,0xFC,0xFF,0x3F,0x0F,0x03,0x00,0x00,0x00,0x00,0x00,0xC0,0xF0,0xFC,0xFF,0x3F,0x0F,0x03,0x00,0x00,0x00,0x00,0x00,0xC0,0xF0,0xFC,0xFF,0x3F,0x0F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [/]
+0x00,0xE0,0xF8,0xFC,0xFE,0x7F,0x0F,0x07,0x03,0x07,0x0F,0x7F,0xFE,0xFC,0xF8,0xE0,0x00,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0xC0,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x03,0x07,0x0F,0x1F,0x1E,0x1C,0x18,0x1C,0x1E,0x1F,0x0F,0x07,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [0]
+0x00,0x00,0x0C,0x0C,0x0C,0x0E,0x0E,0xFE,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x18,0x18,0x18,0x18,0x1F,0x1F,0x1F,0x1F,0x1F,0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [1]
+0x00,0x00,0x06,0x06,0x07,0x07,0x03,0x03,0x03,0x07,0xFF,0xFE,0xFE,0xFC,0x70,0x00,0x00,0x00,0x00,0x00,0x80,0xE0,0xF0,0xF8,0x7C,0x3E,0x1F,0x0F,0x07,0x03,0x00,0x00,0x00,0x00,0x1E,0x1F,0x1F,0x1F,0x1B,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [2]
+0x00,0x00,0x00,0x06,0x07,0x07,0x03,0x03,0x03,0x07,0xFF,0xFF,0xFE,0xFC,0x38,0x00,0x00,0x00,0x00,0x00,0x06,0x06,0x06,0x06,0x07,0x0F,0x1F,0xFF,0xFD,0xF8,0xF0,0x00,0x00,0x00,0x00,0x1C,0x1C,0x1C,0x18,0x18,0x18,0x1C,0x1E,0x0F,0x0F,0x07,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [3]
+0x00,0x00,0x00,0x00,0x80,0xE0,0xF0,0xF8,0x7E,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x60,0x78,0x7C,0x7F,0x7F,0x67,0x63,0x60,0x60,0xFF,0xFF,0xFF,0xFF,0x60,0x60,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [4]
+0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x03,0x03,0x07,0x0F,0xBF,0xFE,0xFE,0xFC,0xF0,0x00,0x00,0x00,0x00,0x1C,0x1C,0x1C,0x18,0x18,0x18,0x1C,0x1F,0x0F,0x0F,0x07,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [5]
+0x00,0x00,0xE0,0xF8,0xFC,0xFE,0x3E,0x0F,0x07,0x03,0x03,0x03,0x07,0x07,0x06,0x00,0x00,0x0C,0xFF,0xFF,0xFF,0xFF,0x0E,0x07,0x03,0x03,0x07,0x0F,0xFF,0xFE,0xFC,0xF8,0x00,0x00,0x01,0x07,0x0F,0x0F,0x1F,0x1C,0x18,0x18,0x1C,0x1E,0x0F,0x0F,0x07,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [6]
+0x00,0x00,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xC7,0xF7,0xFF,0x7F,0x3F,0x0F,0x00,0x00,0x00,0x00,0x00,0x80,0xE0,0xF8,0xFE,0x7F,0x1F,0x07,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x1F,0x1F,0x1F,0x1F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [7]
+0x00,0x00,0x30,0xFC,0xFE,0xFF,0xFF,0x87,0x03,0x03,0x87,0xFF,0xFF,0xFE,0x7C,0x00,0x00,0xC0,0xF0,0xF8,0xFD,0xFF,0x1F,0x07,0x0F,0x0F,0x1F,0x7F,0xFD,0xF8,0xF0,0xE0,0x00,0x01,0x07,0x0F,0x0F,0x1F,0x1C,0x1C,0x18,0x18,0x1C,0x1E,0x0F,0x0F,0x07,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [8]
+0x00,0xE0,0xF8,0xFC,0xFE,0xFF,0x07,0x03,0x03,0x07,0x0F,0xFF,0xFE,0xFC,0xF8,0xE0,0x00,0x01,0x07,0x0F,0x0F,0x1F,0x1C,0x18,0x18,0x18,0x1C,0xEF,0xFF,0xFF,0xFF,0x3F,0x00,0x00,0x0C,0x1C,0x1C,0x18,0x18,0x18,0x1C,0x1C,0x1F,0x0F,0x07,0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [9]
+0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x1E,0x1E,0x1E,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [:]
+0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0xFE,0xFE,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [;]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0xC0,0xC0,0x20,0x20,0x70,0x70,0xF8,0xF8,0xFC,0xDC,0x8E,0x8E,0x07,0x07,0x03,0x03,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x03,0x03,0x07,0x07,0x0E,0x0E,0x1C,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [<]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x8C,0x8C,0x8C,0x8C,0x8C,0x8C,0x8C,0x8C,0x8C,0x8C,0x8C,0x8C,0x8C,0x8C,0x8C,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [=]
+0xC0,0xC0,0xC0,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x03,0x03,0x07,0x07,0x8E,0x8E,0xDC,0xDC,0xF8,0xF8,0x70,0x70,0x20,0x18,0x1C,0x1C,0x0E,0x0E,0x07,0x07,0x03,0x03,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [>]
+0x00,0x00,0x1E,0x1F,0x1F,0x03,0x03,0x03,0x03,0x03,0x87,0xFF,0xFE,0xFE,0x7C,0x18,0x00,0x00,0x00,0x00,0x00,0x60,0x78,0x7C,0x7E,0x7F,0x07,0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x1C,0x1C,0x1C,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [?]
+0x00,0xE0,0xF8,0xFC,0x7E,0x1E,0x8F,0xC7,0xE3,0xF3,0x73,0x37,0x7F,0xFE,0xFE,0xF8,0x3F,0xFF,0xFF,0xFF,0x80,0x00,0xFF,0xFF,0xFF,0xC1,0xC0,0xF0,0xFE,0xFF,0xFF,0xFF,0x00,0x01,0x03,0x07,0x0F,0x0E,0x1C,0x1D,0x19,0x19,0x19,0x1D,0x1C,0x0D,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [@]
+0x00,0x00,0x00,0x00,0x00,0xE0,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xF8,0xFF,0xFF,0xDF,0xC3,0xC0,0xC7,0xFF,0xFF,0xFF,0xFC,0xE0,0x80,0x1C,0x1F,0x1F,0x1F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x07,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [A]
+0x00,0x00,0xF8,0xF8,0xF8,0xF8,0x18,0x18,0x18,0x18,0x38,0xF8,0xF8,0xF0,0xE0,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x18,0x18,0x18,0x3C,0x3E,0xFF,0xF7,0xE7,0xE3,0xC0,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x18,0x18,0x18,0x18,0x18,0x1C,0x1F,0x0F,0x0F,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [B]
+0x00,0x00,0xC0,0xE0,0xE0,0xF0,0x70,0x38,0x38,0x18,0x18,0x18,0x18,0x38,0x38,0x38,0x00,0xFF,0xFF,0xFF,0xFF,0xC1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x07,0x07,0x0F,0x0F,0x1E,0x1C,0x18,0x18,0x18,0x18,0x18,0x1C,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [C]
+0x00,0xF8,0xF8,0xF8,0xF8,0x18,0x18,0x18,0x18,0x38,0x38,0xF8,0xF0,0xF0,0xE0,0xC0,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x1F,0x1F,0x1F,0x1F,0x18,0x18,0x18,0x18,0x1C,0x1C,0x0F,0x0F,0x07,0x07,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [D]
+0x00,0x00,0xF8,0xF8,0xF8,0xF8,0xF8,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x1F,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [E]
+0x00,0x00,0x00,0xF8,0xF8,0xF8,0xF8,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [F]
+0x00,0x80,0xC0,0xE0,0xF0,0xF0,0x78,0x38,0x38,0x18,0x18,0x18,0x18,0x38,0x38,0x30,0x3C,0xFF,0xFF,0xFF,0xFF,0x81,0x00,0x00,0x00,0x30,0x30,0x30,0xF0,0xF0,0xF0,0xF0,0x00,0x01,0x03,0x07,0x0F,0x0F,0x1E,0x1C,0x1C,0x18,0x18,0x18,0x1F,0x1F,0x1F,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [G]
+0x00,0xF8,0xF8,0xF8,0xF8,0xF8,0x00,0x00,0x00,0x00,0x00,0xF8,0xF8,0xF8,0xF8,0xF8,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0x18,0x18,0x18,0x18,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x1F,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [H]
+0x00,0x00,0x18,0x18,0x18,0x18,0xF8,0xF8,0xF8,0xF8,0xF8,0x18,0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x18,0x18,0x18,0x1F,0x1F,0x1F,0x1F,0x1F,0x18,0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [I]
+0x00,0x00,0x00,0x18,0x18,0x18,0x18,0x18,0x18,0xF8,0xF8,0xF8,0xF8,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x1C,0x1C,0x1C,0x18,0x18,0x18,0x1C,0x1F,0x0F,0x0F,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [J]
+0x00,0x00,0xF8,0xF8,0xF8,0xF8,0x00,0x00,0x80,0xC0,0xE0,0xF8,0x78,0x38,0x18,0x08,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x3E,0x7F,0xFF,0xF7,0xE3,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x03,0x07,0x0F,0x1F,0x1E,0x1C,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [K]
+0x00,0x00,0xF8,0xF8,0xF8,0xF8,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x1F,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [L]
+0xF8,0xF8,0xF8,0xF8,0xF8,0xF0,0xC0,0x00,0x00,0x00,0xC0,0xF8,0xF8,0xF8,0xF8,0xF8,0xFF,0xFF,0xFF,0xFF,0x0F,0x3F,0xFF,0xFE,0xF0,0xFE,0xFF,0x1F,0x03,0xFF,0xFF,0xFF,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [M]
+0x00,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0xC0,0x00,0x00,0x00,0x00,0xF8,0xF8,0xF8,0xF8,0x00,0xFF,0xFF,0xFF,0xFF,0x07,0x0F,0x3F,0xFF,0xFC,0xF8,0xE0,0xFF,0xFF,0xFF,0xFF,0x00,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x01,0x07,0x1F,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [N]
+0x00,0xC0,0xE0,0xF0,0xF0,0x78,0x38,0x18,0x18,0x18,0x38,0x78,0xF0,0xF0,0xE0,0xC0,0x7E,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x03,0x07,0x0F,0x0F,0x1E,0x1C,0x18,0x18,0x18,0x1C,0x1E,0x0F,0x0F,0x07,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [O]
+0x00,0x00,0xF8,0xF8,0xF8,0xF8,0xF8,0x18,0x18,0x18,0x18,0x38,0xF8,0xF8,0xF0,0xF0,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x30,0x30,0x30,0x38,0x3C,0x1F,0x1F,0x0F,0x0F,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [P]
+0x00,0xC0,0xE0,0xF0,0xF0,0x78,0x38,0x18,0x18,0x18,0x38,0x78,0xF0,0xF0,0xE0,0xC0,0x7E,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x03,0x07,0x0F,0x0F,0x1E,0x1C,0x18,0x18,0x38,0x7C,0x7E,0xFF,0xEF,0xC7,0xC3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01, // Ascii = [Q]
+0x00,0x00,0xF8,0xF8,0xF8,0xF8,0x18,0x18,0x18,0x38,0x78,0xF8,0xF0,0xF0,0xE0,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x30,0x70,0xF8,0xF8,0xFE,0xDF,0x8F,0x0F,0x03,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x01,0x03,0x0F,0x1F,0x1F,0x1E,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [R]
+0x00,0x00,0xE0,0xF0,0xF0,0xF8,0x38,0x18,0x18,0x18,0x18,0x18,0x38,0x38,0x30,0x00,0x00,0x00,0x03,0x07,0x0F,0x0F,0x1E,0x1C,0x1C,0x3C,0x38,0x78,0xF8,0xF0,0xF0,0xE0,0x00,0x00,0x0E,0x1C,0x1C,0x1C,0x18,0x18,0x18,0x18,0x1C,0x1E,0x0F,0x0F,0x07,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [S]
+0x18,0x18,0x18,0x18,0x18,0x18,0xF8,0xF8,0xF8,0xF8,0xF8,0x18,0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [T]
+0x00,0xF8,0xF8,0xF8,0xF8,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0xF8,0xF8,0xF8,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x07,0x0F,0x0F,0x1F,0x1C,0x18,0x18,0x18,0x1C,0x1F,0x0F,0x0F,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [U]
+0x38,0xF8,0xF8,0xF8,0xE0,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xF8,0xF8,0xF8,0x00,0x00,0x07,0x3F,0xFF,0xFF,0xFC,0xF0,0x80,0xE0,0xF8,0xFF,0xFF,0x1F,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x1F,0x1F,0x1F,0x1F,0x1F,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [V]
+0xF8,0xF8,0xF8,0xF0,0x00,0x00,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0xC0,0xF8,0xF8,0x03,0xFF,0xFF,0xFF,0xF8,0xF0,0xFF,0xFF,0x3F,0xFF,0xFF,0xF8,0xE0,0xFF,0xFF,0xFF,0x00,0x01,0x1F,0x1F,0x1F,0x1F,0x1F,0x03,0x00,0x03,0x1F,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [W]
+0x08,0x18,0x78,0xF8,0xF8,0xF0,0xE0,0x80,0x00,0x00,0xC0,0xE0,0xF0,0xF8,0x78,0x18,0x00,0x00,0x00,0x00,0xC1,0xE7,0xFF,0xFF,0x7F,0xFF,0xFF,0xE3,0xC1,0x80,0x00,0x00,0x10,0x1C,0x1E,0x1F,0x0F,0x03,0x01,0x00,0x00,0x01,0x03,0x07,0x1F,0x1F,0x1E,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [X]
+0x08,0x38,0xF8,0xF8,0xF8,0xE0,0x80,0x00,0x00,0x00,0x00,0xC0,0xE0,0xF8,0xF8,0x38,0x00,0x00,0x00,0x01,0x07,0x0F,0xFF,0xFF,0xFC,0xFE,0xFF,0x0F,0x07,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [Y]
+0x00,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x98,0xD8,0xF8,0xF8,0xF8,0x78,0x00,0x00,0x00,0x00,0xC0,0xE0,0xF0,0xF8,0x7E,0x3F,0x1F,0x07,0x03,0x01,0x00,0x00,0x00,0x1C,0x1E,0x1F,0x1F,0x1F,0x1B,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [Z]
+0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01, // Ascii = [[]
+0x00,0x03,0x0F,0x3F,0xFF,0xFC,0xF0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0F,0x3F,0xFF,0xFC,0xF0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0F,0x3F,0xFF,0xFC,0xF0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01, // Ascii = [\]
+0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00, // Ascii = []]
+0x00,0x00,0x00,0x00,0x00,0xE0,0xF8,0xFE,0x7F,0xFF,0xF8,0xE0,0x80,0x00,0x00,0x00,0x00,0x80,0xF0,0xFC,0xFF,0x3F,0x0F,0x03,0x00,0x01,0x0F,0x3F,0xFF,0xFC,0xF0,0xC0,0x00,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [^]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [_]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [`]
+0x00,0x00,0x80,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x80,0x00,0x00,0x00,0x80,0xC1,0xE1,0xE1,0xF1,0x70,0x30,0x30,0x31,0xFF,0xFF,0xFF,0xFF,0xFE,0x00,0x00,0x07,0x0F,0x1F,0x1F,0x1E,0x18,0x18,0x18,0x1C,0x0F,0x0F,0x1F,0x1F,0x1F,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [a]
+0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x80,0x80,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x03,0x01,0x00,0x00,0x01,0x03,0xFF,0xFF,0xFF,0xFE,0x00,0x00,0x1F,0x1F,0x1F,0x0F,0x1C,0x1C,0x18,0x18,0x1C,0x1F,0x0F,0x0F,0x07,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [b]
+0x00,0x00,0x00,0x00,0x80,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x80,0x00,0x70,0xFE,0xFF,0xFF,0xFF,0x07,0x01,0x01,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x00,0x03,0x07,0x0F,0x0F,0x1F,0x1C,0x1C,0x18,0x18,0x18,0x18,0x1C,0x1C,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [c]
+0x00,0x00,0x00,0x80,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFC,0xFF,0xFF,0xFF,0x9F,0x01,0x00,0x00,0x00,0x01,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x01,0x07,0x0F,0x1F,0x1F,0x1C,0x18,0x18,0x1C,0x0E,0x1F,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [d]
+0x00,0x00,0x00,0x00,0x80,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x80,0x00,0x00,0x00,0xF8,0xFE,0xFF,0xFF,0xFF,0x33,0x31,0x30,0x30,0x31,0x3F,0x3F,0x3F,0x3F,0x3C,0x00,0x00,0x03,0x07,0x0F,0x0F,0x1E,0x1C,0x18,0x18,0x18,0x18,0x18,0x1C,0x1C,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [e]
+0x00,0xC0,0xC0,0xC0,0xC0,0xF8,0xFE,0xFF,0xFF,0xFF,0xC3,0xC1,0xC1,0xC1,0xC1,0xC3,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [f]
+0x00,0x00,0x00,0x80,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x80,0xC0,0xC0,0xC0,0xC0,0x00,0xFC,0xFF,0xFF,0xFF,0x8F,0x01,0x00,0x00,0x01,0x01,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x01,0x07,0x0F,0x1F,0x1F,0x1C,0x18,0x18,0x1C,0x0E,0xFF,0xFF,0xFF,0xFF,0x1F,0x00,0x00,0x03,0x03,0x03,0x02,0x02,0x02,0x02,0x03,0x03,0x03,0x03,0x01,0x00,0x00, // Ascii = [g]
+0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x80,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x07,0x03,0x01,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFE,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [h]
+0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC3,0xC3,0xC3,0xC3,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [i]
+0x00,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC3,0xC3,0xC3,0xC3,0xC3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x7F,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x02,0x02,0x02,0x03,0x03,0x03,0x03,0x01,0x00,0x00,0x00,0x00, // Ascii = [j]
+0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x80,0xC0,0xC0,0xC0,0xC0,0x40,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x70,0xFC,0xFE,0xFF,0xCF,0x87,0x03,0x01,0x00,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x01,0x03,0x07,0x1F,0x1F,0x1E,0x1C,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [k]
+0x00,0x01,0x01,0x01,0x01,0x01,0x01,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [l]
+0xC0,0xC0,0xC0,0xC0,0x80,0xC0,0xC0,0xC0,0xC0,0x80,0x80,0xC0,0xC0,0xC0,0xC0,0x80,0xFF,0xFF,0xFF,0xFF,0x0F,0x03,0x07,0xFF,0xFF,0xFF,0x0F,0x03,0x03,0xFF,0xFF,0xFF,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [m]
+0x00,0x00,0xC0,0xC0,0xC0,0xC0,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x80,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x07,0x03,0x01,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFE,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [n]
+0x00,0x00,0x00,0x80,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x80,0x80,0x00,0x00,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x01,0x00,0x00,0x00,0x01,0x07,0xFF,0xFF,0xFF,0xFE,0x00,0x01,0x07,0x0F,0x0F,0x1F,0x1C,0x18,0x18,0x18,0x1C,0x1F,0x0F,0x0F,0x07,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [o]
+0x00,0x00,0xC0,0xC0,0xC0,0xC0,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x80,0x80,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x03,0x01,0x00,0x00,0x01,0x03,0xFF,0xFF,0xFF,0xFE,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x1E,0x1C,0x18,0x18,0x1C,0x1F,0x1F,0x0F,0x07,0x01,0x00,0x00,0x03,0x03,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [p]
+0x00,0x00,0x00,0x80,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x80,0xC0,0xC0,0xC0,0x00,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x01,0x00,0x00,0x01,0x01,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x03,0x07,0x0F,0x1F,0x1F,0x1C,0x18,0x18,0x1C,0x0E,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x03,0x00, // Ascii = [q]
+0x00,0x00,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x07,0x03,0x01,0x00,0x00,0x07,0x07,0x07,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [r]
+0x00,0x00,0x00,0x80,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x80,0x00,0x00,0x00,0x0E,0x1F,0x1F,0x3F,0x3F,0x38,0x70,0x70,0xF0,0xE0,0xE1,0xE1,0xC1,0x00,0x00,0x00,0x0C,0x1C,0x1C,0x1C,0x18,0x18,0x18,0x18,0x1C,0x1F,0x0F,0x0F,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [s]
+0x00,0xC0,0xC0,0xC0,0xC0,0xF8,0xF8,0xF8,0xF8,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x0F,0x1F,0x1F,0x1C,0x18,0x18,0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [t]
+0x00,0x00,0xC0,0xC0,0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,0xC0,0xC0,0xC0,0xC0,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x07,0x0F,0x1F,0x1F,0x1C,0x18,0x1C,0x1E,0x0F,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [u]
+0x40,0xC0,0xC0,0xC0,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xC0,0xC0,0xC0,0x00,0x01,0x0F,0x3F,0xFF,0xFE,0xF8,0xC0,0x00,0xC0,0xF0,0xFE,0xFF,0x3F,0x0F,0x01,0x00,0x00,0x00,0x00,0x01,0x07,0x1F,0x1F,0x1F,0x1F,0x1F,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [v]
+0xC0,0xC0,0xC0,0xC0,0x00,0x00,0x00,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0xC0,0xC0,0x0F,0xFF,0xFF,0xFF,0xF0,0xF0,0xFF,0xFF,0x1F,0xFF,0xFF,0xFC,0xC0,0xFE,0xFF,0xFF,0x00,0x01,0x1F,0x1F,0x1F,0x1F,0x1F,0x01,0x00,0x01,0x1F,0x1F,0x1F,0x1F,0x1F,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [w]
+0x00,0x40,0xC0,0xC0,0xC0,0xC0,0x80,0x00,0x00,0x00,0x00,0x80,0xC0,0xC0,0xC0,0x40,0x00,0x00,0x01,0x03,0x07,0xDF,0xFF,0xFE,0xFC,0xFC,0xFF,0xDF,0x87,0x03,0x00,0x00,0x00,0x10,0x1C,0x1E,0x1F,0x0F,0x07,0x01,0x01,0x03,0x07,0x1F,0x1F,0x1E,0x1C,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [x]
+0x40,0xC0,0xC0,0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xC0,0xC0,0xC0,0x00,0x01,0x07,0x3F,0xFF,0xFF,0xF8,0xE0,0x80,0xC0,0xF8,0xFE,0xFF,0x3F,0x07,0x01,0x00,0x00,0x00,0x00,0x00,0x83,0xFF,0xFF,0xFF,0x7F,0x0F,0x03,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x02,0x03,0x03,0x03,0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [y]
+0x00,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x00,0x00,0x00,0x00,0x80,0xC0,0xE0,0xF0,0xF8,0x7C,0x3E,0x1F,0x0F,0x07,0x03,0x01,0x00,0x18,0x1C,0x1F,0x1F,0x1F,0x1B,0x19,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [z]
+0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0xFF,0xFF,0xFF,0xC3,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x18,0x18,0x18,0x18,0x3C,0xFF,0xFF,0xE7,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0xFF,0xFF,0xFF,0xC3,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x00, // Ascii = [{]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [|]
+0x00,0x00,0x01,0x01,0x01,0x01,0x83,0xFF,0xFF,0xFF,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0xE7,0xFF,0xFF,0x3C,0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x80,0x80,0x80,0x80,0xC1,0xFF,0xFF,0xFF,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [}]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xF0,0xF8,0xF8,0x18,0x18,0x38,0x78,0x70,0xF0,0xE0,0xC0,0xC0,0xF8,0xF8,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [~]
+};
+
+Font_t PageFont_7x10 = {
+    PAGE_FONT,
+    7,
+    10,
+    32, 126,
+    (FontData_t)PageFont7x10
+};
+
+Font_t PageFont_8x16 = {
+    PAGE_FONT,
+    8,
+    16,
+    32, 126,
+    (FontData_t)PageFont8x16
+};
+
+Font_t PageFont_11x18 = {
+    PAGE_FONT,
+    11,
+    18,
+    32, 126,
+    (FontData_t)PageFont11x18
+};
+
+Font_t PageFont_16x26 = {
+    PAGE_FONT,
+    16,
+    26,
+    32, 126,
+    (FontData_t)PageFont16x26
+};
+
+FontSet_t PageFontSet_10 = {
+    10,
+    10,
+    {&PageFont_7x10, NULL}
+};
+
+FontSet_t PageFontSet_16 = {
+    16,
+    16,
+    {&PageFont_8x16, NULL}
+};
+
+FontSet_t PageFontSet_18 = {
+    18,
+    18,
+    {&PageFont_11x18, NULL}
+};
+
+FontSet_t PageFontSet_26 = {
+    26,
+    26,
+    {&PageFont_16x26, NULL}
+};
+
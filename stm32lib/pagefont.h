@@ -0,0 +1,143 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+#ifndef PAGEFONT_H
+#define PAGEFONT_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup stm32lib
+ * @{
+ */
+
+/**
+ * @defgroup PAGEFONT
+ * @brief    SSD1306 페이지 형식의 ASCII 폰트 라이브러리
+ * @{
+ *
+ * FONT 라이브러리의 ASCII 폰트와 같은 글자들을 SSD1306 버퍼와 같은
+ * 세로 8 픽셀 페이지 형식으로 미리 변환해 둔 폰트 라이브러리.
+ *
+ * 각 글자는 페이지 순서로 저장되며, 한 페이지는 넓이만큼의 바이트로
+ * 이루어진다. 각 바이트의 LSB가 가장 위쪽 픽셀이다. 따라서 SSD1306에서는
+ * 글자를 픽셀 단위로 변환하지 않고 바이트 단위의 자리 이동만으로 버퍼에 복사할 수 있다.
+ *
+ * 폰트 데이터(pagefont.c)는 tools/pagefontgen.c 로 font.c 로부터 생성한다.
+ *
+\verbatim
+cc -o pagefontgen tools/pagefontgen.c
+./pagefontgen stm32lib/font.c > stm32lib/pagefont.c
+\endverbatim
+ *
+ * \par 지원 폰트들
+ *
+ *  - 7 x 10 픽셀
+ *  - 8 x 16 픽셀
+ *  - 11 x 18 픽셀
+ *  - 16 x 26 픽셀
+ *
+ * \par Changelog
+ *
+\verbatim
+ 버전 1.0
+  - 최초 배포
+\endverbatim
+ *
+ * \par 의존성
+ *
+\verbatim
+ - STM32F4xx HAL
+ - FONT
+\endverbatim
+ */
+#include "stm32f4xx_hal.h"
+#include "../stm32lib/font.h"
+
+/**
+ * @defgroup PAGEFONT_매크로
+ * @brief    PAGEFONT 매크로
+ * @{
+ */
+
+/**
+ * @brief  페이지 폰트 한 글자의 페이지 수
+ */
+#define PAGEFONT_PAGES(font)        (((font)->height + 7) / 8)
+
+/**
+ * @brief  페이지 폰트 한 글자의 바이트 수
+ */
+#define PAGEFONT_GLYPH_SIZE(font)   (PAGEFONT_PAGES(font) * (font)->width)
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup PAGEFONT_폰트변수
+ * @brief    PAGEFONT 폰트변수
+ * @{
+ */
+
+/**
+ * @brief  페이지 형식 폰트 구조체들
+ */
+extern Font_t PageFont_7x10;
+extern Font_t PageFont_8x16;
+extern Font_t PageFont_11x18;
+extern Font_t PageFont_16x26;
+
+/**
+ * @brief  페이지 형식 폰트셋 구조체들
+ */
+extern FontSet_t PageFontSet_10;
+extern FontSet_t PageFontSet_16;
+extern FontSet_t PageFontSet_18;
+extern FontSet_t PageFontSet_26;
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
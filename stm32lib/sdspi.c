@@ -0,0 +1,430 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+#include "../stm32lib/sdspi.h"
+#include "../stm32lib/cyccnt.h"
+
+/* SD commands */
+#define CMD0        (0)         /* GO_IDLE_STATE */
+#define CMD8        (8)         /* SEND_IF_COND */
+#define CMD9        (9)         /* SEND_CSD */
+#define CMD12       (12)        /* STOP_TRANSMISSION */
+#define CMD16       (16)        /* SET_BLOCKLEN */
+#define CMD17       (17)        /* READ_SINGLE_BLOCK */
+#define CMD18       (18)        /* READ_MULTIPLE_BLOCK */
+#define CMD24       (24)        /* WRITE_BLOCK */
+#define CMD25       (25)        /* WRITE_MULTIPLE_BLOCK */
+#define CMD55       (55)        /* APP_CMD */
+#define CMD58       (58)        /* READ_OCR */
+#define CMD59       (59)        /* CRC_ON_OFF */
+#define ACMD23      (0x80 + 23) /* SET_WR_BLK_ERASE_COUNT */
+#define ACMD41      (0x80 + 41) /* SD_SEND_OP_COND */
+
+/* Data tokens */
+#define TOKEN_START         0xFE    /* CMD17/18/24 */
+#define TOKEN_START_MULTI   0xFC    /* CMD25 */
+#define TOKEN_STOP_MULTI    0xFD    /* CMD25 */
+
+/* Timeouts in ms */
+#define SDSPI_INIT_TIMEOUT  1000
+#define SDSPI_READ_TIMEOUT  200
+#define SDSPI_WRITE_TIMEOUT 500
+
+#if SDSPI_CRC
+/* CRC16-CCITT, 4 비트 단위 표 */
+static const uint16_t sdspi_crc16_table[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+};
+#endif
+
+/* Private functions */
+static uint8_t sdspi_crc7(const uint8_t* data, int length);
+#if SDSPI_CRC
+static uint16_t sdspi_crc16(const uint8_t* data, int length);
+#endif
+static void sdspi_select(SDSPI_t* card);
+static void sdspi_deselect(SDSPI_t* card);
+static int sdspi_wait_ready(SDSPI_t* card, uint32_t timeout);
+static uint8_t sdspi_command(SDSPI_t* card, uint8_t cmd, uint32_t arg);
+static int sdspi_transfer(SDSPI_t* card, const uint8_t* tx, uint8_t* rx, int length);
+static SDSPI_Res_t sdspi_rx_block(SDSPI_t* card, uint8_t* data, int length);
+static SDSPI_Res_t sdspi_tx_block(SDSPI_t* card, const uint8_t* data, uint8_t token);
+
+SDSPI_Res_t sdspi_init(SDSPI_t* card, SPI_t SPI_Num, GPIO_Pin_t cs)
+{
+    SDSPI_Type_t type = SDSPI_TYPE_NONE;
+    uint8_t ocr[4], csd[16];
+    uint32_t start, csize;
+    uint8_t i, r;
+
+    memset(card, 0, sizeof(SDSPI_t));
+    card->bus = SPI_Num;
+    card->cs = cs;
+    gpio_init(cs, GPIO_OUT);
+    gpio_write(cs, 1);
+
+    /* 읽기/쓰기 시간을 잴 사이클 카운터 */
+    cyccnt_enable();
+
+    /* 초기화는 400kHz 이하, 이후는 SDSPI_FREQUENCY 이하 */
+    spi_make_profile(SPI_Num, &card->slow, SPI_Mode0, 8, 400000);
+    card->hz = spi_make_profile(SPI_Num, &card->fast, SPI_Mode0, 8, SDSPI_FREQUENCY);
+
+    /* CS 를 high 로 두고 74 클럭 이상 보내 카드를 깨운다 */
+    spi_set_profile(SPI_Num, &card->slow);
+    for (i = 0; i < 10; i++)
+        spi_writeread(SPI_Num, 0xFF);
+
+    sdspi_select(card);
+    if (sdspi_command(card, CMD0, 0) == 0x01) {
+        start = HAL_GetTick();
+        if (sdspi_command(card, CMD8, 0x1AA) == 0x01) {
+            /* SD 버전 2: 전압 범위와 확인 패턴이 돌아와야 한다 */
+            for (i = 0; i < 4; i++)
+                ocr[i] = spi_writeread(SPI_Num, 0xFF);
+            if (ocr[2] == 0x01 && ocr[3] == 0xAA) {
+                while ((r = sdspi_command(card, ACMD41, 1UL << 30)) != 0 && HAL_GetTick() - start < SDSPI_INIT_TIMEOUT);
+                if (r == 0 && sdspi_command(card, CMD58, 0) == 0) {
+                    for (i = 0; i < 4; i++)
+                        ocr[i] = spi_writeread(SPI_Num, 0xFF);
+                    type = (ocr[0] & 0x40) ? SDSPI_TYPE_SDHC : SDSPI_TYPE_SDV2;
+                }
+            }
+        } else {
+            /* SD 버전 1 */
+            while ((r = sdspi_command(card, ACMD41, 0)) != 0 && HAL_GetTick() - start < SDSPI_INIT_TIMEOUT);
+            if (r == 0)
+                type = SDSPI_TYPE_SDV1;
+        }
+        /* 바이트 주소 카드는 블록 크기를 512 로 맞춘다 */
+        if (type != SDSPI_TYPE_NONE && type != SDSPI_TYPE_SDHC && sdspi_command(card, CMD16, SDSPI_BLOCK_SIZE) != 0)
+            type = SDSPI_TYPE_NONE;
+#if SDSPI_CRC
+        if (type != SDSPI_TYPE_NONE && sdspi_command(card, CMD59, 1) != 0)
+            type = SDSPI_TYPE_NONE;
+#endif
+    }
+    sdspi_deselect(card);
+    if (type == SDSPI_TYPE_NONE)
+        return SDSPI_RES_NOCARD;
+    card->type = type;
+
+    /* CSD 로부터 전체 블록 수를 구한다 */
+    sdspi_select(card);
+    r = sdspi_command(card, CMD9, 0);
+    if (r == 0 && sdspi_rx_block(card, csd, sizeof(csd)) == SDSPI_RES_OK) {
+        if ((csd[0] >> 6) == 1) {
+            /* CSD 버전 2.0 */
+            csize = ((uint32_t)(csd[7] & 0x3F) << 16) | ((uint32_t)csd[8] << 8) | csd[9];
+            card->sectors = (csize + 1) << 10;
+        } else {
+            /* CSD 버전 1.0 */
+            i = (csd[5] & 0x0F) + ((csd[10] & 0x80) >> 7) + ((csd[9] & 0x03) << 1) + 2;
+            csize = (csd[8] >> 6) + ((uint32_t)csd[7] << 2) + ((uint32_t)(csd[6] & 0x03) << 10) + 1;
+            card->sectors = csize << (i - 9);
+        }
+    }
+    sdspi_deselect(card);
+    if (card->sectors == 0) {
+        card->type = SDSPI_TYPE_NONE;
+        return SDSPI_RES_ERR;
+    }
+
+#if SDSPI_DMA
+    /* DMA 를 쓸 수 없는 버스이면 블로킹 전송을 사용한다. CS 는 이 드라이버가 직접 다룬다 */
+    card->dma = (spi_async_init(SPI_Num) > 0);
+    if (card->dma)
+        spi_async_device(&card->dev, SPI_Num, GPIO_NC, GPIO_NC, SPI_Mode0, SDSPI_FREQUENCY, 8);
+#endif
+    return SDSPI_RES_OK;
+}
+
+SDSPI_Res_t sdspi_read(SDSPI_t* card, uint32_t sector, void* data, uint32_t count)
+{
+    uint32_t start = SDSPI_TIMESTAMP();
+    uint8_t *p = (uint8_t *)data;
+    SDSPI_Res_t res = SDSPI_RES_ERR;
+    uint32_t n;
+
+    if (card->type == SDSPI_TYPE_NONE)
+        return SDSPI_RES_NOCARD;
+    if (count == 0 || sector >= card->sectors || count > card->sectors - sector)
+        return SDSPI_RES_PARAM;
+    if (card->type != SDSPI_TYPE_SDHC)
+        sector *= SDSPI_BLOCK_SIZE;
+
+    sdspi_select(card);
+    if (count == 1) {
+        if (sdspi_command(card, CMD17, sector) == 0)
+            res = sdspi_rx_block(card, p, SDSPI_BLOCK_SIZE);
+    } else if (sdspi_command(card, CMD18, sector) == 0) {
+        for (n = 0; n < count; n++, p += SDSPI_BLOCK_SIZE) {
+            res = sdspi_rx_block(card, p, SDSPI_BLOCK_SIZE);
+            if (res != SDSPI_RES_OK)
+                break;
+        }
+        sdspi_command(card, CMD12, 0);
+    }
+    sdspi_deselect(card);
+
+    if (res == SDSPI_RES_OK) {
+        card->readblocks += count;
+        card->readcycles += SDSPI_TIMESTAMP() - start;
+    }
+    return res;
+}
+
+SDSPI_Res_t sdspi_write(SDSPI_t* card, uint32_t sector, const void* data, uint32_t count)
+{
+    uint32_t start = SDSPI_TIMESTAMP();
+    const uint8_t *p = (const uint8_t *)data;
+    SDSPI_Res_t res = SDSPI_RES_ERR, stop;
+    uint32_t n;
+
+    if (card->type == SDSPI_TYPE_NONE)
+        return SDSPI_RES_NOCARD;
+    if (count == 0 || sector >= card->sectors || count > card->sectors - sector)
+        return SDSPI_RES_PARAM;
+    if (card->type != SDSPI_TYPE_SDHC)
+        sector *= SDSPI_BLOCK_SIZE;
+
+    sdspi_select(card);
+    if (count == 1) {
+        if (sdspi_command(card, CMD24, sector) == 0)
+            res = sdspi_tx_block(card, p, TOKEN_START);
+    } else {
+        /* 쓸 블록 수를 미리 알려 카드가 지우기를 먼저 하도록 한다. 실패해도 쓰기는 할 수 있다 */
+        sdspi_command(card, ACMD23, count);
+        if (sdspi_command(card, CMD25, sector) == 0) {
+            for (n = 0; n < count; n++, p += SDSPI_BLOCK_SIZE) {
+                res = sdspi_tx_block(card, p, TOKEN_START_MULTI);
+                if (res != SDSPI_RES_OK)
+                    break;
+            }
+            stop = sdspi_tx_block(card, NULL, TOKEN_STOP_MULTI);
+            if (res == SDSPI_RES_OK)
+                res = stop;
+        }
+    }
+    /* 마지막 블록을 카드가 다 쓸 때까지 기다린다 */
+    if (sdspi_wait_ready(card, SDSPI_WRITE_TIMEOUT) < 0 && res == SDSPI_RES_OK)
+        res = SDSPI_RES_TIMEOUT;
+    sdspi_deselect(card);
+
+    if (res == SDSPI_RES_OK) {
+        card->writeblocks += count;
+        card->writecycles += SDSPI_TIMESTAMP() - start;
+    }
+    return res;
+}
+
+uint32_t sdspi_read_rate(const SDSPI_t* card)
+{
+    if (card->readcycles == 0)
+        return 0;
+    return (uint32_t)((uint64_t)card->readblocks * SDSPI_BLOCK_SIZE * SystemCoreClock / card->readcycles);
+}
+
+uint32_t sdspi_write_rate(const SDSPI_t* card)
+{
+    if (card->writecycles == 0)
+        return 0;
+    return (uint32_t)((uint64_t)card->writeblocks * SDSPI_BLOCK_SIZE * SystemCoreClock / card->writecycles);
+}
+
+static uint8_t sdspi_crc7(const uint8_t* data, int length)
+{
+    uint8_t crc = 0, b, i;
+
+    while (length--) {
+        b = *data++;
+        for (i = 0; i < 8; i++, b <<= 1) {
+            crc <<= 1;
+            if ((b ^ crc) & 0x80)
+                crc ^= 0x09;
+        }
+    }
+    return crc & 0x7F;
+}
+
+#if SDSPI_CRC
+static uint16_t sdspi_crc16(const uint8_t* data, int length)
+{
+    uint16_t crc = 0;
+
+    while (length--) {
+        crc = (crc << 4) ^ sdspi_crc16_table[((crc >> 12) ^ (*data >> 4)) & 0x0F];
+        crc = (crc << 4) ^ sdspi_crc16_table[((crc >> 12) ^ *data) & 0x0F];
+        data++;
+    }
+    return crc;
+}
+#endif
+
+/* 다른 장치가 바꾼 버스 설정을 되돌린 후 CS 를 내린다 */
+static void sdspi_select(SDSPI_t* card)
+{
+    spi_set_profile(card->bus, (card->type == SDSPI_TYPE_NONE) ? &card->slow : &card->fast);
+    spi_select(card->bus, card->cs);
+    spi_writeread(card->bus, 0xFF);
+}
+
+/* CS 를 올린 후 카드가 MISO 를 놓도록 클럭 8 개를 더 보낸다 */
+static void sdspi_deselect(SDSPI_t* card)
+{
+    spi_deselect(card->bus, card->cs);
+    spi_writeread(card->bus, 0xFF);
+}
+
+static int sdspi_wait_ready(SDSPI_t* card, uint32_t timeout)
+{
+    uint32_t start = HAL_GetTick();
+
+    while (spi_writeread(card->bus, 0xFF) != 0xFF) {
+        if (HAL_GetTick() - start >= timeout)
+            return -1;
+    }
+    return 1;
+}
+
+/* 명령을 보내고 R1 응답을 돌려준다. 응답이 없으면 0xFF */
+static uint8_t sdspi_command(SDSPI_t* card, uint8_t cmd, uint32_t arg)
+{
+    uint8_t frame[6], r, n;
+
+    if (cmd & 0x80) {
+        cmd &= 0x7F;
+        r = sdspi_command(card, CMD55, 0);
+        if (r > 1)
+            return r;
+    }
+    /* CMD0 과 CMD12 외에는 이전 동작이 끝나기를 기다린다 */
+    if (cmd != CMD0 && cmd != CMD12 && sdspi_wait_ready(card, SDSPI_WRITE_TIMEOUT) < 0)
+        return 0xFF;
+
+    frame[0] = 0x40 | cmd;
+    frame[1] = (uint8_t)(arg >> 24);
+    frame[2] = (uint8_t)(arg >> 16);
+    frame[3] = (uint8_t)(arg >> 8);
+    frame[4] = (uint8_t)arg;
+    frame[5] = (sdspi_crc7(frame, 5) << 1) | 0x01;
+    spi_nwrite(card->bus, frame, sizeof(frame));
+    if (cmd == CMD12)
+        spi_writeread(card->bus, 0xFF);     /* stuff byte */
+
+    for (n = 0; n < 10; n++) {
+        r = spi_writeread(card->bus, 0xFF);
+        if (!(r & 0x80))
+            break;
+    }
+    return r;
+}
+
+/* 데이터 블록을 주고 받는다. 512 바이트 블록은 가능하면 DMA 를 사용한다 */
+static int sdspi_transfer(SDSPI_t* card, const uint8_t* tx, uint8_t* rx, int length)
+{
+#if SDSPI_DMA
+    SPI_Async_t xfer;
+
+    if (card->dma && length == SDSPI_BLOCK_SIZE) {
+        memset(&xfer, 0, sizeof(SPI_Async_t));
+        xfer.dev = &card->dev;
+        xfer.tx = tx;
+        xfer.rx = rx;
+        xfer.length = length;
+        if (spi_async_submit(&xfer) < 0)
+            return -1;
+        if (spi_async_wait(&xfer, SDSPI_READ_TIMEOUT) > 0)
+            return 1;
+        /* 스택의 기술자가 큐에 남지 않도록 DMA 를 멈추고 뺀다 */
+        spi_async_cancel(&xfer);
+        return -1;
+    }
+#endif
+    if (rx != NULL)
+        return spi_nread(card->bus, rx, length, 0xFF);
+    spi_nwrite(card->bus, tx, length);
+    return 1;
+}
+
+static SDSPI_Res_t sdspi_rx_block(SDSPI_t* card, uint8_t* data, int length)
+{
+    uint32_t start = HAL_GetTick();
+    uint16_t crc;
+    uint8_t token;
+
+    /* 데이터 시작 토큰을 기다린다 */
+    while ((token = spi_writeread(card->bus, 0xFF)) == 0xFF) {
+        if (HAL_GetTick() - start >= SDSPI_READ_TIMEOUT)
+            return SDSPI_RES_TIMEOUT;
+    }
+    if (token != TOKEN_START)
+        return SDSPI_RES_ERR;
+
+    if (sdspi_transfer(card, NULL, data, length) < 0)
+        return SDSPI_RES_ERR;
+    crc = spi_writeread(card->bus, 0xFF) << 8;
+    crc |= spi_writeread(card->bus, 0xFF);
+#if SDSPI_CRC
+    if (crc != sdspi_crc16(data, length)) {
+        card->crcerrors++;
+        return SDSPI_RES_CRC;
+    }
+#else
+    (void)crc;
+#endif
+    return SDSPI_RES_OK;
+}
+
+static SDSPI_Res_t sdspi_tx_block(SDSPI_t* card, const uint8_t* data, uint8_t token)
+{
+    uint16_t crc = 0xFFFF;
+    uint8_t resp;
+
+    if (sdspi_wait_ready(card, SDSPI_WRITE_TIMEOUT) < 0)
+        return SDSPI_RES_TIMEOUT;
+    spi_writeread(card->bus, token);
+    if (token == TOKEN_STOP_MULTI)
+        return SDSPI_RES_OK;
+
+    if (sdspi_transfer(card, data, NULL, SDSPI_BLOCK_SIZE) < 0)
+        return SDSPI_RES_ERR;
+#if SDSPI_CRC
+    crc = sdspi_crc16(data, SDSPI_BLOCK_SIZE);
+#endif
+    spi_writeread(card->bus, crc >> 8);
+    spi_writeread(card->bus, crc & 0xFF);
+
+    /* 데이터 응답: xxx0sss1, 010 이면 받아들임, 101 이면 CRC 오류 */
+    resp = spi_writeread(card->bus, 0xFF) & 0x1F;
+    if (resp == 0x0B) {
+        card->crcerrors++;
+        return SDSPI_RES_CRC;
+    }
+    return (resp == 0x05) ? SDSPI_RES_OK : SDSPI_RES_ERR;
+}
@@ -0,0 +1,262 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+#ifndef SDSPI_H
+#define SDSPI_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup stm32lib
+ * @{
+ */
+
+/**
+ * @defgroup SDSPI
+ * @brief    SPI 모드 SD 카드 블록 드라이버
+ * @{
+ *
+ * SDIO 가 없거나 SDIO 핀을 다른 용도로 쓰는 보드에서 SD 카드를 SPI 버스로 사용한다.
+ * SDSC(v1, v2)와 SDHC/SDXC 카드를 지원하며, 블록 크기는 항상 512 바이트이다.
+ *
+ *  - 여러 블록 읽기는 CMD18 과 CMD12, 여러 블록 쓰기는 CMD25 와 정지 토큰을 사용한다
+ *  - 여러 블록을 쓰기 전에 ACMD23 으로 쓸 블록 수를 알려 카드가 미리 지우도록 한다
+ *  - @ref SDSPI_DMA 가 1 이면 512 바이트 블록은 @ref SPIASYNC 의 DMA 로 주고 받는다
+ *  - @ref SDSPI_CRC 가 1 이면 데이터 블록의 CRC16 을 확인한다
+ *
+ * 초기화는 400kHz 로, 이후는 @ref SDSPI_FREQUENCY 를 넘지 않는 주파수로 동작한다.
+ * 두 설정은 @ref SPI_Profile_t 로 저장되어 있어, 같은 버스의 다른 장치가 설정을 바꾸어도
+ * 명령마다 레지스터만 다시 써서 되돌린다.
+ * FatFs 에 연결하려면 @ref SDSPI_DISKIO 를 사용한다.
+ *
+ * \par 사용 예
+ *
+\code
+static SDSPI_t card;
+static uint8_t block[4][512];
+
+spi_init(SPI_2, SPI2_PINS2);
+if (sdspi_init(&card, SPI_2, GPIO_PB_12) == SDSPI_RES_OK) {
+    sdspi_write(&card, 100, block, 4);
+    sdspi_read(&card, 100, block, 4);
+    printf("%lu blocks, write %lu B/s\n", card.sectors, sdspi_write_rate(&card));
+}
+\endcode
+ *
+ * \par Changelog
+ *
+\verbatim
+ 버전 1.0
+  - 최초 배포
+\endverbatim
+ *
+ * \par 의존성
+ *
+\verbatim
+ - STM32F4xx HAL
+ - SPI
+ - SPIASYNC (SDSPI_DMA 가 1 일 때)
+ - GPIO
+\endverbatim
+ */
+#include "stm32f4xx_hal.h"
+#include "../stm32lib/spi.h"
+#include "../stm32lib/gpio.h"
+
+/**
+ * @defgroup SDSPI_매크로
+ * @brief    SDSPI 매크로
+ * @{
+ */
+
+/**
+ * @brief  512 바이트 데이터 블록을 DMA 로 전송한다. 0 이면 @ref spi_nread()/@ref spi_nwrite() 를 사용한다
+ */
+#ifndef SDSPI_DMA
+#define SDSPI_DMA           1
+#endif
+
+#if SDSPI_DMA
+#include "../stm32lib/spiasync.h"
+#endif
+
+/**
+ * @brief  1 이면 CMD59 로 카드의 CRC 검사를 켜고, 쓰는 블록에 CRC16 을 붙이며 읽은 블록의 CRC16 을 확인한다
+ */
+#ifndef SDSPI_CRC
+#define SDSPI_CRC           0
+#endif
+
+/**
+ * @brief  초기화 이후 사용할 최대 SCK 주파수
+ */
+#ifndef SDSPI_FREQUENCY
+#define SDSPI_FREQUENCY     25000000
+#endif
+
+/**
+ * @brief  블록 크기(바이트 단위)
+ */
+#define SDSPI_BLOCK_SIZE    512
+
+/**
+ * @brief  전송 속도 측정에 사용하는 사이클 카운터
+ */
+#ifndef SDSPI_TIMESTAMP
+#define SDSPI_TIMESTAMP()   (DWT->CYCCNT)
+#endif
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup SDSPI_자료형
+ * @brief    SDSPI 자료형
+ * @{
+ */
+
+/**
+ * @brief  결과 열거형
+ */
+typedef enum {
+    SDSPI_RES_OK = 0x00,    /*!< 정상 */
+    SDSPI_RES_ERR,          /*!< 카드가 명령이나 데이터를 거부함 */
+    SDSPI_RES_TIMEOUT,      /*!< 카드가 응답하지 않음 */
+    SDSPI_RES_CRC,          /*!< 읽은 블록의 CRC 가 맞지 않음 */
+    SDSPI_RES_NOCARD,       /*!< 카드가 없거나 지원하지 않는 카드 */
+    SDSPI_RES_PARAM,        /*!< 잘못된 인자 (범위를 벗어난 블록 등) */
+} SDSPI_Res_t;
+
+/**
+ * @brief  카드 종류 열거형
+ */
+typedef enum {
+    SDSPI_TYPE_NONE = 0,    /*!< 초기화되지 않음 */
+    SDSPI_TYPE_SDV1,        /*!< SD 버전 1 (SDSC) */
+    SDSPI_TYPE_SDV2,        /*!< SD 버전 2, 바이트 주소 (SDSC) */
+    SDSPI_TYPE_SDHC,        /*!< SD 버전 2, 블록 주소 (SDHC/SDXC) */
+} SDSPI_Type_t;
+
+/**
+ * @brief  카드 구조체
+ */
+typedef struct {
+    SPI_t bus;              /*!< SPI 번호 */
+    GPIO_Pin_t cs;          /*!< CS 핀 */
+    SDSPI_Type_t type;      /*!< 카드 종류 */
+    uint32_t sectors;       /*!< 전체 블록 수 */
+    uint32_t hz;            /*!< 데이터 전송에 사용하는 실제 SCK 주파수 */
+    SPI_Profile_t slow;     /*!< 초기화용 400kHz 설정. 내부용 */
+    SPI_Profile_t fast;     /*!< 데이터 전송용 설정. 내부용 */
+#if SDSPI_DMA
+    SPI_Device_t dev;       /*!< DMA 전송에 사용하는 장치. 내부용 */
+    uint8_t dma;            /*!< DMA 를 사용할 수 있으면 1 */
+#endif
+    uint32_t readblocks;    /*!< 읽은 블록 수 */
+    uint32_t writeblocks;   /*!< 쓴 블록 수 */
+    uint64_t readcycles;    /*!< 읽기에 걸린 사이클 수의 합 */
+    uint64_t writecycles;   /*!< 쓰기에 걸린 사이클 수의 합 (쓰기 완료 대기 포함) */
+    uint32_t crcerrors;     /*!< CRC 오류 수 */
+} SDSPI_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup SDSPI_함수
+ * @brief    SDSPI 함수
+ * @{
+ */
+
+/**
+ * @brief  SD 카드를 SPI 모드로 초기화하고 종류와 용량을 읽는다
+ * @note   버스는 먼저 @ref spi_init() 로 초기화되어야 한다
+ * @param  *card: 카드 구조체
+ * @param  SPI_Num: 카드가 연결된 SPI 번호
+ * @param  cs: CS 핀
+ * @retval @ref SDSPI_Res_t 열거형 값
+ */
+SDSPI_Res_t sdspi_init(SDSPI_t* card, SPI_t SPI_Num, GPIO_Pin_t cs);
+
+/**
+ * @brief  블록들을 읽는다. 2 블록 이상이면 CMD18 을 사용한다
+ * @param  *card: 카드 구조체
+ * @param  sector: 시작 블록 번호
+ * @param  *data: 읽은 데이터를 저장할 버퍼, count * 512 바이트
+ * @param  count: 블록 수
+ * @retval @ref SDSPI_Res_t 열거형 값
+ */
+SDSPI_Res_t sdspi_read(SDSPI_t* card, uint32_t sector, void* data, uint32_t count);
+
+/**
+ * @brief  블록들을 쓴다. 2 블록 이상이면 ACMD23 으로 미리 지우기를 알린 후 CMD25 를 사용한다
+ * @note   카드가 마지막 블록을 내부에 다 쓸 때까지 기다린 후 반환하므로, 쓰기 속도는 지속 속도이다
+ * @param  *card: 카드 구조체
+ * @param  sector: 시작 블록 번호
+ * @param  *data: 쓸 데이터, count * 512 바이트
+ * @param  count: 블록 수
+ * @retval @ref SDSPI_Res_t 열거형 값
+ */
+SDSPI_Res_t sdspi_write(SDSPI_t* card, uint32_t sector, const void* data, uint32_t count);
+
+/**
+ * @brief  지금까지의 평균 읽기 속도를 얻는다
+ * @param  *card: 카드 구조체
+ * @retval 초당 바이트 수, 측정값이 없으면 0
+ */
+uint32_t sdspi_read_rate(const SDSPI_t* card);
+
+/**
+ * @brief  지금까지의 평균 쓰기 속도를 얻는다
+ * @param  *card: 카드 구조체
+ * @retval 초당 바이트 수, 측정값이 없으면 0
+ */
+uint32_t sdspi_write_rate(const SDSPI_t* card);
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
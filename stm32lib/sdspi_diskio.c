@@ -0,0 +1,137 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+#include "../stm32lib/sdspi_diskio.h"
+
+/* Private variable */
+static SDSPI_t sdspi_card;
+static SPI_t sdspi_bus;
+static GPIO_Pin_t sdspi_cs = GPIO_NC;
+
+/* Private functions */
+static DSTATUS sdspi_disk_initialize(BYTE lun);
+static DSTATUS sdspi_disk_status(BYTE lun);
+static DRESULT sdspi_disk_read(BYTE lun, BYTE* buff, DWORD sector, UINT count);
+#if _USE_WRITE == 1
+static DRESULT sdspi_disk_write(BYTE lun, const BYTE* buff, DWORD sector, UINT count);
+#endif
+#if _USE_IOCTL == 1
+static DRESULT sdspi_disk_ioctl(BYTE lun, BYTE cmd, void* buff);
+#endif
+
+const Diskio_drvTypeDef SDSPI_Driver = {
+    sdspi_disk_initialize,
+    sdspi_disk_status,
+    sdspi_disk_read,
+#if _USE_WRITE == 1
+    sdspi_disk_write,
+#endif
+#if _USE_IOCTL == 1
+    sdspi_disk_ioctl,
+#endif
+};
+
+void sdspi_diskio_config(SPI_t SPI_Num, GPIO_Pin_t cs)
+{
+    sdspi_bus = SPI_Num;
+    sdspi_cs = cs;
+}
+
+SDSPI_t* sdspi_diskio_card(void)
+{
+    return &sdspi_card;
+}
+
+static DSTATUS sdspi_disk_initialize(BYTE lun)
+{
+    if (sdspi_cs == GPIO_NC)
+        return STA_NOINIT;
+    if (sdspi_card.type == SDSPI_TYPE_NONE)
+        sdspi_init(&sdspi_card, sdspi_bus, sdspi_cs);
+    return sdspi_disk_status(lun);
+}
+
+static DSTATUS sdspi_disk_status(BYTE lun)
+{
+    return (sdspi_card.type == SDSPI_TYPE_NONE) ? STA_NOINIT : 0;
+}
+
+static DRESULT sdspi_disk_read(BYTE lun, BYTE* buff, DWORD sector, UINT count)
+{
+    switch (sdspi_read(&sdspi_card, sector, buff, count)) {
+        case SDSPI_RES_OK:
+            return RES_OK;
+        case SDSPI_RES_NOCARD:
+            return RES_NOTRDY;
+        case SDSPI_RES_PARAM:
+            return RES_PARERR;
+        default:
+            return RES_ERROR;
+    }
+}
+
+#if _USE_WRITE == 1
+static DRESULT sdspi_disk_write(BYTE lun, const BYTE* buff, DWORD sector, UINT count)
+{
+    switch (sdspi_write(&sdspi_card, sector, buff, count)) {
+        case SDSPI_RES_OK:
+            return RES_OK;
+        case SDSPI_RES_NOCARD:
+            return RES_NOTRDY;
+        case SDSPI_RES_PARAM:
+            return RES_PARERR;
+        default:
+            return RES_ERROR;
+    }
+}
+#endif
+
+#if _USE_IOCTL == 1
+static DRESULT sdspi_disk_ioctl(BYTE lun, BYTE cmd, void* buff)
+{
+    if (sdspi_card.type == SDSPI_TYPE_NONE)
+        return RES_NOTRDY;
+
+    switch (cmd) {
+        /* sdspi_write() 는 카드가 쓰기를 마친 후 반환하므로 할 일이 없다 */
+        case CTRL_SYNC:
+            return RES_OK;
+        case GET_SECTOR_COUNT:
+            *(DWORD *)buff = sdspi_card.sectors;
+            return RES_OK;
+        case GET_SECTOR_SIZE:
+            *(WORD *)buff = SDSPI_BLOCK_SIZE;
+            return RES_OK;
+        /* 지우기 블록 크기는 알 수 없음 */
+        case GET_BLOCK_SIZE:
+            *(DWORD *)buff = 1;
+            return RES_OK;
+        default:
+            return RES_PARERR;
+    }
+}
+#endif
@@ -0,0 +1,122 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+#ifndef SDSPI_DISKIO_H
+#define SDSPI_DISKIO_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup stm32lib
+ * @{
+ */
+
+/**
+ * @defgroup SDSPI_DISKIO
+ * @brief    SPI 모드 SD 카드를 위한 FatFs 디스크 입출력 드라이버
+ * @{
+ *
+ * STM32Cube FatFs 미들웨어의 ff_gen_drv 에 @ref SDSPI 카드를 연결한다.
+ * bsp_sd.c 와 sd_diskio.c 의 SDIO 드라이버 대신 사용한다.
+ * FatFs 의 여러 섹터 읽기/쓰기는 그대로 CMD18/CMD25 전송이 된다.
+ *
+ * \par 사용 예
+ *
+\code
+FATFS fs;
+char path[4];
+
+spi_init(SPI_2, SPI2_PINS2);
+sdspi_diskio_config(SPI_2, GPIO_PB_12);
+FATFS_LinkDriver(&SDSPI_Driver, path);
+f_mount(&fs, path, 0);
+\endcode
+ *
+ * \par Changelog
+ *
+\verbatim
+ 버전 1.0
+  - 최초 배포
+\endverbatim
+ *
+ * \par 의존성
+ *
+\verbatim
+ - SDSPI
+ - FatFs (ff_gen_drv.h)
+\endverbatim
+ */
+#include "../stm32lib/sdspi.h"
+#include "ff_gen_drv.h"
+
+/**
+ * @defgroup SDSPI_DISKIO_함수
+ * @brief    SDSPI_DISKIO 함수
+ * @{
+ */
+
+/**
+ * @brief  FATFS_LinkDriver() 에 넘겨줄 드라이버
+ */
+extern const Diskio_drvTypeDef SDSPI_Driver;
+
+/**
+ * @brief  카드가 연결된 SPI 버스와 CS 핀을 정한다. 카드는 disk_initialize 에서 초기화된다
+ * @note   버스는 먼저 @ref spi_init() 로 초기화되어야 한다
+ * @param  SPI_Num: 카드가 연결된 SPI 번호
+ * @param  cs: CS 핀
+ * @retval 없음
+ */
+void sdspi_diskio_config(SPI_t SPI_Num, GPIO_Pin_t cs);
+
+/**
+ * @brief  드라이버가 사용하는 카드 구조체를 얻는다. 전송 속도 확인에 사용한다
+ * @retval 카드 구조체의 포인터
+ */
+SDSPI_t* sdspi_diskio_card(void);
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -26,13 +26,40 @@
  *----------------------------------------------------------------------
  */
 #include "../stm32lib/spi.h"
+#include "../stm32lib/spiprof.h"
+#include "../stm32lib/cyccnt.h"
+
+/* Private SPI bus structure */
+typedef struct {
+    SPI_HandleTypeDef handle;
+    SPI_Mode_t mode;
+    int bits;
+    int slave;
+    uint16_t prescaler;
+    const void *dma_owner;  /* DMA 스트림을 점유한 모듈, NULL 이면 비어 있음 */
+} SPI_Context_t;
 
 /* Private variable */
-static SPI_HandleTypeDef spiHandle;
-static SPI_Mode_t spi_mode = SPI_Mode0;
-static int spi_bits = SPI_DATASIZE_8BIT;
-static int spi_slave = SPI_MODE_MASTER;
-static uint16_t spi_baudrateprescaler = SPI_BAUDRATEPRESCALER_256;
+static SPI_Context_t spi_context[] = {
+#ifdef SPI1
+    {.handle = {.Instance = SPI1}, .mode = SPI_Mode0, .bits = SPI_DATASIZE_8BIT, .slave = SPI_MODE_MASTER, .prescaler = SPI_BAUDRATEPRESCALER_8},
+#endif
+#ifdef SPI2
+    {.handle = {.Instance = SPI2}, .mode = SPI_Mode0, .bits = SPI_DATASIZE_8BIT, .slave = SPI_MODE_MASTER, .prescaler = SPI_BAUDRATEPRESCALER_8},
+#endif
+#ifdef SPI3
+    {.handle = {.Instance = SPI3}, .mode = SPI_Mode0, .bits = SPI_DATASIZE_8BIT, .slave = SPI_MODE_MASTER, .prescaler = SPI_BAUDRATEPRESCALER_8},
+#endif
+#ifdef SPI4
+    {.handle = {.Instance = SPI4}, .mode = SPI_Mode0, .bits = SPI_DATASIZE_8BIT, .slave = SPI_MODE_MASTER, .prescaler = SPI_BAUDRATEPRESCALER_8},
+#endif
+#ifdef SPI5
+    {.handle = {.Instance = SPI5}, .mode = SPI_Mode0, .bits = SPI_DATASIZE_8BIT, .slave = SPI_MODE_MASTER, .prescaler = SPI_BAUDRATEPRESCALER_8},
+#endif
+#ifdef SPI6
+    {.handle = {.Instance = SPI6}, .mode = SPI_Mode0, .bits = SPI_DATASIZE_8BIT, .slave = SPI_MODE_MASTER, .prescaler = SPI_BAUDRATEPRESCALER_8},
+#endif
+};
 static SPI_Pins_t spi_pins[] = {
     {SPI_1, GPIO_PA_7,  GPIO_PA_6,  GPIO_PA_5,  GPIO_AF5_SPI1},
     {SPI_1, GPIO_PB_5,  GPIO_PB_4,  GPIO_PB_3,  GPIO_AF5_SPI1},
@@ -43,11 +70,34 @@ static SPI_Pins_t spi_pins[] = {
 };
 
 /* Private functions */
-static void spi_internal_init(SPI_TypeDef* SPIx, SPI_Mode_t mode, uint16_t spi_BaudPrescaler, int slave, int bits);
+static SPI_Context_t* spi_get_context(SPI_t SPI_Num);
+static void spi_internal_init(SPI_Context_t* ctx);
+static uint32_t spi_get_pclk(SPI_t SPI_Num);
+static uint16_t spi_calc_prescaler(SPI_t SPI_Num, int hz, SPI_Clock_t policy, int* achieved);
+static uint16_t spi_calc_cr1(uint16_t cr1, SPI_Mode_t mode, int bits, uint16_t prescaler);
+static void spi_write_config(SPI_TypeDef* SPIx, uint16_t cr1, uint16_t cr2);
+
+#if SPI_PROF
+/* cond 가 참인 동안 기다리고, 기다린 시간을 waited 가 가리키는 곳에 더한다 */
+#define SSP_WAIT(cond, waited)      do { uint32_t t_ = SPI_PROF_TIMESTAMP(); while (cond); *(waited) += SPI_PROF_TIMESTAMP() - t_; } while (0)
+/* 전송마다 시작 시점과 상태 플래그를 폴링한 사이클 수를 지역 변수에 둔다.
+   여러 버스나 인터럽트에서 동시에 전송해도 서로의 값을 섞지 않는다 */
+#define SSP_PROF_BEGIN()            uint32_t prof_start = SPI_PROF_TIMESTAMP(), prof_waited = 0
+#define SSP_PROF_END(SPI_Num, bits) spi_prof_transfer((SPI_Num), (bits), prof_start, prof_waited)
+#define SSP_WAITED                  (&prof_waited)
+#else
+#define SSP_WAIT(cond, waited)      do { (void)(waited); while (cond); } while (0)
+#define SSP_PROF_BEGIN()
+#define SSP_PROF_END(SPI_Num, bits)
+#define SSP_WAITED                  NULL
+#endif
 
 void spi_init(SPI_t SPI_Num, SPI_PinsPack_t pack) {
+    SPI_Context_t *ctx = spi_get_context(SPI_Num);
 
     assert_param(IS_SPI_PINS_VALID(SPI_Num, pack));
+    if (ctx == NULL)
+        return;
 
     /* clock enable */
 #ifdef SPI1
@@ -83,8 +133,17 @@ void spi_init(SPI_t SPI_Num, SPI_PinsPack_t pack) {
     gpio_set_pinmode(spi_pins[pack].sclk, GPIO_PM_PULLUP);
 
     /* Do initialization */
-    //spi_internal_init((SPI_TypeDef *)SPI_Num, SPI_Mode3, SPI_BAUDRATEPRESCALER_256, SPI_MODE_MASTER, SPI_DATASIZE_8BIT);
-    spi_internal_init((SPI_TypeDef *)SPI_Num, SPI_Mode0, SPI_BAUDRATEPRESCALER_8, SPI_MODE_MASTER, SPI_DATASIZE_8BIT);
+    ctx->mode = SPI_Mode0;
+    ctx->bits = SPI_DATASIZE_8BIT;
+    ctx->slave = SPI_MODE_MASTER;
+    ctx->prescaler = SPI_BAUDRATEPRESCALER_8;
+    if (SPI_INIT_FREQUENCY > 0)
+        ctx->prescaler = spi_calc_prescaler(SPI_Num, SPI_INIT_FREQUENCY, SPI_CLOCK_BELOW, NULL);
+    spi_internal_init(ctx);
+#if SPI_PROF
+    /* 첫 전송의 시작 시각을 재기 전에 프로파일러의 사이클 카운터를 켠다 */
+    cyccnt_enable();
+#endif
 }
 
 void spi_deinit(SPI_t SPI_Num) {
@@ -132,66 +191,87 @@ void spi_deinit(SPI_t SPI_Num) {
 #endif
 }
 
-static void spi_internal_init(SPI_TypeDef* SPIx, SPI_Mode_t mode, uint16_t spi_BaudRatePrescaler, int slave, int bits) {
+SPI_HandleTypeDef* spi_get_handle(SPI_t SPI_Num) {
+    SPI_Context_t *ctx = spi_get_context(SPI_Num);
 
-    spiHandle.Instance = SPIx;
+    return (ctx != NULL) ? &ctx->handle : NULL;
+}
 
-    /* Fill SPI settings */
-    spiHandle.Init.Mode = slave;
-    spiHandle.Init.BaudRatePrescaler = spi_BaudRatePrescaler;
-    spiHandle.Init.Direction = SPI_DIRECTION_2LINES;
-    spiHandle.Init.CRCCalculation = SPI_CRCCALCULATION_DISABLE;
-    spiHandle.Init.CRCPolynomial = 7;
-    spiHandle.Init.DataSize = bits;
-    spiHandle.Init.FirstBit = SPI_FIRSTBIT_MSB;
-    spiHandle.Init.NSS = SPI_NSS_SOFT;
-    spiHandle.Init.TIMode = SPI_TIMODE_DISABLE;
+int spi_claim_dma(SPI_t SPI_Num, const void* owner) {
+    SPI_Context_t *ctx = spi_get_context(SPI_Num);
+    uint32_t primask;
+    int result = -1;
 
-    /* SPI mode */
-    if (mode == SPI_Mode0) {
-        spiHandle.Init.CLKPolarity = SPI_POLARITY_LOW;
-        spiHandle.Init.CLKPhase = SPI_PHASE_1EDGE;
-    } else if (mode == SPI_Mode1) {
-        spiHandle.Init.CLKPolarity = SPI_POLARITY_LOW;
-        spiHandle.Init.CLKPhase = SPI_PHASE_2EDGE;
-    } else if (mode == SPI_Mode2) {
-        spiHandle.Init.CLKPolarity = SPI_POLARITY_HIGH;
-        spiHandle.Init.CLKPhase = SPI_PHASE_1EDGE;
-    } else if (mode == SPI_Mode3) {
-        spiHandle.Init.CLKPolarity = SPI_POLARITY_HIGH;
-        spiHandle.Init.CLKPhase = SPI_PHASE_2EDGE;
+    if (ctx == NULL)
+        return -1;
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if (ctx->dma_owner == NULL || ctx->dma_owner == owner) {
+        ctx->dma_owner = owner;
+        result = 1;
     }
+    __set_PRIMASK(primask);
+    return result;
+}
 
-    __HAL_SPI_DISABLE(&spiHandle);
+void spi_release_dma(SPI_t SPI_Num, const void* owner) {
+    SPI_Context_t *ctx = spi_get_context(SPI_Num);
 
-    /* Do initialization */
-    HAL_SPI_Init(&spiHandle);
+    if (ctx != NULL && ctx->dma_owner == owner)
+        ctx->dma_owner = NULL;
+}
+
+static SPI_Context_t* spi_get_context(SPI_t SPI_Num) {
+    uint8_t i;
 
-    __HAL_SPI_ENABLE(&spiHandle);
+    for (i = 0; i < sizeof(spi_context) / sizeof(spi_context[0]); i++)
+        if (spi_context[i].handle.Instance == (SPI_TypeDef *)SPI_Num)
+            return &spi_context[i];
+    return NULL;
 }
 
-void spi_set_format(SPI_t SPI_Num, SPI_Mode_t mode, int slave, int bits) {
+static void spi_internal_init(SPI_Context_t* ctx) {
+    SPI_HandleTypeDef *hspi = &ctx->handle;
 
-    spi_mode = mode;
-    if (bits == 16) {
-        spi_bits = SPI_DATASIZE_16BIT;
-    } else {
-        spi_bits = SPI_DATASIZE_8BIT;
+    /* Fill SPI settings */
+    hspi->Init.Mode = ctx->slave;
+    hspi->Init.BaudRatePrescaler = ctx->prescaler;
+    hspi->Init.Direction = SPI_DIRECTION_2LINES;
+    hspi->Init.CRCCalculation = SPI_CRCCALCULATION_DISABLE;
+    hspi->Init.CRCPolynomial = 7;
+    hspi->Init.DataSize = ctx->bits;
+    hspi->Init.FirstBit = SPI_FIRSTBIT_MSB;
+    hspi->Init.NSS = SPI_NSS_SOFT;
+    hspi->Init.TIMode = SPI_TIMODE_DISABLE;
+
+    /* SPI mode */
+    if (ctx->mode == SPI_Mode0) {
+        hspi->Init.CLKPolarity = SPI_POLARITY_LOW;
+        hspi->Init.CLKPhase = SPI_PHASE_1EDGE;
+    } else if (ctx->mode == SPI_Mode1) {
+        hspi->Init.CLKPolarity = SPI_POLARITY_LOW;
+        hspi->Init.CLKPhase = SPI_PHASE_2EDGE;
+    } else if (ctx->mode == SPI_Mode2) {
+        hspi->Init.CLKPolarity = SPI_POLARITY_HIGH;
+        hspi->Init.CLKPhase = SPI_PHASE_1EDGE;
+    } else if (ctx->mode == SPI_Mode3) {
+        hspi->Init.CLKPolarity = SPI_POLARITY_HIGH;
+        hspi->Init.CLKPhase = SPI_PHASE_2EDGE;
     }
-    spi_slave = (slave) ? SPI_MODE_SLAVE : SPI_MODE_MASTER;
+
+    __HAL_SPI_DISABLE(hspi);
 
     /* Do initialization */
-    spi_internal_init((SPI_TypeDef *)SPI_Num, spi_mode, spi_baudrateprescaler, spi_slave, spi_bits);
+    HAL_SPI_Init(hspi);
+
+    __HAL_SPI_ENABLE(hspi);
 }
 
-void spi_set_frequency(SPI_t SPI_Num, int hz)
+static uint32_t spi_get_pclk(SPI_t SPI_Num)
 {
-    uint32_t apb_freq;
-    uint8_t i;
-
     /* Calculate max SPI clock */
     if (0
-#ifdef SPI1     
+#ifdef SPI1
         || SPI_Num == SPI_1
 #endif
 #ifdef SPI4
@@ -204,87 +284,442 @@ void spi_set_frequency(SPI_t SPI_Num, int hz)
         || SPI_Num == SPI_6
 #endif
     ) {
-        apb_freq = HAL_RCC_GetPCLK2Freq();
+        return HAL_RCC_GetPCLK2Freq();
     } else {
-        apb_freq = HAL_RCC_GetPCLK1Freq();
+        return HAL_RCC_GetPCLK1Freq();
     }
+}
+
+/* policy 에 따라 분주비를 골라 CR1 의 BR 비트 위치로 돌려주고, 실제 SCK 주파수를 *achieved 에 저장한다 */
+static uint16_t spi_calc_prescaler(SPI_t SPI_Num, int hz, SPI_Clock_t policy, int* achieved)
+{
+    uint32_t apb_freq = spi_get_pclk(SPI_Num);
+    uint32_t target = (hz > 0) ? hz : 0;
+    uint32_t freq, diff, bestdiff = 0xFFFFFFFF;
+    uint8_t i, best = 7;
 
     /* Calculate prescaler value */
     /* Bits 5:3 in CR1 SPI registers are prescalers */
     /* 000 = 2, 001 = 4, 002 = 8, ..., 111 = 256 */
-    for (i = 0; i < 8; i++)
-        if (apb_freq / (1 << (i + 1)) <= hz)
+    for (i = 0; i < 8; i++) {
+        freq = apb_freq >> (i + 1);
+        if (policy == SPI_CLOCK_NEAREST) {
+            /* 차이가 같으면 느린 쪽을 고른다 */
+            diff = (freq > target) ? freq - target : target - freq;
+            if (diff <= bestdiff) {
+                bestdiff = diff;
+                best = i;
+            }
+        } else if (freq <= target) {
+            best = i;
             break;
-    spi_baudrateprescaler = i << 3;
+        }
+    }
+    if (achieved != NULL)
+        *achieved = apb_freq >> (best + 1);
+    return best << 3;
+}
 
-    /* Do initialization */
-    spi_internal_init((SPI_TypeDef *)SPI_Num, spi_mode, spi_baudrateprescaler, spi_slave, spi_bits);
+/* CR1 에서 모드, 프레임 크기, 분주비 비트만 바꾼 값. SPE 는 지운다 */
+static uint16_t spi_calc_cr1(uint16_t cr1, SPI_Mode_t mode, int bits, uint16_t prescaler)
+{
+    cr1 &= ~(SPI_CR1_SPE | SPI_CR1_CPOL | SPI_CR1_CPHA | SPI_CR1_DFF | SPI_CR1_BR);
+    if (mode == SPI_Mode2 || mode == SPI_Mode3)
+        cr1 |= SPI_CR1_CPOL;
+    if (mode == SPI_Mode1 || mode == SPI_Mode3)
+        cr1 |= SPI_CR1_CPHA;
+    if (bits == SPI_DATASIZE_16BIT)
+        cr1 |= SPI_CR1_DFF;
+    return cr1 | (prescaler & SPI_CR1_BR);
+}
+
+/* 마스터이면 마지막 프레임이 나갈 때까지 기다린 후, SPI 를 끄고 CR1/CR2 를 직접 쓴다 */
+static void spi_write_config(SPI_TypeDef* SPIx, uint16_t cr1, uint16_t cr2)
+{
+    if ((SPIx->CR1 & (SPI_CR1_SPE | SPI_CR1_MSTR)) == (SPI_CR1_SPE | SPI_CR1_MSTR)) {
+        while (!(SPIx->SR & SPI_SR_TXE));
+        while (SPIx->SR & SPI_SR_BSY);
+    }
+    SPIx->CR1 = cr1 & ~SPI_CR1_SPE;
+    SPIx->CR2 = cr2;
+    SPIx->CR1 = cr1 | SPI_CR1_SPE;
+}
+
+void spi_set_format(SPI_t SPI_Num, SPI_Mode_t mode, int slave, int bits) {
+    SPI_Context_t *ctx = spi_get_context(SPI_Num);
+    SPI_TypeDef *SPIx = (SPI_TypeDef *)SPI_Num;
+
+    if (ctx == NULL)
+        return;
+    ctx->mode = mode;
+    if (bits == 16) {
+        ctx->bits = SPI_DATASIZE_16BIT;
+    } else {
+        ctx->bits = SPI_DATASIZE_8BIT;
+    }
+
+    /* 마스터/슬레이브 전환만 HAL 로 다시 초기화한다 */
+    if (ctx->slave != ((slave) ? SPI_MODE_SLAVE : SPI_MODE_MASTER)) {
+        ctx->slave = (slave) ? SPI_MODE_SLAVE : SPI_MODE_MASTER;
+        spi_internal_init(ctx);
+        return;
+    }
+    spi_write_config(SPIx, spi_calc_cr1(SPIx->CR1, ctx->mode, ctx->bits, ctx->prescaler), SPIx->CR2);
+}
+
+int spi_set_frequency(SPI_t SPI_Num, int hz)
+{
+    return spi_set_clock(SPI_Num, hz, SPI_CLOCK_BELOW);
+}
+
+int spi_set_clock(SPI_t SPI_Num, int hz, SPI_Clock_t policy)
+{
+    SPI_Context_t *ctx = spi_get_context(SPI_Num);
+    SPI_TypeDef *SPIx = (SPI_TypeDef *)SPI_Num;
+    int achieved;
+
+    if (ctx == NULL)
+        return -1;
+    ctx->prescaler = spi_calc_prescaler(SPI_Num, hz, policy, &achieved);
+    /* 분주비 비트만 바꾼다 */
+    spi_write_config(SPIx, spi_calc_cr1(SPIx->CR1, ctx->mode, ctx->bits, ctx->prescaler), SPIx->CR2);
+    return achieved;
+}
+
+int spi_get_frequency(SPI_t SPI_Num)
+{
+    SPI_TypeDef *SPIx = (SPI_TypeDef *)SPI_Num;
+
+    return spi_get_pclk(SPI_Num) >> (((SPIx->CR1 & SPI_CR1_BR) >> 3) + 1);
+}
+
+int spi_make_profile(SPI_t SPI_Num, SPI_Profile_t* profile, SPI_Mode_t mode, int bits, int hz)
+{
+    SPI_TypeDef *SPIx = (SPI_TypeDef *)SPI_Num;
+    uint16_t prescaler;
+    int achieved;
+
+    /* hz 는 장치의 최대 주파수이므로 넘지 않는 분주비를 고른다 */
+    prescaler = spi_calc_prescaler(SPI_Num, hz, SPI_CLOCK_BELOW, &achieved);
+    profile->cr1 = spi_calc_cr1(SPIx->CR1, mode, (bits == 16) ? SPI_DATASIZE_16BIT : SPI_DATASIZE_8BIT, prescaler);
+    profile->cr2 = SPIx->CR2 & ~(SPI_CR2_TXDMAEN | SPI_CR2_RXDMAEN);
+    profile->hz = achieved;
+    return achieved;
+}
+
+void spi_get_profile(SPI_t SPI_Num, SPI_Profile_t* profile)
+{
+    SPI_TypeDef *SPIx = (SPI_TypeDef *)SPI_Num;
+
+    profile->cr1 = SPIx->CR1 & ~SPI_CR1_SPE;
+    profile->cr2 = SPIx->CR2;
+    profile->hz = spi_get_frequency(SPI_Num);
+}
+
+int spi_set_profile(SPI_t SPI_Num, const SPI_Profile_t* profile)
+{
+    SPI_Context_t *ctx = spi_get_context(SPI_Num);
+    SPI_TypeDef *SPIx = (SPI_TypeDef *)SPI_Num;
+
+    if (ctx == NULL)
+        return -1;
+    /* 이미 같은 설정이면 아무것도 쓰지 않는다 */
+    if ((SPIx->CR1 & ~SPI_CR1_SPE) == profile->cr1 && SPIx->CR2 == profile->cr2)
+        return 0;
+    spi_write_config(SPIx, profile->cr1, profile->cr2);
+
+    /* 이후의 spi_set_format()/spi_set_frequency() 가 이 설정에서 시작하도록 문맥을 맞춘다 */
+    ctx->mode = (SPI_Mode_t)(((profile->cr1 & SPI_CR1_CPOL) ? 0x02 : 0) | ((profile->cr1 & SPI_CR1_CPHA) ? 0x01 : 0));
+    ctx->bits = (profile->cr1 & SPI_CR1_DFF) ? SPI_DATASIZE_16BIT : SPI_DATASIZE_8BIT;
+    ctx->prescaler = profile->cr1 & SPI_CR1_BR;
+    return 1;
+}
+
+/* 프레임 크기가 16비트인지 확인한다 */
+static inline int ssp_frame16(SPI_TypeDef *SPIx)
+{
+    return (SPIx->CR1 & SPI_CR1_DFF) ? 1 : 0;
 }
 
 static inline int ssp_readable(SPI_TypeDef *SPIx)
 {
-    int status;
-    spiHandle.Instance = SPIx;
     // Check if data is received
-    status = ((__HAL_SPI_GET_FLAG(&spiHandle, SPI_FLAG_RXNE) != RESET) ? 1 : 0);
-    return status;
+    return ((SPIx->SR & SPI_FLAG_RXNE) != RESET) ? 1 : 0;
 }
 
 static inline int ssp_writeable(SPI_TypeDef *SPIx)
 {
-    int status;
-    spiHandle.Instance = SPIx;
     // Check if data is transmitted
-    status = ((__HAL_SPI_GET_FLAG(&spiHandle, SPI_FLAG_TXE) != RESET) ? 1 : 0);
-    return status;
+    return ((SPIx->SR & SPI_FLAG_TXE) != RESET) ? 1 : 0;
 }
 
-static inline void ssp_write(SPI_t SPI_Num, int value)
+static inline void ssp_write(SPI_t SPI_Num, int value, uint32_t *waited)
 {
     SPI_TypeDef *SPIx = (SPI_TypeDef *)SPI_Num;
-    while (!ssp_writeable(SPIx));
+    SSP_WAIT(!ssp_writeable(SPIx), waited);
     SPIx->DR = (uint16_t)value;
 }
 
-static inline int ssp_read(SPI_t SPI_Num)
+static inline int ssp_read(SPI_t SPI_Num, uint32_t *waited)
 {
     SPI_TypeDef *SPIx = (SPI_TypeDef *)SPI_Num;
-    while (!ssp_readable(SPIx));
+    SSP_WAIT(!ssp_readable(SPIx), waited);
     //return (int)(__IO uint8_t *)&SPIx->DR;
     return (int)SPIx->DR;
 }
 
 static inline int ssp_busy(SPI_TypeDef *SPIx)
 {
-    int status;
-    spiHandle.Instance = SPIx;
-    status = ((__HAL_SPI_GET_FLAG(&spiHandle, SPI_FLAG_BSY) != RESET) ? 1 : 0);
-    return status;
+    return ((SPIx->SR & SPI_FLAG_BSY) != RESET) ? 1 : 0;
 }
 
 int spi_writeread(SPI_t SPI_Num, int value)
 {
-    ssp_write(SPI_Num, value);
-    return ssp_read(SPI_Num);
+    SSP_PROF_BEGIN();
+
+    ssp_write(SPI_Num, value, SSP_WAITED);
+    value = ssp_read(SPI_Num, SSP_WAITED);
+    SSP_PROF_END(SPI_Num, ssp_frame16((SPI_TypeDef *)SPI_Num) ? 16 : 8);
+    return value;
 }
 
 int spi_read(SPI_t SPI_Num)
 {
     SPI_TypeDef *SPIx = (SPI_TypeDef *)SPI_Num;
-    while (!ssp_readable(SPIx));
+    int value;
+    SSP_PROF_BEGIN();
+
+    SSP_WAIT(!ssp_readable(SPIx), SSP_WAITED);
     //return (int)*(__IO uint8_t *)&SPIx->DR;
-    return (int)SPIx->DR;
+    value = (int)SPIx->DR;
+    /* 프레임은 앞선 spi_write() 에서 이미 센다 */
+    SSP_PROF_END(SPI_Num, 0);
+    return value;
 }
 
 void spi_write(SPI_t SPI_Num, int value)
 {
     SPI_TypeDef *SPIx = (SPI_TypeDef *)SPI_Num;
-    while (!ssp_writeable(SPIx));
+    SSP_PROF_BEGIN();
+
+    SSP_WAIT(!ssp_writeable(SPIx), SSP_WAITED);
     //*(__IO uint8_t *)&SPIx->DR = (uint8_t)value;
-    SPIx->DR = (uint8_t)value;
+    SPIx->DR = (uint16_t)value;
+    SSP_PROF_END(SPI_Num, ssp_frame16(SPIx) ? 16 : 8);
 }
 
 int spi_busy(SPI_t SPI_Num)
 {
     return ssp_busy((SPI_TypeDef *)SPI_Num);
 }
+
+/* 남은 수신 데이터를 버리고, DR 과 SR 을 차례로 읽어 OVR 플래그를 지운다 */
+static inline void ssp_flush(SPI_TypeDef *SPIx)
+{
+    volatile uint32_t tmp;
+
+    tmp = SPIx->DR;
+    tmp = SPIx->SR;
+    (void)tmp;
+}
+
+/* 마지막 프레임이 나갈 때까지 기다린 후 송신 중에 쌓인 수신 데이터를 버린다 */
+static inline void ssp_finish(SPI_TypeDef *SPIx, uint32_t *waited)
+{
+    SSP_WAIT(!(SPIx->SR & SPI_SR_TXE), waited);
+    SSP_WAIT(SPIx->SR & SPI_SR_BSY, waited);
+    ssp_flush(SPIx);
+}
+
+/* 송신 버퍼를 채우면서 수신 데이터를 꺼낸다. tx 가 NULL 이면 fill 값을 보낸다 */
+static int ssp_exchange(SPI_TypeDef *SPIx, const void *tx, int fill, void *rx, int length, uint32_t *waited)
+{
+    int wide = ssp_frame16(SPIx);
+    int sent = 0, received = 0;
+    uint32_t sr;
+    uint16_t value;
+#if SPI_PROF
+    uint32_t polled = SPI_PROF_TIMESTAMP(), now;
+    int done = -1;
+#endif
+
+    ssp_flush(SPIx);
+    while (received < length) {
+#if SPI_PROF
+        /* 보내지도 받지도 못한 반복은 플래그를 기다린 시간이다 */
+        now = SPI_PROF_TIMESTAMP();
+        if (sent + received == done)
+            *waited += now - polled;
+        polled = now;
+        done = sent + received;
+#endif
+        sr = SPIx->SR;
+        if (sr & SPI_SR_OVR) {
+            /* 인터럽트 등으로 늦게 읽어 프레임을 잃었다 */
+            ssp_finish(SPIx, waited);
+            return -1;
+        }
+        /* 시프트 레지스터와 송신 버퍼에 한 프레임씩, 최대 두 프레임만 앞서 보낸다 */
+        if ((sr & SPI_SR_TXE) && sent < length && sent - received < 2) {
+            if (tx == NULL)
+                value = (uint16_t)fill;
+            else
+                value = wide ? ((const uint16_t *)tx)[sent] : ((const uint8_t *)tx)[sent];
+            SPIx->DR = value;
+            sent++;
+        }
+        if (sr & SPI_SR_RXNE) {
+            value = (uint16_t)SPIx->DR;
+            if (wide)
+                ((uint16_t *)rx)[received] = value;
+            else
+                ((uint8_t *)rx)[received] = (uint8_t)value;
+            received++;
+        }
+    }
+    return 1;
+}
+
+void spi_nwrite(SPI_t SPI_Num, const void* data, int length)
+{
+    SPI_TypeDef *SPIx = (SPI_TypeDef *)SPI_Num;
+    int wide = ssp_frame16(SPIx);
+    int i;
+    SSP_PROF_BEGIN();
+
+    /* 수신은 무시하고 송신 버퍼가 빌 때마다 바로 채운다 */
+    if (wide) {
+        for (i = 0; i < length; i++) {
+            SSP_WAIT(!(SPIx->SR & SPI_SR_TXE), SSP_WAITED);
+            SPIx->DR = ((const uint16_t *)data)[i];
+        }
+    } else {
+        for (i = 0; i < length; i++) {
+            SSP_WAIT(!(SPIx->SR & SPI_SR_TXE), SSP_WAITED);
+            SPIx->DR = ((const uint8_t *)data)[i];
+        }
+    }
+    ssp_finish(SPIx, SSP_WAITED);
+    SSP_PROF_END(SPI_Num, (uint32_t)length * (wide ? 16 : 8));
+}
+
+int spi_nread(SPI_t SPI_Num, void* data, int length, int fill)
+{
+    SPI_TypeDef *SPIx = (SPI_TypeDef *)SPI_Num;
+    int ret;
+    SSP_PROF_BEGIN();
+
+    ret = ssp_exchange(SPIx, NULL, fill, data, length, SSP_WAITED);
+    SSP_PROF_END(SPI_Num, (uint32_t)length * (ssp_frame16(SPIx) ? 16 : 8));
+    return ret;
+}
+
+int spi_nwriteread(SPI_t SPI_Num, const void* tx, void* rx, int length)
+{
+    SPI_TypeDef *SPIx = (SPI_TypeDef *)SPI_Num;
+    int ret;
+    SSP_PROF_BEGIN();
+
+    ret = ssp_exchange(SPIx, tx, 0, rx, length, SSP_WAITED);
+    SSP_PROF_END(SPI_Num, (uint32_t)length * (ssp_frame16(SPIx) ? 16 : 8));
+    return ret;
+}
+
+void spi_nfill(SPI_t SPI_Num, const void* pattern, int size, int count)
+{
+    SPI_TypeDef *SPIx = (SPI_TypeDef *)SPI_Num;
+    int wide = ssp_frame16(SPIx);
+    int i, n;
+    SSP_PROF_BEGIN();
+
+    if (size <= 0 || count <= 0)
+        return;
+    /* 패턴을 count 번 반복하여 보낸다 */
+    for (n = 0; n < count; n++) {
+        for (i = 0; i < size; i++) {
+            SSP_WAIT(!(SPIx->SR & SPI_SR_TXE), SSP_WAITED);
+            SPIx->DR = wide ? ((const uint16_t *)pattern)[i] : ((const uint8_t *)pattern)[i];
+        }
+    }
+    ssp_finish(SPIx, SSP_WAITED);
+    SSP_PROF_END(SPI_Num, (uint32_t)size * count * (wide ? 16 : 8));
+}
+
+/* 16비트 픽셀을 보낸다. step 이 0 이면 같은 픽셀을 반복하고, swap 이면 하위 바이트를 먼저 보낸다 */
+static void ssp_pixels(SPI_TypeDef *SPIx, const uint16_t *pixels, int step, int count, int swap, uint32_t *waited)
+{
+    uint16_t cr1 = SPIx->CR1;
+    uint16_t pixel;
+
+    if (count <= 0)
+        return;
+#if SPI_PIXEL_FRAME16
+    /* 픽셀 하나를 16비트 프레임 하나로 보내 DR 쓰기와 TXE 확인을 절반으로 줄인다 */
+    if (!(cr1 & SPI_CR1_DFF))
+        spi_write_config(SPIx, cr1 | SPI_CR1_DFF, SPIx->CR2);
+    while (count--) {
+        pixel = *pixels;
+        pixels += step;
+        if (swap)
+            pixel = (uint16_t)((pixel << 8) | (pixel >> 8));
+        SSP_WAIT(!(SPIx->SR & SPI_SR_TXE), waited);
+        SPIx->DR = pixel;
+    }
+#else
+    /* 8비트 프레임 두 개로 나누어 보낸다 */
+    if (cr1 & SPI_CR1_DFF)
+        spi_write_config(SPIx, cr1 & ~SPI_CR1_DFF, SPIx->CR2);
+    while (count--) {
+        pixel = *pixels;
+        pixels += step;
+        if (swap)
+            pixel = (uint16_t)((pixel << 8) | (pixel >> 8));
+        SSP_WAIT(!(SPIx->SR & SPI_SR_TXE), waited);
+        SPIx->DR = pixel >> 8;
+        SSP_WAIT(!(SPIx->SR & SPI_SR_TXE), waited);
+        SPIx->DR = pixel & 0xFF;
+    }
+#endif
+    ssp_finish(SPIx, waited);
+    /* 원래 프레임 크기로 되돌린다 */
+    if ((SPIx->CR1 ^ cr1) & SPI_CR1_DFF)
+        spi_write_config(SPIx, cr1, SPIx->CR2);
+}
+
+void spi_write_pixels(SPI_t SPI_Num, const uint16_t* pixels, int count, SPI_PixelOrder_t order)
+{
+    SSP_PROF_BEGIN();
+
+    ssp_pixels((SPI_TypeDef *)SPI_Num, pixels, 1, count, order == SPI_PIXEL_LSB_FIRST, SSP_WAITED);
+    SSP_PROF_END(SPI_Num, (count > 0) ? (uint32_t)count * 16 : 0);
+}
+
+void spi_fill_pixels(SPI_t SPI_Num, uint16_t pixel, int count)
+{
+    SSP_PROF_BEGIN();
+
+    ssp_pixels((SPI_TypeDef *)SPI_Num, &pixel, 0, count, 0, SSP_WAITED);
+    SSP_PROF_END(SPI_Num, (count > 0) ? (uint32_t)count * 16 : 0);
+}
+
+void spi_select(SPI_t SPI_Num, GPIO_Pin_t cs)
+{
+#if SPI_PROF
+    spi_prof_select(SPI_Num, cs);
+#else
+    (void)SPI_Num;
+#endif
+    if (cs != GPIO_NC)
+        gpio_write(cs, 0);
+}
+
+void spi_deselect(SPI_t SPI_Num, GPIO_Pin_t cs)
+{
+    if (cs != GPIO_NC)
+        gpio_write(cs, 1);
+#if SPI_PROF
+    spi_prof_deselect(SPI_Num);
+#else
+    (void)SPI_Num;
+#endif
+}
@@ -61,10 +61,12 @@ extern "C" {
 \verbatim
  - STM32F4xx HAL
  - GPIO
+ - string.h
 \endverbatim
  */
 #include "stm32f4xx_hal.h"
 #include "../stm32lib/gpio.h"
+#include "string.h"
 
 /**
  * @defgroup SPI_매크로
@@ -72,6 +74,30 @@ extern "C" {
  * @{
  */
 
+/**
+ * @brief  spi_init() 에서 설정할 SCK 주파수
+ * @note   0 이면 APB 클럭의 1/8 을 사용한다. 0 보다 크면 이 값을 넘지 않는 가장 빠른 분주비를 고른다
+ */
+#ifndef SPI_INIT_FREQUENCY
+#define SPI_INIT_FREQUENCY   0
+#endif
+
+/**
+ * @brief  @ref spi_write_pixels()/@ref spi_fill_pixels() 가 픽셀 하나를 16비트 프레임 하나로 보낸다
+ * @note   0 이면 8비트 프레임 두 개로 나누어 보낸다. 선로의 데이터는 같고 DR 쓰기 수만 두 배가 된다
+ */
+#ifndef SPI_PIXEL_FRAME16
+#define SPI_PIXEL_FRAME16    1
+#endif
+
+/**
+ * @brief  1 로 정의하면 블로킹 전송마다 바이트 수, 폴링 대기 시간, CS 유지 시간을 @ref SPIPROF 에 기록한다.
+ *         0 이면 계측 코드가 만들어지지 않는다
+ */
+#ifndef SPI_PROF
+#define SPI_PROF             0
+#endif
+
 /**
  * @}
  */
@@ -138,6 +164,33 @@ typedef enum {
     SPI3_PINS2 = 5,  /*!< SPI3, PC_12(MOSI), PC_11(MISO), PC_10(SCLK) */
 } SPI_PinsPack_t;
 
+/**
+ * @brief SPI 장치 설정(프로파일) 자료형
+ * @note  한 버스에 설정이 다른 장치들이 있을 때 장치마다 하나씩 만들어 두고
+ *        @ref spi_set_profile() 로 레지스터만 바꾸어 전환한다
+ */
+typedef struct {
+    uint16_t cr1;     /*!< CR1 레지스터 값 (SPE 제외) */
+    uint16_t cr2;     /*!< CR2 레지스터 값 */
+    uint32_t hz;      /*!< 이 프로파일의 실제 SCK 주파수 */
+} SPI_Profile_t;
+
+/**
+ * @brief SPI 분주비 선택 방법 열거형
+ */
+typedef enum {
+    SPI_CLOCK_BELOW = 0,  /*!< 원하는 주파수를 넘지 않는 가장 빠른 주파수. 모두 넘으면 1/256 */
+    SPI_CLOCK_NEAREST,    /*!< 원하는 주파수에 가장 가까운 주파수. 차이가 같으면 느린 쪽 */
+} SPI_Clock_t;
+
+/**
+ * @brief 16비트 픽셀의 바이트 순서 열거형
+ */
+typedef enum {
+    SPI_PIXEL_MSB_FIRST = 0,  /*!< 픽셀 값의 상위 바이트를 먼저 보낸다. RGB565 를 받는 대부분의 디스플레이 */
+    SPI_PIXEL_LSB_FIRST,      /*!< 하위 바이트를 먼저 보낸다. 선로 순서의 바이트 배열로 저장된 이미지 */
+} SPI_PixelOrder_t;
+
 /**
  * @}
  */
@@ -168,22 +221,94 @@ void spi_deinit(SPI_t SPI_Num);
 /**
  * @brief  Sets format settings to SPI pin(s)
  * @note   Pins HAVE to be initialized first using @ref SPI_Init() function
+ * @note   Only a master/slave change runs HAL_SPI_Init; mode and frame size are written to CR1 directly.
  * @param  SPI_Num: Select SPI Num.
  * @param  SPI_Mode: Clock polarity & phase option. This parameter can be a value of @ref SPI_Mode_t enumeration
  * @param  slave: master or slave mode.
- * @param  bits: Number of bits per SPI frame (4 - 16)
+ * @param  bits: Number of bits per SPI frame (8 or 16)
  * @retval None
  */
 void spi_set_format(SPI_t SPI_Num, SPI_Mode_t mode, int slave, int bits);
 
 /**
  * @brief  Set the clock frequency for the SPI bus.
+ * @note   Picks the fastest prescaler not exceeding hz. Only the BR bits of CR1 are rewritten; HAL_SPI_Init is not called.
  * @param  SPI_Num: Select SPI Num.
  * @param  hz: SCLK frequency in hz
- * @retval None
+ * @retval Achieved SCLK frequency in hz, -1 on error
+ */
+int spi_set_frequency(SPI_t SPI_Num, int hz);
+
+/**
+ * @brief  선택 방법에 따라 분주비를 골라 SCK 주파수를 설정한다
+ * @param  SPI_Num: 선택할 SPI 번호
+ * @param  hz: 원하는 SCK 주파수
+ * @param  policy: 분주비 선택 방법. @ref SPI_Clock_t
+ * @retval 실제 SCK 주파수, -1: 오류
+ */
+int spi_set_clock(SPI_t SPI_Num, int hz, SPI_Clock_t policy);
+
+/**
+ * @brief  현재 SCK 주파수를 얻는다
+ * @param  SPI_Num: 선택할 SPI 번호
+ * @retval APB 클럭과 CR1 의 분주비로 계산한 SCK 주파수
+ */
+int spi_get_frequency(SPI_t SPI_Num);
+
+/**
+ * @brief  모드, 프레임 크기, 주파수로부터 장치 프로파일을 계산한다. 하드웨어는 바꾸지 않는다
+ * @note   버스는 먼저 @ref spi_init() 로 초기화되어야 한다. 마스터/NSS 설정은 현재 버스 설정을 따른다
+ * @param  SPI_Num: 선택할 SPI 번호
+ * @param  *profile: 계산한 값을 저장할 @ref SPI_Profile_t 구조체의 포인터
+ * @param  mode: 클럭 극성과 위상. @ref SPI_Mode_t
+ * @param  bits: 프레임 비트 수, 8 또는 16
+ * @param  hz: 장치의 최대 SCK 주파수. 이 값을 넘지 않는 가장 빠른 분주비를 사용한다
+ * @retval 실제 SCK 주파수. profile->hz 에도 저장된다
+ */
+int spi_make_profile(SPI_t SPI_Num, SPI_Profile_t* profile, SPI_Mode_t mode, int bits, int hz);
+
+/**
+ * @brief  버스의 현재 설정을 프로파일로 읽는다
+ * @param  SPI_Num: 선택할 SPI 번호
+ * @param  *profile: 현재 설정을 저장할 @ref SPI_Profile_t 구조체의 포인터
+ * @retval 없음
+ */
+void spi_get_profile(SPI_t SPI_Num, SPI_Profile_t* profile);
+
+/**
+ * @brief  프로파일을 버스에 적용한다
+ * @note   진행 중인 프레임이 끝나기를 기다린 후 SPI 를 끄고 CR1/CR2 를 직접 쓴다.
+ *         버스가 이미 같은 설정이면 레지스터를 쓰지 않는다
+ * @param  SPI_Num: 선택할 SPI 번호
+ * @param  *profile: 적용할 프로파일
+ * @retval 실행 상태, 1: 설정을 바꿈, 0: 이미 같은 설정, -1: 오류
+ */
+int spi_set_profile(SPI_t SPI_Num, const SPI_Profile_t* profile);
+
+/**
+ * @brief  SPI 버스의 HAL 핸들을 얻는다
+ * @note   HAL DMA/인터럽트 함수를 함께 사용할 때 필요하다
+ * @param  SPI_Num: 선택할 SPI 번호
+ * @retval HAL 핸들의 포인터, 지원하지 않는 버스이면 NULL
+ */
+SPI_HandleTypeDef* spi_get_handle(SPI_t SPI_Num);
+
+/**
+ * @brief  버스의 DMA 스트림을 점유한다
+ * @note   SPIASYNC 와 SPISLAVE 는 같은 DMA 스트림을 쓰므로 한 버스에서 하나만 사용할 수 있다
+ * @param  SPI_Num: 선택할 SPI 번호
+ * @param  *owner: 점유하는 모듈을 나타내는 주소
+ * @retval 실행 상태, 1: 정상, -1: 오류(다른 모듈이 점유 중이거나 지원하지 않는 버스)
+ */
+int spi_claim_dma(SPI_t SPI_Num, const void* owner);
+
+/**
+ * @brief  @ref spi_claim_dma() 로 점유한 DMA 스트림을 놓는다
+ * @param  SPI_Num: 선택할 SPI 번호
+ * @param  *owner: 점유할 때 사용한 주소
+ * @retval 없음
  */
-//void gpio_write(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, uint16_t PinState);
-void spi_set_frequency(SPI_t SPI_Num, int hz);
+void spi_release_dma(SPI_t SPI_Num, const void* owner);
 
 /**
  * @brief  Write the SPI Slave and return the response.
@@ -202,6 +327,7 @@ int spi_read(SPI_t SPI_Num);
 
 /**
  * @brief  Write the SPI Slave.
+ * @note   프레임 크기가 16비트이면 value 의 하위 16비트를 모두 보낸다
  * @param  SPI_Num: Select SPI Num.
  * @param  value: value to be written.
  * @retval None
@@ -215,6 +341,89 @@ void spi_write(SPI_t SPI_Num, int value);
  */
 int spi_busy(SPI_t SPI_Num);
 
+/**
+ * @brief  버퍼의 데이터를 쉬지 않고 연속으로 보낸다. 수신 데이터는 버린다
+ * @note   프레임 크기가 16비트이면 data 는 uint16_t 배열이다. 반환할 때는 마지막 프레임까지 모두 나간 상태이다
+ * @param  SPI_Num: 선택할 SPI 번호
+ * @param  data: 보낼 데이터
+ * @param  length: 보낼 프레임 수
+ * @retval 없음
+ */
+void spi_nwrite(SPI_t SPI_Num, const void* data, int length);
+
+/**
+ * @brief  fill 값을 보내면서 length 프레임을 연속으로 받는다
+ * @note   프레임 크기가 16비트이면 data 는 uint16_t 배열이다
+ * @param  SPI_Num: 선택할 SPI 번호
+ * @param  data: 받은 데이터를 저장할 버퍼
+ * @param  length: 받을 프레임 수
+ * @param  fill: 받는 동안 보낼 값. 보통 0xFF
+ * @retval 실행 상태, 1: 정상, -1: 수신 오버런으로 프레임을 잃음
+ */
+int spi_nread(SPI_t SPI_Num, void* data, int length, int fill);
+
+/**
+ * @brief  tx 버퍼를 보내면서 같은 수의 프레임을 rx 버퍼로 받는다(전이중)
+ * @note   프레임 크기가 16비트이면 tx, rx 는 uint16_t 배열이다. tx 와 rx 는 같은 버퍼여도 된다
+ * @param  SPI_Num: 선택할 SPI 번호
+ * @param  tx: 보낼 데이터
+ * @param  rx: 받은 데이터를 저장할 버퍼
+ * @param  length: 주고 받을 프레임 수
+ * @retval 실행 상태, 1: 정상, -1: 수신 오버런으로 프레임을 잃음
+ */
+int spi_nwriteread(SPI_t SPI_Num, const void* tx, void* rx, int length);
+
+/**
+ * @brief  size 프레임짜리 패턴을 count 번 반복하여 보낸다. 수신 데이터는 버린다
+ * @note   화면을 한 색으로 채울 때처럼 같은 값을 많이 보낼 때 버퍼 없이 사용한다
+ * @param  SPI_Num: 선택할 SPI 번호
+ * @param  pattern: 반복할 패턴. 프레임 크기가 16비트이면 uint16_t 배열이다
+ * @param  size: 패턴의 프레임 수
+ * @param  count: 반복 횟수
+ * @retval 없음
+ */
+void spi_nfill(SPI_t SPI_Num, const void* pattern, int size, int count);
+
+/**
+ * @brief  16비트 픽셀 배열을 지정한 바이트 순서로 연속해서 보낸다. 수신 데이터는 버린다
+ * @note   버스의 프레임 크기와 관계없이 동작하며, 반환할 때는 원래 프레임 크기로 되돌린다.
+ *         @ref SPI_PIXEL_FRAME16 이 1 이면 16비트 프레임을 사용하여 DR 쓰기 수를 절반으로 줄인다.
+ *         DMA 로 보낼 때에는 16비트 장치(@ref spi_async_device() 의 bits = 16)가 MSB 먼저 순서로 보낸다
+ * @param  SPI_Num: 선택할 SPI 번호
+ * @param  pixels: 보낼 픽셀 배열
+ * @param  count: 픽셀 수
+ * @param  order: 바이트 순서. @ref SPI_PixelOrder_t
+ * @retval 없음
+ */
+void spi_write_pixels(SPI_t SPI_Num, const uint16_t* pixels, int count, SPI_PixelOrder_t order);
+
+/**
+ * @brief  같은 16비트 픽셀을 count 번 보낸다. 상위 바이트를 먼저 보낸다
+ * @note   화면이나 사각형을 한 색으로 채울 때 사용한다
+ * @param  SPI_Num: 선택할 SPI 번호
+ * @param  pixel: 보낼 픽셀 값
+ * @param  count: 반복 횟수
+ * @retval 없음
+ */
+void spi_fill_pixels(SPI_t SPI_Num, uint16_t pixel, int count);
+
+/**
+ * @brief  CS 를 내려 장치와의 트랜잭션을 시작한다
+ * @note   @ref SPI_PROF 가 1 이면 @ref spi_deselect() 까지의 전송을 이 장치의 트랜잭션 하나로 기록한다
+ * @param  SPI_Num: 선택할 SPI 번호
+ * @param  cs: CS 핀. GPIO_NC 이면 핀은 건드리지 않는다
+ * @retval 없음
+ */
+void spi_select(SPI_t SPI_Num, GPIO_Pin_t cs);
+
+/**
+ * @brief  CS 를 올려 트랜잭션을 끝낸다
+ * @param  SPI_Num: 선택할 SPI 번호
+ * @param  cs: CS 핀. GPIO_NC 이면 핀은 건드리지 않는다
+ * @retval 없음
+ */
+void spi_deselect(SPI_t SPI_Num, GPIO_Pin_t cs);
+
 /**
  * @}
  */
@@ -0,0 +1,510 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+#include "../stm32lib/spiasync.h"
+
+#include "../stm32lib/cmsis_nvic.h"
+#include "../stm32lib/cyccnt.h"
+
+/* Private SPI DMA stream structure */
+typedef struct {
+    SPI_t spi;
+    DMA_TypeDef *dma;
+    DMA_Stream_TypeDef *rx;
+    DMA_Stream_TypeDef *tx;
+    uint8_t rxstream;   /* 플래그 위치를 찾기 위한 스트림 번호 */
+    uint8_t txstream;
+    uint8_t channel;
+    IRQn_Type irq;
+} SPI_AsyncDMA_t;
+
+/* Private SPI async bus structure */
+typedef struct {
+    const SPI_AsyncDMA_t *dma;  /* NULL 이면 초기화되지 않음 */
+    SPI_Async_t *head;          /* 큐의 첫 기술자 */
+    SPI_Async_t *tail;
+    SPI_Async_t *active;        /* DMA 가 전송 중인 기술자 */
+    SPI_Device_t *selected;     /* CS 를 low 로 유지하고 있는 장치 */
+    uint16_t fill;              /* 송신 버퍼가 없을 때 보내는 값 */
+    uint16_t dummy;             /* 수신 버퍼가 없을 때 받는 곳 */
+    SPI_AsyncStats_t stats;
+} SPI_AsyncBus_t;
+
+/* Private variable */
+static const SPI_AsyncDMA_t spi_async_dma[] = {
+#ifdef SPI1
+    {SPI_1, DMA2, DMA2_Stream0, DMA2_Stream3, 0, 3, 3, DMA2_Stream0_IRQn},
+#endif
+#ifdef SPI2
+    {SPI_2, DMA1, DMA1_Stream3, DMA1_Stream4, 3, 4, 0, DMA1_Stream3_IRQn},
+#endif
+#ifdef SPI3
+    {SPI_3, DMA1, DMA1_Stream0, DMA1_Stream5, 0, 5, 0, DMA1_Stream0_IRQn},
+#endif
+};
+static SPI_AsyncBus_t spi_async_bus[3];
+
+/* DMA 스트림 번호에 따른 LISR/HISR 안의 플래그 위치 */
+static const uint8_t spi_async_flag_shift[4] = {0, 6, 16, 22};
+#define SPI_ASYNC_DMA_FLAGS     0x3DU   /* FEIF, DMEIF, TEIF, HTIF, TCIF */
+#define SPI_ASYNC_DMA_TEIF      0x08U
+#define SPI_ASYNC_DMA_TCIF      0x20U
+
+/* Private functions */
+static SPI_AsyncBus_t* spi_async_find(SPI_t SPI_Num);
+static uint32_t spi_async_flags(DMA_TypeDef* dma, uint8_t stream);
+static void spi_async_clear_flags(DMA_TypeDef* dma, uint8_t stream);
+static void spi_async_start(SPI_AsyncBus_t* bus);
+static void spi_async_finish(SPI_AsyncBus_t* bus, int result);
+#if NVIC_RAM_IRQVECTOR
+static void spi_async_dma_handler1(void);
+static void spi_async_dma_handler2(void);
+static void spi_async_dma_handler3(void);
+#endif
+
+int spi_async_init(SPI_t SPI_Num)
+{
+    const SPI_AsyncDMA_t *dma = NULL;
+    SPI_AsyncBus_t *bus;
+    uint8_t i;
+
+    if (spi_async_find(SPI_Num) != NULL)
+        return 1;
+    for (i = 0; i < sizeof(spi_async_dma) / sizeof(spi_async_dma[0]); i++)
+        if (spi_async_dma[i].spi == SPI_Num)
+            dma = &spi_async_dma[i];
+    /* 같은 DMA 스트림을 쓰는 SPISLAVE 가 사용 중인 버스는 받지 않는다 */
+    if (dma == NULL || spi_claim_dma(SPI_Num, spi_async_bus) < 0)
+        return -1;
+
+    for (i = 0; i < sizeof(spi_async_bus) / sizeof(spi_async_bus[0]); i++) {
+        bus = &spi_async_bus[i];
+        if (bus->dma != NULL)
+            continue;
+        memset(bus, 0, sizeof(SPI_AsyncBus_t));
+        bus->dma = dma;
+        bus->fill = 0xFFFF;
+
+        /* 대기 시간과 전송 시간을 잴 사이클 카운터 */
+        cyccnt_enable();
+
+        /* DMA 스트림을 멈추고 남은 플래그를 지운다 */
+        if (dma->dma == DMA1)
+            __HAL_RCC_DMA1_CLK_ENABLE();
+        else
+            __HAL_RCC_DMA2_CLK_ENABLE();
+        dma->rx->CR = 0;
+        dma->tx->CR = 0;
+        spi_async_clear_flags(dma->dma, dma->rxstream);
+        spi_async_clear_flags(dma->dma, dma->txstream);
+
+#if NVIC_RAM_IRQVECTOR
+#ifdef SPI1
+        if (SPI_Num == SPI_1)
+            NVIC_SetVector(dma->irq, (uint32_t)&spi_async_dma_handler1);
+#endif
+#ifdef SPI2
+        if (SPI_Num == SPI_2)
+            NVIC_SetVector(dma->irq, (uint32_t)&spi_async_dma_handler2);
+#endif
+#ifdef SPI3
+        if (SPI_Num == SPI_3)
+            NVIC_SetVector(dma->irq, (uint32_t)&spi_async_dma_handler3);
+#endif
+#endif
+        /* Add to NVIC */
+        HAL_NVIC_SetPriority(dma->irq, SPI_ASYNC_NVIC_PRIORITY, 0);
+        NVIC_EnableIRQ(dma->irq);
+        return 1;
+    }
+    spi_release_dma(SPI_Num, spi_async_bus);
+    return -1;
+}
+
+void spi_async_device(SPI_Device_t* dev, SPI_t SPI_Num, GPIO_Pin_t cs, GPIO_Pin_t dc, SPI_Mode_t mode, uint32_t hz, int bits)
+{
+    memset(dev, 0, sizeof(SPI_Device_t));
+    dev->bus = SPI_Num;
+    dev->cs = cs;
+    dev->dc = dc;
+    dev->mode = mode;
+    dev->bits = (bits == 16) ? 16 : 8;
+    spi_async_device_frequency(dev, hz);
+
+    if (cs != GPIO_NC) {
+        gpio_init(cs, GPIO_OUT);
+        gpio_write(cs, 1);
+    }
+    if (dc != GPIO_NC)
+        gpio_init(dc, GPIO_OUT);
+}
+
+uint32_t spi_async_device_frequency(SPI_Device_t* dev, uint32_t hz)
+{
+    SPI_Profile_t profile;
+
+    /* 최대 주파수를 넘지 않는 분주비로 장치의 CR1 을 다시 계산한다 */
+    dev->maxhz = hz;
+    dev->hz = spi_make_profile(dev->bus, &profile, dev->mode, dev->bits, hz);
+    dev->cr1 = profile.cr1;
+    return dev->hz;
+}
+
+int spi_async_submit(SPI_Async_t* xfer)
+{
+    SPI_AsyncBus_t *bus = spi_async_find(xfer->dev->bus);
+    uint32_t primask;
+    uint8_t idle;
+
+    if (bus == NULL || xfer->state == SPI_ASYNC_PENDING || xfer->length == 0)
+        return -1;
+
+    xfer->state = SPI_ASYNC_PENDING;
+    xfer->next = NULL;
+    xfer->queued = SPI_ASYNC_TIMESTAMP();
+
+    /* 인터럽트에서 큐를 바꾸지 못하도록 막고 큐 끝에 넣는다 */
+    primask = __get_PRIMASK();
+    __disable_irq();
+    idle = (bus->head == NULL);
+    if (idle)
+        bus->head = xfer;
+    else
+        bus->tail->next = xfer;
+    bus->tail = xfer;
+    bus->stats.submitted++;
+    if (++bus->stats.depth > bus->stats.maxdepth)
+        bus->stats.maxdepth = bus->stats.depth;
+    __set_PRIMASK(primask);
+
+    /* 버스가 비어 있었으면 바로 시작한다. 이후는 인터럽트에서 이어진다 */
+    if (idle)
+        spi_async_start(bus);
+    return 1;
+}
+
+int spi_async_wait(SPI_Async_t* xfer, uint32_t timeout)
+{
+    uint32_t start = HAL_GetTick();
+
+    while (xfer->state == SPI_ASYNC_PENDING) {
+        if (HAL_GetTick() - start >= timeout)
+            return -1;
+    }
+    return (xfer->state == SPI_ASYNC_DONE) ? 1 : -1;
+}
+
+int spi_async_cancel(SPI_Async_t* xfer)
+{
+    SPI_AsyncBus_t *bus = spi_async_find(xfer->dev->bus);
+    SPI_Device_t *dev = xfer->dev;
+    const SPI_AsyncDMA_t *dma;
+    SPI_TypeDef *SPIx;
+    SPI_Async_t *prev = NULL, *x;
+    uint32_t primask;
+    uint8_t active;
+
+    if (bus == NULL)
+        return -1;
+    dma = bus->dma;
+    SPIx = (SPI_TypeDef *)dma->spi;
+
+    /* 인터럽트가 큐를 바꾸지 못하도록 막고 기술자를 찾는다 */
+    primask = __get_PRIMASK();
+    __disable_irq();
+    for (x = bus->head; x != NULL && x != xfer; x = x->next)
+        prev = x;
+    if (x == NULL) {
+        /* 이미 끝났거나 큐에 넣지 않은 기술자 */
+        __set_PRIMASK(primask);
+        return 0;
+    }
+
+    /* 전송 중이면 DMA 요청을 끄고 두 스트림이 멈춘 후 남은 플래그를 지운다 */
+    active = (bus->active == xfer);
+    if (active) {
+        SPIx->CR2 &= ~(SPI_CR2_TXDMAEN | SPI_CR2_RXDMAEN);
+        dma->tx->CR &= ~DMA_SxCR_EN;
+        dma->rx->CR &= ~DMA_SxCR_EN;
+        while ((dma->tx->CR | dma->rx->CR) & DMA_SxCR_EN);
+        while (SPIx->SR & SPI_SR_BSY);
+        spi_async_clear_flags(dma->dma, dma->rxstream);
+        spi_async_clear_flags(dma->dma, dma->txstream);
+        bus->active = NULL;
+    }
+
+    if (prev == NULL)
+        bus->head = xfer->next;
+    else
+        prev->next = xfer->next;
+    if (bus->tail == xfer)
+        bus->tail = prev;
+    bus->stats.depth--;
+    bus->stats.errors++;
+    dev->errors++;
+    xfer->state = SPI_ASYNC_ERROR;
+
+    /* 버스에서 전송 중인 것이 없으면 CS 를 놓는다 */
+    if (bus->active == NULL && bus->selected == dev) {
+        gpio_write(dev->cs, 1);
+        bus->selected = NULL;
+    }
+    /* 멈춘 전송 대신 다음 기술자를 시작한다. 완료 인터럽트 안이면 인터럽트가 시작한다 */
+    if (active)
+        spi_async_start(bus);
+    __set_PRIMASK(primask);
+    return 1;
+}
+
+uint16_t spi_async_pending(SPI_t SPI_Num)
+{
+    SPI_AsyncBus_t *bus = spi_async_find(SPI_Num);
+
+    return (bus != NULL) ? bus->stats.depth : 0;
+}
+
+uint32_t spi_async_throughput(const SPI_Device_t* dev)
+{
+    if (dev->cycles == 0)
+        return 0;
+    return (uint32_t)((uint64_t)dev->bytes * SystemCoreClock / dev->cycles);
+}
+
+void spi_async_get_stats(SPI_t SPI_Num, SPI_AsyncStats_t* stats)
+{
+    SPI_AsyncBus_t *bus = spi_async_find(SPI_Num);
+
+    if (bus != NULL)
+        *stats = bus->stats;
+    else
+        memset(stats, 0, sizeof(SPI_AsyncStats_t));
+}
+
+void spi_async_reset_stats(SPI_t SPI_Num)
+{
+    SPI_AsyncBus_t *bus = spi_async_find(SPI_Num);
+    uint16_t depth;
+
+    if (bus == NULL)
+        return;
+    depth = bus->stats.depth;
+    memset(&bus->stats, 0, sizeof(SPI_AsyncStats_t));
+    bus->stats.depth = depth;
+    bus->stats.maxdepth = depth;
+}
+
+void spi_async_irq_handler(SPI_t SPI_Num)
+{
+    SPI_AsyncBus_t *bus = spi_async_find(SPI_Num);
+    const SPI_AsyncDMA_t *dma;
+    SPI_TypeDef *SPIx;
+    uint32_t flags;
+
+    if (bus == NULL)
+        return;
+    dma = bus->dma;
+    SPIx = (SPI_TypeDef *)dma->spi;
+    flags = spi_async_flags(dma->dma, dma->rxstream);
+    spi_async_clear_flags(dma->dma, dma->rxstream);
+    if (bus->active == NULL || !(flags & (SPI_ASYNC_DMA_TCIF | SPI_ASYNC_DMA_TEIF)))
+        return;
+    bus->active = NULL;
+
+    /* 마지막 프레임까지 받았으므로 DMA 요청을 끄고 버스가 쉬기를 기다린다 */
+    dma->tx->CR &= ~DMA_SxCR_EN;
+    dma->rx->CR &= ~DMA_SxCR_EN;
+    SPIx->CR2 &= ~(SPI_CR2_TXDMAEN | SPI_CR2_RXDMAEN);
+    while (SPIx->SR & SPI_SR_BSY);
+    spi_async_clear_flags(dma->dma, dma->txstream);
+
+    spi_async_finish(bus, (flags & SPI_ASYNC_DMA_TEIF) ? -1 : 1);
+    spi_async_start(bus);
+}
+
+static SPI_AsyncBus_t* spi_async_find(SPI_t SPI_Num)
+{
+    uint8_t i;
+
+    for (i = 0; i < sizeof(spi_async_bus) / sizeof(spi_async_bus[0]); i++)
+        if (spi_async_bus[i].dma != NULL && spi_async_bus[i].dma->spi == SPI_Num)
+            return &spi_async_bus[i];
+    return NULL;
+}
+
+static uint32_t spi_async_flags(DMA_TypeDef* dma, uint8_t stream)
+{
+    uint32_t isr = (stream < 4) ? dma->LISR : dma->HISR;
+
+    return (isr >> spi_async_flag_shift[stream & 3]) & SPI_ASYNC_DMA_FLAGS;
+}
+
+static void spi_async_clear_flags(DMA_TypeDef* dma, uint8_t stream)
+{
+    uint32_t mask = SPI_ASYNC_DMA_FLAGS << spi_async_flag_shift[stream & 3];
+
+    if (stream < 4)
+        dma->LIFCR = mask;
+    else
+        dma->HIFCR = mask;
+}
+
+/* 큐의 첫 기술자를 시작한다 */
+static void spi_async_start(SPI_AsyncBus_t* bus)
+{
+    const SPI_AsyncDMA_t *dma = bus->dma;
+    SPI_TypeDef *SPIx = (SPI_TypeDef *)dma->spi;
+    SPI_Async_t *xfer = bus->head;
+    SPI_Device_t *dev;
+    uint32_t cr;
+
+    if (xfer == NULL)
+        return;
+    dev = xfer->dev;
+
+    /* 다른 장치가 CS 를 잡고 있으면 먼저 놓는다 */
+    if (bus->selected != NULL && bus->selected != dev) {
+        gpio_write(bus->selected->cs, 1);
+        bus->selected = NULL;
+    }
+
+    /* 장치의 모드/주파수/프레임 크기가 현재 설정과 다를 때만 CR1 을 다시 쓴다 */
+    if ((SPIx->CR1 & ~SPI_CR1_SPE) != dev->cr1) {
+        SPIx->CR1 = dev->cr1;
+        SPIx->CR1 = dev->cr1 | SPI_CR1_SPE;
+        bus->stats.reconfigs++;
+    }
+
+    if (dev->dc != GPIO_NC)
+        gpio_write(dev->dc, xfer->dc);
+    if (dev->cs != GPIO_NC) {
+        gpio_write(dev->cs, 0);
+        bus->selected = dev;
+    }
+
+    /* 이전 전송에서 남은 수신 데이터와 OVR 을 지운다 */
+    (void)SPIx->DR;
+    (void)SPIx->SR;
+    spi_async_clear_flags(dma->dma, dma->rxstream);
+    spi_async_clear_flags(dma->dma, dma->txstream);
+
+    cr = ((uint32_t)dma->channel << 25) | DMA_SxCR_PL_1;
+    if (dev->bits == 16)
+        cr |= DMA_SxCR_PSIZE_0 | DMA_SxCR_MSIZE_0;
+
+    /* 수신 스트림: 버퍼가 없으면 dummy 하나에 계속 받는다. 완료 인터럽트는 여기서만 사용한다 */
+    dma->rx->PAR = (uint32_t)&SPIx->DR;
+    dma->rx->M0AR = (xfer->rx != NULL) ? (uint32_t)xfer->rx : (uint32_t)&bus->dummy;
+    dma->rx->NDTR = xfer->length;
+    dma->rx->FCR = 0;
+    dma->rx->CR = cr | ((xfer->rx != NULL) ? DMA_SxCR_MINC : 0) | DMA_SxCR_TCIE | DMA_SxCR_TEIE;
+
+    /* 송신 스트림: 버퍼가 없으면 fill 값을 계속 보낸다 */
+    dma->tx->PAR = (uint32_t)&SPIx->DR;
+    dma->tx->M0AR = (xfer->tx != NULL) ? (uint32_t)xfer->tx : (uint32_t)&bus->fill;
+    dma->tx->NDTR = xfer->length;
+    dma->tx->FCR = 0;
+    dma->tx->CR = cr | ((xfer->tx != NULL) ? DMA_SxCR_MINC : 0) | DMA_SxCR_DIR_0;
+
+    /* RM0090 순서: RXDMAEN, 스트림 활성화, TXDMAEN */
+    SPIx->CR2 |= SPI_CR2_RXDMAEN;
+    dma->rx->CR |= DMA_SxCR_EN;
+    dma->tx->CR |= DMA_SxCR_EN;
+    xfer->started = SPI_ASYNC_TIMESTAMP();
+    bus->active = xfer;
+    SPIx->CR2 |= SPI_CR2_TXDMAEN;
+}
+
+/* 전송 중인 기술자를 큐에서 빼고 통계를 기록한 후 콜백 함수를 호출한다 */
+static void spi_async_finish(SPI_AsyncBus_t* bus, int result)
+{
+    SPI_Async_t *xfer = bus->head;
+    SPI_Device_t *dev = xfer->dev;
+    uint32_t now = SPI_ASYNC_TIMESTAMP();
+    uint32_t latency, bytes = (uint32_t)xfer->length * (dev->bits / 8);
+
+    /* HOLD 가 없거나 오류이면 CS 를 놓는다 */
+    if (bus->selected == dev && (result < 0 || !(xfer->flags & SPI_ASYNC_HOLD))) {
+        gpio_write(dev->cs, 1);
+        bus->selected = NULL;
+    }
+
+    bus->head = xfer->next;
+    bus->stats.depth--;
+
+    latency = now - xfer->queued;
+    bus->stats.latency += latency;
+    if (latency > bus->stats.maxlatency)
+        bus->stats.maxlatency = latency;
+    dev->cycles += now - xfer->started;
+    if (result > 0) {
+        bus->stats.completed++;
+        bus->stats.bytes += bytes;
+        dev->transfers++;
+        dev->bytes += bytes;
+    } else {
+        bus->stats.errors++;
+        dev->errors++;
+    }
+
+    xfer->state = (result > 0) ? SPI_ASYNC_DONE : SPI_ASYNC_ERROR;
+    if (xfer->callback != NULL)
+        xfer->callback(xfer, result);
+}
+
+// SPI receive DMA stream interrupts
+#ifdef SPI1
+#if NVIC_RAM_IRQVECTOR
+static void spi_async_dma_handler1(void)
+#else
+__weak void DMA2_Stream0_IRQHandler(void)
+#endif
+{
+    spi_async_irq_handler(SPI_1);
+}
+#endif
+
+#ifdef SPI2
+#if NVIC_RAM_IRQVECTOR
+static void spi_async_dma_handler2(void)
+#else
+__weak void DMA1_Stream3_IRQHandler(void)
+#endif
+{
+    spi_async_irq_handler(SPI_2);
+}
+#endif
+
+#ifdef SPI3
+#if NVIC_RAM_IRQVECTOR
+static void spi_async_dma_handler3(void)
+#else
+__weak void DMA1_Stream0_IRQHandler(void)
+#endif
+{
+    spi_async_irq_handler(SPI_3);
+}
+#endif
@@ -0,0 +1,335 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+#ifndef SPIASYNC_H
+#define SPIASYNC_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup stm32lib
+ * @{
+ */
+
+/**
+ * @defgroup SPIASYNC
+ * @brief    DMA 기반의 비동기 SPI 전송 라이브러리
+ * @{
+ *
+ * 각 드라이버는 자신의 장치(@ref SPI_Device_t)에 CS 핀, DC 핀, SPI 모드, SCK 주파수,
+ * 프레임 크기를 등록하고, 전송 기술자(@ref SPI_Async_t)를 큐에 넣는다.
+ * 라이브러리는 버스가 비어 있으면 바로 전송을 시작하고, 이후의 전송들은 DMA 완료
+ * 인터럽트에서 이어서 실행한다.
+ *
+ *  - 전송 전에 DC 핀을 기술자의 값으로 바꾸고 CS 핀을 low 로 만든다.
+ *    @ref SPI_ASYNC_HOLD 가 없으면 전송이 끝난 후 CS 핀을 high 로 만든다
+ *  - 장치의 모드/주파수/프레임 크기로 계산한 CR1 값이 현재 값과 다를 때만 CR1 을 다시 쓴다
+ *  - 수신 버퍼가 없으면 받은 데이터는 버리고, 송신 버퍼가 없으면 0xFF 를 보낸다
+ *  - 장치마다 전송 수, 바이트 수, 버스 점유 사이클 수를 기록한다
+ *
+ * DMA 스트림은 다음과 같이 사용한다. 완료 인터럽트는 수신 스트림에서만 사용한다.
+ *
+\verbatim
+SPI     DMA   RX 스트림   TX 스트림   채널
+SPI1    DMA2  Stream0     Stream3     3
+SPI2    DMA1  Stream3     Stream4     0
+SPI3    DMA1  Stream0     Stream5     0
+\endverbatim
+ *
+ * 수신 스트림의 인터럽트 함수는 weak 로 정의되어 있다. 같은 스트림 인터럽트를 다른 곳에서
+ * 정의하면 그 함수에서 @ref spi_async_irq_handler() 를 호출해야 한다.
+ * 같은 버스에서 블로킹 spi_* 함수를 함께 쓰려면 큐가 빈 뒤(@ref spi_async_pending())에 호출해야 한다.
+ *
+ * 기술자는 상태가 @ref SPI_ASYNC_PENDING 인 동안 큐에 연결되어 있고 DMA 가 그 버퍼를 읽고 쓴다.
+ * 스택에 둔 기술자라면 함수에서 돌아가기 전에 끝날 때까지 기다리거나, @ref spi_async_wait() 가
+ * 타임아웃으로 끝났으면 @ref spi_async_cancel() 로 큐에서 빼야 한다.
+ *
+ * \par 사용 예
+ *
+\code
+static SPI_Device_t oled;
+static uint8_t window[6] = {0x15, 0, 95, 0x75, 0, 63};
+static SPI_Async_t cmd = {&oled, 0, window, NULL, sizeof(window), SPI_ASYNC_HOLD, NULL, NULL};
+static SPI_Async_t pixels = {&oled, 1, framebuffer, NULL, sizeof(framebuffer), 0, frame_done, NULL};
+
+spi_init(SPI_1, SPI1_PINS1);
+spi_async_init(SPI_1);
+spi_async_device(&oled, SPI_1, GPIO_PB_6, GPIO_PC_7, SPI_Mode3, 8000000, 8);
+spi_async_submit(&cmd);
+spi_async_submit(&pixels);
+\endcode
+ *
+ * \par Changelog
+ *
+\verbatim
+ 버전 1.0
+  - 최초 배포
+\endverbatim
+ *
+ * \par 의존성
+ *
+\verbatim
+ - STM32F4xx HAL
+ - SPI
+ - GPIO
+\endverbatim
+ */
+#include "stm32f4xx_hal.h"
+#include "../stm32lib/spi.h"
+#include "../stm32lib/gpio.h"
+
+/**
+ * @defgroup SPIASYNC_매크로
+ * @brief    SPIASYNC 매크로
+ * @{
+ */
+
+/**
+ * @brief  DMA 완료 인터럽트의 기본 우선순위
+ */
+#ifndef SPI_ASYNC_NVIC_PRIORITY
+#define SPI_ASYNC_NVIC_PRIORITY 0x06
+#endif
+
+/**
+ * @brief  대기 시간과 전송 시간 측정에 사용하는 사이클 카운터
+ */
+#ifndef SPI_ASYNC_TIMESTAMP
+#define SPI_ASYNC_TIMESTAMP()   (DWT->CYCCNT)
+#endif
+
+/**
+ * @brief  전송이 끝난 후에도 CS 핀을 low 로 유지한다. 명령과 데이터를 나누어 보낼 때 사용한다
+ */
+#define SPI_ASYNC_HOLD          0x01
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup SPIASYNC_자료형
+ * @brief    SPIASYNC 자료형
+ * @{
+ */
+
+/**
+ * @brief  비동기 전송 상태 열거형
+ */
+typedef enum {
+    SPI_ASYNC_IDLE = 0,     /*!< 큐에 들어가지 않음 */
+    SPI_ASYNC_PENDING,      /*!< 큐에서 기다리거나 전송 중 */
+    SPI_ASYNC_DONE,         /*!< 정상 완료 */
+    SPI_ASYNC_ERROR,        /*!< 오류로 끝남 */
+} SPI_AsyncState_t;
+
+/**
+ * @brief  SPI 장치 구조체
+ */
+typedef struct {
+    SPI_t bus;            /*!< SPI 번호 */
+    GPIO_Pin_t cs;        /*!< CS 핀. 없으면 GPIO_NC */
+    GPIO_Pin_t dc;        /*!< DC(데이터/명령) 핀. 없으면 GPIO_NC */
+    SPI_Mode_t mode;      /*!< SPI 모드 */
+    uint32_t maxhz;       /*!< 장치가 허용하는 최대 SCK 주파수 */
+    uint32_t hz;          /*!< maxhz 를 넘지 않는 실제 SCK 주파수 */
+    uint16_t cr1;         /*!< 장치에 맞게 계산된 CR1 값. 내부용 */
+    uint8_t bits;         /*!< 프레임 크기, 8 또는 16 */
+    uint32_t transfers;   /*!< 정상 완료된 전송 수 */
+    uint32_t errors;      /*!< 오류로 끝난 전송 수 */
+    uint32_t bytes;       /*!< 정상 전송된 바이트 수 */
+    uint32_t cycles;      /*!< 전송을 시작하여 끝날 때까지 걸린 사이클 수의 합 */
+} SPI_Device_t;
+
+struct SPI_Async;
+
+/**
+ * @brief  전송 완료 콜백 함수. 인터럽트 문맥에서 호출된다
+ * @param  *xfer: 끝난 전송 기술자
+ * @param  result: 1: 정상, -1: 오류
+ */
+typedef void (*SPI_AsyncCallback_t)(struct SPI_Async *xfer, int result);
+
+/**
+ * @brief  비동기 전송 기술자
+ */
+typedef struct SPI_Async {
+    SPI_Device_t *dev;            /*!< 전송할 장치 */
+    uint8_t  dc;                  /*!< DC 핀 값. 0: 명령, 1: 데이터 */
+    const void *tx;               /*!< 보낼 데이터. NULL 이면 0xFF 를 보낸다 */
+    void     *rx;                 /*!< 받은 데이터를 저장할 버퍼. NULL 이면 버린다 */
+    uint16_t length;              /*!< 프레임 수 */
+    uint8_t  flags;               /*!< @ref SPI_ASYNC_HOLD */
+    SPI_AsyncCallback_t callback; /*!< 완료 콜백 함수, NULL 가능 */
+    void     *arg;                /*!< 콜백 함수에서 사용할 사용자 포인터 */
+    /* 아래는 라이브러리 내부에서 사용 */
+    volatile SPI_AsyncState_t state; /*!< 전송 상태 */
+    uint32_t queued;              /*!< 큐에 넣은 시점 */
+    uint32_t started;             /*!< 전송을 시작한 시점 */
+    struct SPI_Async *next;       /*!< 큐의 다음 기술자 */
+} SPI_Async_t;
+
+/**
+ * @brief  비동기 전송 통계 구조체
+ */
+typedef struct {
+    uint32_t submitted;   /*!< 큐에 넣은 전송 수 */
+    uint32_t completed;   /*!< 정상 완료된 전송 수 */
+    uint32_t errors;      /*!< 오류로 끝난 전송 수 */
+    uint32_t bytes;       /*!< 정상 전송된 데이터 바이트 수 */
+    uint32_t reconfigs;   /*!< 장치가 바뀌어 CR1 을 다시 쓴 횟수 */
+    uint16_t depth;       /*!< 현재 큐 깊이 (전송 중인 것 포함) */
+    uint16_t maxdepth;    /*!< 최대 큐 깊이 */
+    uint32_t latency;     /*!< 큐에 넣은 후 완료까지 걸린 전체 사이클 수 */
+    uint32_t maxlatency;  /*!< 가장 오래 걸린 전송의 사이클 수 */
+} SPI_AsyncStats_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup SPIASYNC_함수
+ * @brief    SPIASYNC 함수
+ * @{
+ */
+
+/**
+ * @brief  SPI 버스의 비동기 전송을 초기화하고 DMA 와 인터럽트를 설정한다
+ * @note   버스는 먼저 @ref spi_init() 로 초기화되어야 한다
+ * @param  SPI_Num: 선택할 SPI 번호
+ * @retval 실행 상태, 1: 정상, -1: 오류(DMA 를 지원하지 않거나 SPISLAVE 가 사용 중인 버스)
+ */
+int spi_async_init(SPI_t SPI_Num);
+
+/**
+ * @brief  장치를 설정하고 CS/DC 핀을 출력으로 초기화한다
+ * @note   버스는 먼저 @ref spi_init() 로 초기화되어야 한다
+ * @param  *dev: 장치 구조체. 사용하는 동안 유지되어야 한다
+ * @param  SPI_Num: 장치가 연결된 SPI 번호
+ * @param  cs: CS 핀. 없으면 GPIO_NC
+ * @param  dc: DC 핀. 없으면 GPIO_NC
+ * @param  mode: SPI 모드
+ * @param  hz: 원하는 최대 SCK 주파수. 이보다 크지 않은 가장 가까운 주파수를 사용한다
+ * @param  bits: 프레임 크기, 8 또는 16
+ * @retval 없음
+ */
+void spi_async_device(SPI_Device_t* dev, SPI_t SPI_Num, GPIO_Pin_t cs, GPIO_Pin_t dc, SPI_Mode_t mode, uint32_t hz, int bits);
+
+/**
+ * @brief  장치의 최대 SCK 주파수를 바꾼다. 다음 전송부터 적용된다
+ * @note   SD 카드처럼 초기화는 느리게, 이후는 빠르게 동작하는 장치에 사용한다.
+ *         장치의 전송이 큐에 남아 있지 않을 때 호출해야 한다
+ * @param  *dev: 장치 구조체
+ * @param  hz: 새 최대 SCK 주파수
+ * @retval 실제 SCK 주파수
+ */
+uint32_t spi_async_device_frequency(SPI_Device_t* dev, uint32_t hz);
+
+/**
+ * @brief  전송 기술자를 장치의 버스 큐에 넣는다. 버스가 비어 있으면 바로 전송을 시작한다
+ * @param  *xfer: 전송 기술자. @ref SPI_ASYNC_PENDING 인 동안 범위를 벗어나면 안 된다
+ * @retval 실행 상태, 1: 정상, -1: 오류(초기화되지 않은 버스 또는 이미 큐에 있는 기술자)
+ */
+int spi_async_submit(SPI_Async_t* xfer);
+
+/**
+ * @brief  전송이 끝날 때까지 기다린다
+ * @note   타임아웃이면 기술자는 아직 큐에 있다. 기술자를 버리기 전에 @ref spi_async_cancel() 을 호출해야 한다
+ * @param  *xfer: 기다릴 전송 기술자
+ * @param  timeout: 밀리초 단위 타임아웃
+ * @retval 실행 상태, 1: 정상, -1: 오류 또는 타임아웃
+ */
+int spi_async_wait(SPI_Async_t* xfer, uint32_t timeout);
+
+/**
+ * @brief  기술자를 큐에서 뺀다. 전송 중이면 두 DMA 스트림을 멈추고 CS 를 놓은 후 다음 기술자를 시작한다
+ * @note   취소된 기술자는 @ref SPI_ASYNC_ERROR 가 되고 오류로 집계된다. 콜백 함수는 호출되지 않는다.
+ *         완료 콜백 함수 안에서 같은 버스의 다른 기술자를 취소할 수 있다
+ * @param  *xfer: 취소할 전송 기술자
+ * @retval 1: 취소함, 0: 이미 끝났거나 큐에 없는 기술자, -1: 오류(초기화되지 않은 버스)
+ */
+int spi_async_cancel(SPI_Async_t* xfer);
+
+/**
+ * @brief  큐에 남은 전송 수를 얻는다
+ * @param  SPI_Num: 선택할 SPI 번호
+ * @retval 전송 중인 것을 포함한 큐 깊이
+ */
+uint16_t spi_async_pending(SPI_t SPI_Num);
+
+/**
+ * @brief  장치의 평균 전송 속도를 얻는다
+ * @param  *dev: 장치 구조체
+ * @retval 초당 바이트 수. 전송 기록이 없으면 0
+ */
+uint32_t spi_async_throughput(const SPI_Device_t* dev);
+
+/**
+ * @brief  비동기 전송 통계를 얻는다
+ * @param  SPI_Num: 선택할 SPI 번호
+ * @param  *stats: 통계를 저장할 @ref SPI_AsyncStats_t 구조체의 포인터
+ * @retval 없음
+ */
+void spi_async_get_stats(SPI_t SPI_Num, SPI_AsyncStats_t* stats);
+
+/**
+ * @brief  비동기 전송 통계를 0 으로 만든다. 현재 큐 깊이는 유지된다
+ * @param  SPI_Num: 선택할 SPI 번호
+ * @retval 없음
+ */
+void spi_async_reset_stats(SPI_t SPI_Num);
+
+/**
+ * @brief  수신 DMA 스트림 인터럽트를 처리한다
+ * @note   라이브러리의 weak 인터럽트 함수를 대신할 때만 직접 호출한다
+ * @param  SPI_Num: 선택할 SPI 번호
+ * @retval 없음
+ */
+void spi_async_irq_handler(SPI_t SPI_Num);
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
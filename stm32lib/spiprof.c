@@ -0,0 +1,268 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+#include "../stm32lib/spiprof.h"
+
+#if SPI_PROF
+
+/* 버스별로 열린 트랜잭션 */
+typedef struct {
+    SPI_ProfDevice_t *dev;  /* 열린 트랜잭션의 장치. NULL 이면 열려 있지 않음 */
+    uint32_t start;
+    uint32_t calls;
+    uint32_t bytes;
+    uint32_t bits;          /* 바이트로 모자란 비트 */
+    uint32_t active;
+    uint32_t wire;
+    uint32_t wait;
+} SPI_ProfOpen_t;
+
+/* Private variable */
+static SPI_ProfDevice_t spi_prof_devices[SPI_PROF_DEVICES];
+static int spi_prof_ndevices;
+static SPI_ProfOpen_t spi_prof_open[6];
+
+/* Private functions */
+static SPI_ProfOpen_t* spi_prof_bus(SPI_t SPI_Num);
+static SPI_ProfDevice_t* spi_prof_device(SPI_t SPI_Num, GPIO_Pin_t cs);
+static void spi_prof_begin(SPI_ProfOpen_t* open, SPI_ProfDevice_t* dev, uint32_t start);
+static void spi_prof_end(SPI_ProfOpen_t* open, uint32_t end);
+static int spi_prof_bucket(uint32_t value);
+static uint8_t spi_prof_busnum(SPI_t SPI_Num);
+
+void spi_prof_select(SPI_t SPI_Num, GPIO_Pin_t cs)
+{
+    uint32_t now = SPI_PROF_TIMESTAMP();
+    SPI_ProfOpen_t *open = spi_prof_bus(SPI_Num);
+
+    if (open == NULL)
+        return;
+    /* 닫지 않은 트랜잭션은 여기서 닫는다 */
+    if (open->dev != NULL)
+        spi_prof_end(open, now);
+    spi_prof_begin(open, spi_prof_device(SPI_Num, cs), now);
+}
+
+void spi_prof_deselect(SPI_t SPI_Num)
+{
+    uint32_t now = SPI_PROF_TIMESTAMP();
+    SPI_ProfOpen_t *open = spi_prof_bus(SPI_Num);
+
+    if (open != NULL && open->dev != NULL)
+        spi_prof_end(open, now);
+}
+
+void spi_prof_transfer(SPI_t SPI_Num, uint32_t bits, uint32_t start, uint32_t wait)
+{
+    uint32_t end = SPI_PROF_TIMESTAMP();
+    SPI_ProfOpen_t *open = spi_prof_bus(SPI_Num);
+    uint32_t hz;
+    int single;
+
+    if (open == NULL)
+        return;
+    /* spi_select() 밖의 전송은 그 자체로 한 트랜잭션이다 */
+    single = (open->dev == NULL);
+    if (single) {
+        spi_prof_begin(open, spi_prof_device(SPI_Num, GPIO_NC), start);
+        if (open->dev == NULL)
+            return;
+    }
+
+    hz = (uint32_t)spi_get_frequency(SPI_Num);
+    open->calls++;
+    open->bits += bits;
+    open->bytes += open->bits / 8;
+    open->bits %= 8;
+    open->active += end - start;
+    if (hz > 0)
+        open->wire += (uint32_t)((uint64_t)bits * SPI_PROF_CLOCK / hz);
+    open->wait += wait;
+
+    if (single)
+        spi_prof_end(open, end);
+}
+
+int spi_prof_get(int index, SPI_ProfDevice_t* dev)
+{
+    if (index < 0 || index >= spi_prof_ndevices)
+        return 0;
+    *dev = spi_prof_devices[index];
+    return 1;
+}
+
+const SPI_ProfDevice_t* spi_prof_find(SPI_t SPI_Num, GPIO_Pin_t cs)
+{
+    int i;
+
+    for (i = 0; i < spi_prof_ndevices; i++)
+        if (spi_prof_devices[i].bus == SPI_Num && spi_prof_devices[i].cs == cs)
+            return &spi_prof_devices[i];
+    return NULL;
+}
+
+void spi_prof_reset(void)
+{
+    memset(spi_prof_devices, 0, sizeof(spi_prof_devices));
+    memset(spi_prof_open, 0, sizeof(spi_prof_open));
+    spi_prof_ndevices = 0;
+}
+
+void spi_prof_dump(void)
+{
+    SPI_ProfDevice_t *dev;
+    uint32_t mhz = SPI_PROF_CLOCK / 1000000;
+    int i, j;
+
+    if (mhz == 0)
+        mhz = 1;
+    printf("# spiprof clock=%lu\r\n", (unsigned long)SPI_PROF_CLOCK);
+    for (i = 0; i < spi_prof_ndevices; i++) {
+        dev = &spi_prof_devices[i];
+        /* 시간은 마이크로초로 바꾸어 출력한다 */
+        printf("D SPI%u %lX %lu %lu %lu %lu %lu %lu %lu %lu\r\n",
+               spi_prof_busnum(dev->bus), (unsigned long)(uint32_t)dev->cs,
+               (unsigned long)dev->transactions, (unsigned long)dev->calls, (unsigned long)dev->bytes,
+               (unsigned long)(dev->hold / mhz), (unsigned long)(dev->active / mhz),
+               (unsigned long)(dev->wire / mhz), (unsigned long)(dev->wait / mhz),
+               (unsigned long)(dev->maxhold / mhz));
+        printf("H");
+        for (j = 0; j < SPI_PROF_BUCKETS; j++)
+            printf(" %lu", (unsigned long)dev->holdhist[j]);
+        printf("\r\nS");
+        for (j = 0; j < SPI_PROF_BUCKETS; j++)
+            printf(" %lu", (unsigned long)dev->sizehist[j]);
+        printf("\r\nU");
+        for (j = 0; j < SPI_PROF_UTIL_BUCKETS; j++)
+            printf(" %lu", (unsigned long)dev->utilhist[j]);
+        printf("\r\n");
+    }
+}
+
+static SPI_ProfOpen_t* spi_prof_bus(SPI_t SPI_Num)
+{
+    uint8_t num = spi_prof_busnum(SPI_Num);
+
+    return (num > 0) ? &spi_prof_open[num - 1] : NULL;
+}
+
+/* 장치 기록을 찾고, 없으면 새로 만든다 */
+static SPI_ProfDevice_t* spi_prof_device(SPI_t SPI_Num, GPIO_Pin_t cs)
+{
+    SPI_ProfDevice_t *dev = (SPI_ProfDevice_t *)spi_prof_find(SPI_Num, cs);
+
+    if (dev != NULL || spi_prof_ndevices == SPI_PROF_DEVICES)
+        return dev;
+    dev = &spi_prof_devices[spi_prof_ndevices++];
+    memset(dev, 0, sizeof(SPI_ProfDevice_t));
+    dev->bus = SPI_Num;
+    dev->cs = cs;
+    return dev;
+}
+
+static void spi_prof_begin(SPI_ProfOpen_t* open, SPI_ProfDevice_t* dev, uint32_t start)
+{
+    memset(open, 0, sizeof(SPI_ProfOpen_t));
+    open->dev = dev;
+    open->start = start;
+}
+
+/* 트랜잭션을 닫고 장치 기록에 더한다 */
+static void spi_prof_end(SPI_ProfOpen_t* open, uint32_t end)
+{
+    SPI_ProfDevice_t *dev = open->dev;
+    uint32_t hold = end - open->start;
+    uint32_t mhz = SPI_PROF_CLOCK / 1000000;
+    uint32_t util;
+
+    open->dev = NULL;
+    if (dev == NULL)
+        return;
+    if (mhz == 0)
+        mhz = 1;
+
+    dev->transactions++;
+    dev->calls += open->calls;
+    dev->bytes += open->bytes;
+    dev->hold += hold;
+    dev->active += open->active;
+    dev->wire += open->wire;
+    dev->wait += open->wait;
+    if (hold > dev->maxhold)
+        dev->maxhold = hold;
+
+    dev->holdhist[spi_prof_bucket(hold / mhz)]++;
+    dev->sizehist[spi_prof_bucket(open->bytes)]++;
+    /* 계측 오차로 wire 가 hold 보다 클 수 있으므로 마지막 구간으로 자른다 */
+    util = (hold > 0) ? (uint32_t)((uint64_t)open->wire * SPI_PROF_UTIL_BUCKETS / hold) : 0;
+    if (util >= SPI_PROF_UTIL_BUCKETS)
+        util = SPI_PROF_UTIL_BUCKETS - 1;
+    dev->utilhist[util]++;
+}
+
+/* 0 은 0 번, 그 외에는 2^(i-1) <= value < 2^i 인 i 번 구간 */
+static int spi_prof_bucket(uint32_t value)
+{
+    int bucket = 0;
+
+    while (value != 0 && bucket < SPI_PROF_BUCKETS - 1) {
+        value >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+static uint8_t spi_prof_busnum(SPI_t SPI_Num)
+{
+#ifdef SPI1
+    if (SPI_Num == SPI_1)
+        return 1;
+#endif
+#ifdef SPI2
+    if (SPI_Num == SPI_2)
+        return 2;
+#endif
+#ifdef SPI3
+    if (SPI_Num == SPI_3)
+        return 3;
+#endif
+#ifdef SPI4
+    if (SPI_Num == SPI_4)
+        return 4;
+#endif
+#ifdef SPI5
+    if (SPI_Num == SPI_5)
+        return 5;
+#endif
+#ifdef SPI6
+    if (SPI_Num == SPI_6)
+        return 6;
+#endif
+    return 0;
+}
+
+#endif
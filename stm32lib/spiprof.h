@@ -0,0 +1,249 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+#ifndef SPIPROF_H
+#define SPIPROF_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup stm32lib
+ * @{
+ */
+
+/**
+ * @defgroup SPIPROF
+ * @brief    SPI 버스 사용률과 지연 측정 라이브러리
+ * @{
+ *
+ * @ref SPI_PROF 를 1 로 정의하여 빌드하면 SPI 라이브러리의 블로킹 전송 함수가 끝날 때마다
+ * 보낸 비트 수, 함수 안에서 보낸 시간, TXE/RXNE/BSY 폴링으로 기다린 시간이 기록된다.
+ * 0 이면(기본값) 이 라이브러리와 SPI 라이브러리의 계측 코드는 전혀 만들어지지 않는다.
+ *
+ * 기록은 장치(버스와 CS 핀)별로 모인다. @ref spi_select() 와 @ref spi_deselect() 사이의 전송이
+ * 한 트랜잭션이 되고, 그 밖의 전송은 CS 가 GPIO_NC 인 장치의 트랜잭션 하나로 센다.
+ * 트랜잭션마다 다음 시간을 나누어 더한다.
+ *  - hold: CS 를 내린 때부터 올린 때까지
+ *  - active: 그 중 SPI 전송 함수 안에서 보낸 시간. hold - active 는 CS 를 내린 채 드라이버가 다른 일을 한 시간이다
+ *  - wire: 그 중 SCK 가 실제로 움직인 시간 (비트 수 × SCK 한 주기). active - wire 는 프레임 사이에 버스가 쉰 시간이다
+ *  - wait: active 중 상태 플래그를 폴링하며 기다린 시간
+ *
+ * 그리고 CS 유지 시간, 트랜잭션 크기, 선로 사용률(wire / hold)의 히스토그램을 만든다.
+ * @ref spi_prof_get() 으로 실행 중에 읽거나, @ref spi_prof_dump() 의 출력을 저장하여
+ * 호스트에서 tools/spiprof.c 로 보고서를 만든다.
+ *
+ * 한 버스의 블로킹 전송은 한 문맥(메인 루프 또는 한 인터럽트)에서만 한다고 가정한다.
+ * DMA 전송(@ref SPIASYNC)은 기록하지 않는다.
+ *
+ * \par 사용 예
+ *
+\code
+// 컴파일러 옵션: -DSPI_PROF=1
+ssd1331_fillrect(0, 0, 96, 64, SSD1331_COLOR_RED);
+w25qxx_read(&flash, 0, buf, sizeof(buf));
+spi_prof_dump();
+\endcode
+ *
+ * \par Changelog
+ *
+\verbatim
+ 버전 1.0
+  - 최초 배포
+\endverbatim
+ *
+ * \par 의존성
+ *
+\verbatim
+ - STM32F4xx HAL
+ - SPI
+ - stdio.h
+\endverbatim
+ */
+#include "stm32f4xx_hal.h"
+#include "../stm32lib/spi.h"
+#include "stdio.h"
+
+/**
+ * @defgroup SPIPROF_매크로
+ * @brief    SPIPROF 매크로
+ * @{
+ */
+
+/**
+ * @brief  기록하는 최대 장치 수. 넘치면 새 장치는 기록하지 않는다
+ */
+#ifndef SPI_PROF_DEVICES
+#define SPI_PROF_DEVICES        8
+#endif
+
+/**
+ * @brief  CS 유지 시간과 트랜잭션 크기 히스토그램의 구간 수.
+ *         0 번은 0, i 번은 2^(i-1) 이상 2^i 미만이고 마지막 구간은 그 이상을 모두 센다
+ */
+#ifndef SPI_PROF_BUCKETS
+#define SPI_PROF_BUCKETS        16
+#endif
+
+/**
+ * @brief  선로 사용률 히스토그램의 구간 수. 10 이면 10% 단위이다
+ */
+#ifndef SPI_PROF_UTIL_BUCKETS
+#define SPI_PROF_UTIL_BUCKETS   10
+#endif
+
+/**
+ * @brief  시간을 재는 사이클 카운터. 호스트 시험에서는 가짜 카운터로 바꿀 수 있다
+ * @note   기본값인 DWT 사이클 카운터는 SPI_PROF 가 1 이면 @ref spi_init() 에서 켠다
+ */
+#ifndef SPI_PROF_TIMESTAMP
+#define SPI_PROF_TIMESTAMP()    (DWT->CYCCNT)
+#endif
+
+/**
+ * @brief  @ref SPI_PROF_TIMESTAMP() 의 주파수
+ */
+#ifndef SPI_PROF_CLOCK
+#define SPI_PROF_CLOCK          SystemCoreClock
+#endif
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup SPIPROF_자료형
+ * @brief    SPIPROF 자료형
+ * @{
+ */
+
+/**
+ * @brief  장치별 기록 구조체. 시간은 모두 @ref SPI_PROF_TIMESTAMP() 사이클 단위이다
+ */
+typedef struct {
+    SPI_t bus;              /*!< SPI 번호 */
+    GPIO_Pin_t cs;          /*!< CS 핀. GPIO_NC 이면 @ref spi_select() 밖에서 한 전송 */
+    uint32_t transactions;  /*!< 트랜잭션 수 */
+    uint32_t calls;         /*!< 전송 함수 호출 수 */
+    uint32_t bytes;         /*!< 보내거나 받은 바이트 수 */
+    uint64_t hold;          /*!< CS 유지 시간 합 */
+    uint64_t active;        /*!< 전송 함수 안에서 보낸 시간 합 */
+    uint64_t wire;          /*!< SCK 가 움직인 시간 합 */
+    uint64_t wait;          /*!< 상태 플래그 폴링 시간 합 */
+    uint32_t maxhold;       /*!< 가장 긴 CS 유지 시간 */
+    uint32_t holdhist[SPI_PROF_BUCKETS];        /*!< CS 유지 시간(마이크로초) 히스토그램 */
+    uint32_t sizehist[SPI_PROF_BUCKETS];        /*!< 트랜잭션 바이트 수 히스토그램 */
+    uint32_t utilhist[SPI_PROF_UTIL_BUCKETS];   /*!< 트랜잭션의 wire / hold 히스토그램 */
+} SPI_ProfDevice_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup SPIPROF_함수
+ * @brief    SPIPROF 함수
+ * @{
+ */
+
+#if SPI_PROF
+
+/**
+ * @brief  트랜잭션을 연다. @ref spi_select() 에서 호출한다
+ * @param  SPI_Num: SPI 번호
+ * @param  cs: CS 핀
+ * @retval 없음
+ */
+void spi_prof_select(SPI_t SPI_Num, GPIO_Pin_t cs);
+
+/**
+ * @brief  열린 트랜잭션을 닫는다. @ref spi_deselect() 에서 호출한다
+ * @param  SPI_Num: SPI 번호
+ * @retval 없음
+ */
+void spi_prof_deselect(SPI_t SPI_Num);
+
+/**
+ * @brief  전송 함수 호출 하나를 기록한다. SPI 라이브러리에서 호출한다
+ * @param  SPI_Num: SPI 번호
+ * @param  bits: 선로로 나간 비트 수
+ * @param  start: 함수에 들어온 @ref SPI_PROF_TIMESTAMP() 값
+ * @param  wait: 함수 안에서 폴링한 사이클 수
+ * @retval 없음
+ */
+void spi_prof_transfer(SPI_t SPI_Num, uint32_t bits, uint32_t start, uint32_t wait);
+
+/**
+ * @brief  장치 기록 하나를 복사한다
+ * @param  index: 0 부터 시작하는 장치 번호
+ * @param  *dev: 기록을 저장할 구조체
+ * @retval 1: 복사함, 0: 장치 없음
+ */
+int spi_prof_get(int index, SPI_ProfDevice_t* dev);
+
+/**
+ * @brief  장치 기록을 찾는다
+ * @param  SPI_Num: SPI 번호
+ * @param  cs: CS 핀. GPIO_NC 이면 @ref spi_select() 밖에서 한 전송의 기록
+ * @retval 장치 기록, 없으면 NULL
+ */
+const SPI_ProfDevice_t* spi_prof_find(SPI_t SPI_Num, GPIO_Pin_t cs);
+
+/**
+ * @brief  모든 기록을 지운다. 열린 트랜잭션은 버린다
+ * @retval 없음
+ */
+void spi_prof_reset(void);
+
+/**
+ * @brief  모든 장치 기록을 tools/spiprof.c 가 해석하는 형식으로 printf 출력한다
+ * @retval 없음
+ */
+void spi_prof_dump(void);
+
+#endif
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
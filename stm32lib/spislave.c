@@ -0,0 +1,383 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+#include "../stm32lib/spislave.h"
+
+#include "../stm32lib/extirq.h"
+
+/* Private SPI DMA stream structure */
+typedef struct {
+    SPI_t spi;
+    DMA_TypeDef *dma;
+    DMA_Stream_TypeDef *rx;
+    DMA_Stream_TypeDef *tx;
+    uint8_t rxstream;   /* 플래그 위치를 찾기 위한 스트림 번호 */
+    uint8_t txstream;
+    uint8_t channel;
+} SPI_SlaveDMA_t;
+
+/* Private NSS pin structure */
+typedef struct {
+    SPI_t spi;
+    GPIO_Pin_t nss;
+    uint8_t alternate;
+} SPI_SlaveNSS_t;
+
+/* Private SPI slave bus structure */
+typedef struct {
+    const SPI_SlaveDMA_t *dma;  /* NULL 이면 사용하지 않음 */
+    SPI_Slave_t *slave;
+    GPIO_Pin_t nss;
+    uint16_t cr1;
+    uint8_t width;              /* 프레임 바이트 수 */
+    uint16_t head;              /* 현재 프레임이 시작된 수신 버퍼 위치 */
+    uint16_t length[2];         /* 응답 버퍼마다 채워진 프레임 수 */
+    volatile uint8_t front;     /* 보내고 있는 응답 버퍼 */
+    volatile uint8_t pending;   /* commit 되어 바뀌기를 기다리는 응답이 있음 */
+    uint8_t fresh;              /* 현재 응답을 아직 한 번도 보내지 않음 */
+    uint16_t fill;              /* 응답이 없을 때 보내는 값 */
+    SPI_SlaveStats_t stats;
+} SPI_SlaveBus_t;
+
+/* Private variable */
+static const SPI_SlaveDMA_t spi_slave_dma[] = {
+#ifdef SPI1
+    {SPI_1, DMA2, DMA2_Stream0, DMA2_Stream3, 0, 3, 3},
+#endif
+#ifdef SPI2
+    {SPI_2, DMA1, DMA1_Stream3, DMA1_Stream4, 3, 4, 0},
+#endif
+#ifdef SPI3
+    {SPI_3, DMA1, DMA1_Stream0, DMA1_Stream5, 0, 5, 0},
+#endif
+};
+static const SPI_SlaveNSS_t spi_slave_nss[] = {
+    {SPI_1, GPIO_PA_4,  GPIO_AF5_SPI1},
+    {SPI_1, GPIO_PA_15, GPIO_AF5_SPI1},
+    {SPI_2, GPIO_PB_12, GPIO_AF5_SPI2},
+    {SPI_2, GPIO_PB_9,  GPIO_AF5_SPI2},
+    {SPI_3, GPIO_PA_4,  GPIO_AF6_SPI3},
+    {SPI_3, GPIO_PA_15, GPIO_AF6_SPI3},
+};
+static SPI_SlaveBus_t spi_slave_bus[3];
+
+/* DMA 스트림 번호에 따른 LISR/HISR 안의 플래그 위치 */
+static const uint8_t spi_slave_flag_shift[4] = {0, 6, 16, 22};
+#define SPI_SLAVE_DMA_FLAGS     0x3DU   /* FEIF, DMEIF, TEIF, HTIF, TCIF */
+#define SPI_SLAVE_DMA_HTIF      0x10U
+#define SPI_SLAVE_DMA_TCIF      0x20U
+
+/* Private functions */
+static SPI_SlaveBus_t* spi_slave_find(SPI_t SPI_Num);
+static uint32_t spi_slave_flags(DMA_TypeDef* dma, uint8_t stream);
+static void spi_slave_clear_flags(DMA_TypeDef* dma, uint8_t stream);
+static void spi_slave_reset(SPI_t SPI_Num);
+static void spi_slave_restart(SPI_SlaveBus_t* bus);
+static void spi_slave_frame_end(SPI_SlaveBus_t* bus);
+static void spi_slave_nss_handler(int i, int edge);
+
+int spi_slave_init(SPI_t SPI_Num, GPIO_Pin_t nss, SPI_Mode_t mode, int bits, SPI_Slave_t* slave)
+{
+    const SPI_SlaveDMA_t *dma = NULL;
+    const SPI_SlaveNSS_t *pin = NULL;
+    SPI_SlaveBus_t *bus = NULL;
+    SPI_TypeDef *SPIx = (SPI_TypeDef *)SPI_Num;
+    uint32_t cr;
+    uint8_t i;
+
+    if (slave->rx == NULL || slave->rxsize == 0 || slave->tx[0] == NULL || slave->tx[1] == NULL)
+        return -1;
+    if (spi_slave_find(SPI_Num) != NULL)
+        return -1;
+    for (i = 0; i < sizeof(spi_slave_dma) / sizeof(spi_slave_dma[0]); i++)
+        if (spi_slave_dma[i].spi == SPI_Num)
+            dma = &spi_slave_dma[i];
+    for (i = 0; i < sizeof(spi_slave_nss) / sizeof(spi_slave_nss[0]); i++)
+        if (spi_slave_nss[i].spi == SPI_Num && spi_slave_nss[i].nss == nss)
+            pin = &spi_slave_nss[i];
+    for (i = 0; i < sizeof(spi_slave_bus) / sizeof(spi_slave_bus[0]); i++)
+        if (spi_slave_bus[i].dma == NULL)
+            bus = &spi_slave_bus[i];
+    if (dma == NULL || pin == NULL || bus == NULL)
+        return -1;
+    /* 같은 DMA 스트림을 쓰는 SPIASYNC 가 사용 중인 버스는 받지 않는다 */
+    if (spi_claim_dma(SPI_Num, spi_slave_bus) < 0)
+        return -1;
+
+    /* NSS 가 올라가는 것을 외부 인터럽트로 보고, 핀은 SPI 의 NSS 로 돌려놓는다 */
+    if (extirq_init(nss, spi_slave_nss_handler, EXTIRQ_RISING_EDGE) != EXTIRQ_RES_OK) {
+        spi_release_dma(SPI_Num, spi_slave_bus);
+        return -1;
+    }
+    gpio_alternate_init(nss, GPIO_AF, pin->alternate);
+    gpio_set_pinmode(nss, GPIO_PM_PULLUP);
+
+    memset(bus, 0, sizeof(SPI_SlaveBus_t));
+    bus->slave = slave;
+    bus->nss = nss;
+    bus->width = (bits == 16) ? 2 : 1;
+    bus->fill = 0xFFFF;
+    /* 슬레이브, 하드웨어 NSS (MSTR = 0, SSM = 0) */
+    bus->cr1 = ((mode & 0x02) ? SPI_CR1_CPOL : 0) | ((mode & 0x01) ? SPI_CR1_CPHA : 0) |
+               ((bits == 16) ? SPI_CR1_DFF : 0);
+
+    if (dma->dma == DMA1)
+        __HAL_RCC_DMA1_CLK_ENABLE();
+    else
+        __HAL_RCC_DMA2_CLK_ENABLE();
+
+    /* 수신 스트림: 원형 버퍼에 계속 받는다. 인터럽트는 사용하지 않는다 */
+    dma->rx->CR = 0;
+    while (dma->rx->CR & DMA_SxCR_EN);
+    spi_slave_clear_flags(dma->dma, dma->rxstream);
+    cr = ((uint32_t)dma->channel << 25) | DMA_SxCR_PL_1 | DMA_SxCR_MINC | DMA_SxCR_CIRC;
+    if (bits == 16)
+        cr |= DMA_SxCR_PSIZE_0 | DMA_SxCR_MSIZE_0;
+    dma->rx->PAR = (uint32_t)&SPIx->DR;
+    dma->rx->M0AR = (uint32_t)slave->rx;
+    dma->rx->NDTR = slave->rxsize;
+    dma->rx->FCR = 0;
+    dma->rx->CR = cr | DMA_SxCR_EN;
+
+    /* 인터럽트가 이 버스를 찾을 수 있도록 마지막에 등록한다 */
+    bus->dma = dma;
+    spi_slave_restart(bus);
+    return 1;
+}
+
+void spi_slave_deinit(SPI_t SPI_Num)
+{
+    SPI_SlaveBus_t *bus = spi_slave_find(SPI_Num);
+    const SPI_SlaveDMA_t *dma;
+
+    if (bus == NULL)
+        return;
+    dma = bus->dma;
+    bus->dma = NULL;
+    extirq_free(bus->nss);
+    spi_slave_reset(SPI_Num);
+    dma->rx->CR = 0;
+    dma->tx->CR = 0;
+    spi_slave_clear_flags(dma->dma, dma->rxstream);
+    spi_slave_clear_flags(dma->dma, dma->txstream);
+    spi_release_dma(SPI_Num, spi_slave_bus);
+}
+
+void* spi_slave_prepare(SPI_t SPI_Num)
+{
+    SPI_SlaveBus_t *bus = spi_slave_find(SPI_Num);
+
+    if (bus == NULL || bus->pending)
+        return NULL;
+    return bus->slave->tx[bus->front ^ 1];
+}
+
+int spi_slave_commit(SPI_t SPI_Num, uint16_t length)
+{
+    SPI_SlaveBus_t *bus = spi_slave_find(SPI_Num);
+
+    if (bus == NULL || bus->pending || length == 0 || length > bus->slave->txsize)
+        return -1;
+    /* pending 이 0 인 동안 인터럽트는 front 를 바꾸지 않으므로 순서만 지키면 된다 */
+    bus->length[bus->front ^ 1] = length;
+    bus->pending = 1;
+    return 1;
+}
+
+void spi_slave_get_stats(SPI_t SPI_Num, SPI_SlaveStats_t* stats)
+{
+    SPI_SlaveBus_t *bus = spi_slave_find(SPI_Num);
+
+    if (bus != NULL)
+        *stats = bus->stats;
+    else
+        memset(stats, 0, sizeof(SPI_SlaveStats_t));
+}
+
+void spi_slave_reset_stats(SPI_t SPI_Num)
+{
+    SPI_SlaveBus_t *bus = spi_slave_find(SPI_Num);
+
+    if (bus != NULL)
+        memset(&bus->stats, 0, sizeof(SPI_SlaveStats_t));
+}
+
+static SPI_SlaveBus_t* spi_slave_find(SPI_t SPI_Num)
+{
+    uint8_t i;
+
+    for (i = 0; i < sizeof(spi_slave_bus) / sizeof(spi_slave_bus[0]); i++)
+        if (spi_slave_bus[i].dma != NULL && spi_slave_bus[i].dma->spi == SPI_Num)
+            return &spi_slave_bus[i];
+    return NULL;
+}
+
+static uint32_t spi_slave_flags(DMA_TypeDef* dma, uint8_t stream)
+{
+    uint32_t isr = (stream < 4) ? dma->LISR : dma->HISR;
+
+    return (isr >> spi_slave_flag_shift[stream & 3]) & SPI_SLAVE_DMA_FLAGS;
+}
+
+static void spi_slave_clear_flags(DMA_TypeDef* dma, uint8_t stream)
+{
+    uint32_t mask = SPI_SLAVE_DMA_FLAGS << spi_slave_flag_shift[stream & 3];
+
+    if (stream < 4)
+        dma->LIFCR = mask;
+    else
+        dma->HIFCR = mask;
+}
+
+/* SPI 를 리셋하여 DR 에 남은 송신 데이터와 오류 플래그를 지운다. CR1/CR2 도 0 이 된다 */
+static void spi_slave_reset(SPI_t SPI_Num)
+{
+#ifdef SPI1
+    if (SPI_Num == SPI_1) {
+        __HAL_RCC_SPI1_FORCE_RESET();
+        __HAL_RCC_SPI1_RELEASE_RESET();
+    }
+#endif
+#ifdef SPI2
+    if (SPI_Num == SPI_2) {
+        __HAL_RCC_SPI2_FORCE_RESET();
+        __HAL_RCC_SPI2_RELEASE_RESET();
+    }
+#endif
+#ifdef SPI3
+    if (SPI_Num == SPI_3) {
+        __HAL_RCC_SPI3_FORCE_RESET();
+        __HAL_RCC_SPI3_RELEASE_RESET();
+    }
+#endif
+}
+
+/* 응답을 처음부터 다시 보내도록 SPI 와 송신 스트림을 다시 설정한다. 수신 스트림은 그대로 둔다 */
+static void spi_slave_restart(SPI_SlaveBus_t* bus)
+{
+    const SPI_SlaveDMA_t *dma = bus->dma;
+    SPI_TypeDef *SPIx = (SPI_TypeDef *)dma->spi;
+    uint16_t length;
+    uint32_t cr;
+
+    spi_slave_reset(dma->spi);
+    dma->tx->CR &= ~DMA_SxCR_EN;
+    while (dma->tx->CR & DMA_SxCR_EN);
+    spi_slave_clear_flags(dma->dma, dma->txstream);
+
+    /* commit 된 응답이 있으면 버퍼를 바꾼다 */
+    if (bus->pending) {
+        bus->front ^= 1;
+        bus->pending = 0;
+        bus->fresh = 1;
+        bus->stats.responses++;
+    }
+    length = bus->length[bus->front];
+
+    /* 송신 스트림: 응답을 원형으로 보낸다. 응답이 없으면 fill 값을 보낸다 */
+    cr = ((uint32_t)dma->channel << 25) | DMA_SxCR_PL_1 | DMA_SxCR_CIRC | DMA_SxCR_DIR_0;
+    if (bus->width == 2)
+        cr |= DMA_SxCR_PSIZE_0 | DMA_SxCR_MSIZE_0;
+    dma->tx->PAR = (uint32_t)&SPIx->DR;
+    dma->tx->M0AR = (length > 0) ? (uint32_t)bus->slave->tx[bus->front] : (uint32_t)&bus->fill;
+    dma->tx->NDTR = (length > 0) ? length : 1;
+    dma->tx->FCR = 0;
+    dma->tx->CR = cr | ((length > 0) ? DMA_SxCR_MINC : 0);
+
+    /* RM0090 순서: RXDMAEN, 스트림 활성화, TXDMAEN, SPE. 첫 응답 프레임은 바로 DR 로 들어간다 */
+    SPIx->CR1 = bus->cr1;
+    SPIx->CR2 = SPI_CR2_RXDMAEN;
+    dma->tx->CR |= DMA_SxCR_EN;
+    SPIx->CR2 |= SPI_CR2_TXDMAEN;
+    SPIx->CR1 = bus->cr1 | SPI_CR1_SPE;
+}
+
+/* NSS 가 올라가면 받은 프레임을 알리고 다음 프레임을 준비한다 */
+static void spi_slave_frame_end(SPI_SlaveBus_t* bus)
+{
+    SPI_Slave_t *slave = bus->slave;
+    SPI_TypeDef *SPIx = (SPI_TypeDef *)bus->dma->spi;
+    SPI_SlaveFrame_t frame;
+    uint32_t flags;
+    uint16_t pos, length;
+    uint8_t overflow;
+
+    /* 수신 스트림의 남은 수로 현재 위치를 구한다 */
+    pos = (slave->rxsize - bus->dma->rx->NDTR) % slave->rxsize;
+    length = (pos + slave->rxsize - bus->head) % slave->rxsize;
+
+    /* 버퍼를 한 바퀴 넘게 받으면 HT 와 TC 가 함께 선다. 반 바퀴보다 짧은 프레임은 둘을 함께 세우지 못하므로
+       넘친 뒤 남은 길이가 반 바퀴보다 짧을 때, 곧 프레임이 rxsize * 3 / 2 보다 짧을 때만 넘침을 알 수 있다.
+       플래그는 몇 바퀴 돌았는지 세지 않으므로 그보다 긴 프레임은 rxsize 를 충분히 크게 잡아 막는다 */
+    flags = spi_slave_flags(bus->dma->dma, bus->dma->rxstream);
+    spi_slave_clear_flags(bus->dma->dma, bus->dma->rxstream);
+    overflow = ((flags & (SPI_SLAVE_DMA_HTIF | SPI_SLAVE_DMA_TCIF)) == (SPI_SLAVE_DMA_HTIF | SPI_SLAVE_DMA_TCIF) &&
+                length < slave->rxsize / 2);
+    if (length == 0 && !overflow && !bus->pending)
+        return;
+
+    if (SPIx->SR & (SPI_SR_OVR | SPI_SR_MODF))
+        bus->stats.errors++;
+    if (length > 0 || overflow) {
+        if (!bus->fresh)
+            bus->stats.repeats++;
+        bus->fresh = 0;
+    }
+    spi_slave_restart(bus);
+
+    /* 넘친 프레임은 앞부분이 덮어써졌으므로 버린다 */
+    if (overflow) {
+        bus->head = pos;
+        bus->stats.errors++;
+        return;
+    }
+    if (length == 0)
+        return;
+
+    /* 버퍼 끝에서 되돌아간 프레임은 두 조각으로 알린다 */
+    frame.data = (const uint8_t *)slave->rx + bus->head * bus->width;
+    frame.length = (bus->head + length > slave->rxsize) ? slave->rxsize - bus->head : length;
+    frame.wrap = slave->rx;
+    frame.wraplength = length - frame.length;
+    bus->head = pos;
+    bus->stats.frames++;
+    bus->stats.bytes += length * bus->width;
+    if (slave->callback != NULL)
+        slave->callback(slave, &frame);
+}
+
+/* NSS 외부 인터럽트. 줄 번호만으로는 버스를 알 수 없으므로 NSS 가 high 인 버스를 모두 살핀다 */
+static void spi_slave_nss_handler(int i, int edge)
+{
+    uint8_t n;
+
+    (void)i;
+    (void)edge;
+    for (n = 0; n < sizeof(spi_slave_bus) / sizeof(spi_slave_bus[0]); n++)
+        if (spi_slave_bus[n].dma != NULL && gpio_read(spi_slave_bus[n].nss))
+            spi_slave_frame_end(&spi_slave_bus[n]);
+}
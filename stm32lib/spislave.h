@@ -0,0 +1,239 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+#ifndef SPISLAVE_H
+#define SPISLAVE_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup stm32lib
+ * @{
+ */
+
+/**
+ * @defgroup SPISLAVE
+ * @brief    DMA 원형 버퍼와 NSS 프레임 구분을 사용하는 SPI 슬레이브 라이브러리
+ * @{
+ *
+ * STM32 를 다른 프로세서의 SPI 슬레이브로 동작시킨다. NSS 는 하드웨어 핀을 사용하고,
+ * 마스터가 NSS 를 올리는 순간(rising edge)을 한 프레임의 끝으로 본다.
+ *
+ *  - 받기: 수신 DMA 는 원형 버퍼(rx)에 멈추지 않고 계속 받는다. 프레임이 끝나면
+ *    그 프레임이 들어 있는 위치를 @ref SPI_SlaveFrame_t 로 콜백 함수에 알려준다.
+ *    버퍼 끝에서 되돌아간 프레임은 두 조각(data, wrap)으로 전달된다
+ *  - 보내기: 응답은 두 개의 버퍼(tx[0], tx[1])를 번갈아 사용한다. 한 버퍼를 보내는 동안
+ *    @ref spi_slave_prepare() 로 다른 버퍼를 얻어 다음 응답을 채우고 @ref spi_slave_commit() 하면,
+ *    다음 프레임 경계에서 두 버퍼가 바뀐다. 새 응답이 없으면 이전 응답을 다시 보낸다.
+ *    마스터가 응답보다 길게 읽으면 응답이 처음부터 반복된다
+ *
+ * CPU 는 바이트마다가 아니라 프레임마다 NSS 외부 인터럽트를 한 번 받는다.
+ * 프레임 경계에서 이미 DR 에 들어간 이전 응답의 첫 프레임을 버리기 위해 SPI 를 리셋하고
+ * 다시 설정하므로, 마스터는 NSS 를 올린 뒤 이 인터럽트가 끝날 만큼(수 us) 기다린 후
+ * 다음 프레임을 시작해야 한다. 수신 버퍼보다 긴 프레임은 앞부분을 잃는다.
+ * 넘침은 수신 DMA 의 HT/TC 플래그로 알아채므로 길이가 rxsize 이상 rxsize * 3 / 2 미만인 프레임만
+ * 버리고 errors 로 센다. 그보다 긴 프레임은 마지막 부분이 정상 프레임처럼 전달될 수 있으므로,
+ * rxsize 는 마스터가 NSS 한 번에 보낼 수 있는 가장 긴 프레임(잘못 보낸 것 포함)의 2/3 보다 크게 잡는다.
+ *
+ * DMA 스트림은 @ref SPIASYNC 와 같은 것을 사용하므로 한 버스에서 둘을 함께 쓸 수 없다.
+ * NSS 핀은 다음 중에서 고른다.
+ *
+\verbatim
+SPI     NSS 핀
+SPI1    PA_4, PA_15
+SPI2    PB_12, PB_9
+SPI3    PA_4, PA_15
+\endverbatim
+ *
+ * \par 사용 예
+ *
+\code
+static uint8_t rx[256], tx0[32], tx1[32];
+static SPI_Slave_t sensor = {rx, sizeof(rx), {tx0, tx1}, sizeof(tx0), frame_received, NULL};
+
+spi_init(SPI_1, SPI1_PINS1);
+spi_slave_init(SPI_1, GPIO_PA_4, SPI_Mode0, 8, &sensor);
+
+// 새 측정값이 준비될 때마다
+uint8_t *next = spi_slave_prepare(SPI_1);
+if (next != NULL) {
+    memcpy(next, sample, sizeof(sample));
+    spi_slave_commit(SPI_1, sizeof(sample));
+}
+\endcode
+ *
+ * \par Changelog
+ *
+\verbatim
+ 버전 1.0
+  - 최초 배포
+\endverbatim
+ *
+ * \par 의존성
+ *
+\verbatim
+ - STM32F4xx HAL
+ - SPI
+ - GPIO
+ - EXTIRQ
+\endverbatim
+ */
+#include "stm32f4xx_hal.h"
+#include "../stm32lib/spi.h"
+#include "../stm32lib/gpio.h"
+
+/**
+ * @defgroup SPISLAVE_자료형
+ * @brief    SPISLAVE 자료형
+ * @{
+ */
+
+typedef struct SPI_Slave SPI_Slave_t;
+
+/**
+ * @brief  받은 프레임 구조체. 길이는 모두 SPI 프레임(8 또는 16 비트) 단위이다
+ */
+typedef struct {
+    const void *data;      /*!< 프레임의 시작 위치 (수신 버퍼 안) */
+    uint16_t length;       /*!< data 에서 이어지는 프레임 수 */
+    const void *wrap;      /*!< 버퍼 끝에서 되돌아간 나머지 (수신 버퍼의 시작) */
+    uint16_t wraplength;   /*!< wrap 의 프레임 수, 되돌아가지 않았으면 0 */
+} SPI_SlaveFrame_t;
+
+/**
+ * @brief  NSS 가 올라가 한 프레임이 끝난 뒤 호출되는 함수 (인터럽트 문맥)
+ * @note   frame 이 가리키는 데이터는 수신 버퍼가 한 바퀴 돌기 전까지만 유효하다
+ * @param  slave: 슬레이브 구조체
+ * @param  frame: 받은 프레임
+ */
+typedef void (*SPI_SlaveCallback_t)(SPI_Slave_t* slave, const SPI_SlaveFrame_t* frame);
+
+/**
+ * @brief  슬레이브 버퍼 구조체. 버퍼 크기는 모두 프레임 단위이며, 16 비트 프레임이면 uint16_t 배열이다
+ */
+struct SPI_Slave {
+    void *rx;                      /*!< 수신 원형 버퍼 */
+    uint16_t rxsize;               /*!< 수신 버퍼의 프레임 수. 가장 긴 프레임보다 커야 한다.
+                                        넘친 프레임은 rxsize * 3 / 2 보다 짧을 때만 알아채고 버린다 */
+    void *tx[2];                   /*!< 응답 이중 버퍼 */
+    uint16_t txsize;               /*!< 응답 버퍼 하나의 프레임 수 */
+    SPI_SlaveCallback_t callback;  /*!< 프레임 수신 콜백 함수, NULL 가능 */
+    void *arg;                     /*!< 콜백 함수에서 사용할 사용자 인자 */
+};
+
+/**
+ * @brief  슬레이브 통계 구조체
+ */
+typedef struct {
+    uint32_t frames;     /*!< 받은 프레임(NSS 구간) 수 */
+    uint32_t bytes;      /*!< 받은 바이트 수 */
+    uint32_t responses;  /*!< 새로 보내기 시작한 응답 수 */
+    uint32_t repeats;    /*!< 새 응답이 준비되지 않아 이전 응답을 다시 보낸 프레임 수 */
+    uint32_t errors;     /*!< 오버런(OVR), 모드 오류(MODF) 또는 수신 버퍼를 넘쳐 버린 프레임 수 */
+} SPI_SlaveStats_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup SPISLAVE_함수
+ * @brief    SPISLAVE 함수
+ * @{
+ */
+
+/**
+ * @brief  SPI 버스를 하드웨어 NSS 슬레이브로 설정하고 DMA 를 시작한다
+ * @note   핀은 먼저 @ref spi_init() 로 초기화해야 한다
+ * @param  SPI_Num: 선택할 SPI 번호 (SPI_1, SPI_2, SPI_3)
+ * @param  nss: NSS 핀
+ * @param  mode: 클럭 극성과 위상. 마스터와 같아야 한다
+ * @param  bits: 프레임 비트 수, 8 또는 16
+ * @param  slave: 버퍼 구조체. 슬레이브가 동작하는 동안 유지되어야 한다
+ * @retval 실행 상태, 1: 정상, -1: 오류(지원하지 않는 버스나 NSS 핀, SPIASYNC 가 사용 중인 버스,
+ *         이미 사용 중인 외부 인터럽트)
+ */
+int spi_slave_init(SPI_t SPI_Num, GPIO_Pin_t nss, SPI_Mode_t mode, int bits, SPI_Slave_t* slave);
+
+/**
+ * @brief  슬레이브 동작을 멈춘다
+ * @param  SPI_Num: 선택할 SPI 번호
+ * @retval 없음
+ */
+void spi_slave_deinit(SPI_t SPI_Num);
+
+/**
+ * @brief  다음 응답을 채울 버퍼를 얻는다
+ * @param  SPI_Num: 선택할 SPI 번호
+ * @retval 응답 버퍼, 앞서 commit 한 응답이 아직 보내지기 시작하지 않았으면 NULL
+ */
+void* spi_slave_prepare(SPI_t SPI_Num);
+
+/**
+ * @brief  @ref spi_slave_prepare() 로 채운 응답을 다음 프레임부터 보내도록 한다
+ * @param  SPI_Num: 선택할 SPI 번호
+ * @param  length: 응답의 프레임 수 (1 ~ txsize)
+ * @retval 실행 상태, 1: 정상, -1: 오류
+ */
+int spi_slave_commit(SPI_t SPI_Num, uint16_t length);
+
+/**
+ * @brief  슬레이브 통계를 얻는다
+ * @param  SPI_Num: 선택할 SPI 번호
+ * @param  stats: 통계를 저장할 구조체
+ * @retval 없음
+ */
+void spi_slave_get_stats(SPI_t SPI_Num, SPI_SlaveStats_t* stats);
+
+/**
+ * @brief  슬레이브 통계를 지운다
+ * @param  SPI_Num: 선택할 SPI 번호
+ * @retval 없음
+ */
+void spi_slave_reset_stats(SPI_t SPI_Num);
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -27,10 +27,8 @@
  */
 #include "../stm32lib/ssd1306.h"
 
-/* Write command */
-#define ssd1306_writecommand(command)      i2c_write(SSD1306_I2C, SSD1306_I2C_ADDR, 0x00, (command))
-/* Write data */
-#define ssd1306_writedata(data)            i2c_write(SSD1306_I2C, SSD1306_I2C_ADDR, 0x40, (data))
+/* Write command list in one transfer */
+#define ssd1306_writecommands(list, n)     transport_command(ssd1306_bus, (list), (n))
 /* Absolute value */
 #define ABS(x)   ((x) > 0 ? (x) : -(x))
 
@@ -42,20 +40,77 @@ typedef struct {
     uint16_t cursor_x;
     uint16_t cursor_y;
     uint8_t inverted;
+    uint8_t smooth;
     uint8_t initialized;
 } SSD1306_t;
 
 /* Private variable */
 static SSD1306_t SSD1306;
 
+/* 사용하는 전송 */
+static Transport_t *ssd1306_bus;
+
+/* ssd1306_init() 이 만드는 기본 전송 */
+static Transport_t ssd1306_transport;
+
+/* 초기화 명령 목록 */
+static const uint8_t ssd1306_init_commands[] = {
+    0xAE, //display off
+    0x20, //Set Memory Addressing Mode
+    0x10, //00,Horizontal Addressing Mode;01,Vertical Addressing Mode;10,Page Addressing Mode (RESET);11,Invalid
+    0xB0, //Set Page Start Address for Page Addressing Mode,0-7
+    0xC8, //Set COM Output Scan Direction
+    0x00, //---set low column address
+    0x10, //---set high column address
+    0x40, //--set start line address
+    0x81, //--set contrast control register
+    0xFF,
+    0xA1, //--set segment re-map 0 to 127
+    0xA6, //--set normal display
+    0xA8, //--set multiplex ratio(1 to 64)
+    0x3F, //
+    0xA4, //0xa4,Output follows RAM content;0xa5,Output ignores RAM content
+    0xD3, //-set display offset
+    0x00, //-not offset
+    0xD5, //--set display clock divide ratio/oscillator frequency
+    0xF0, //--set divide ratio
+    0xD9, //--set pre-charge period
+    0x22, //
+    0xDA, //--set com pins hardware configuration
+    0x12,
+    0xDB, //--set vcomh
+    0x20, //0x20,0.77xVcc
+    0x8D, //--set DC-DC enable
+    0x14, //
+    0xAF, //--turn on SSD1306 panel
+};
+
 SSD1306_Res_t ssd1306_init(void)
 {
-    /* I2C 초기화 */
-    i2c_init(SSD1306_I2C, SSD1306_I2C_PINSPACK);
-    i2c_set_frequency(SSD1306_I2C, 4000000);
-    
+#ifdef SSD1306_SPI
+    /* 리셋 */
+    if (SSD1306_SPI_RST != GPIO_NC) {
+        gpio_init(SSD1306_SPI_RST, GPIO_OUT);
+        gpio_write(SSD1306_SPI_RST, 0);
+        HAL_Delay(1);
+        gpio_write(SSD1306_SPI_RST, 1);
+    }
+    if (transport_spi(&ssd1306_transport, SSD1306_SPI, SSD1306_SPI_CS, SSD1306_SPI_DC, SPI_Mode0, SSD1306_SPI_CLOCK) < 0)
+        return SSD1306_RES_ERR;
+#else
+    /* 공유 I2C 버스에 장치 등록 */
+    if (transport_i2c(&ssd1306_transport, SSD1306_I2C, SSD1306_I2C_PINSPACK, SSD1306_I2C_ADDR, SSD1306_I2C_CLOCK) < 0)
+        return SSD1306_RES_ERR;
+#endif
+    return ssd1306_init_transport(&ssd1306_transport);
+}
+
+SSD1306_Res_t ssd1306_init_transport(Transport_t* t)
+{
+    ssd1306_bus = t;
+
     /* 장치 연결 점검 */
-    if (i2c_ready(SSD1306_I2C, SSD1306_I2C_ADDR) < 0) {
+    if (transport_ready(ssd1306_bus) < 0) {
         /* 오류 반환 */
         return SSD1306_RES_NOTCONNECT;
     }
@@ -65,34 +120,8 @@ SSD1306_Res_t ssd1306_init(void)
     HAL_Delay(100);
     
     /* LCD 초기화 */
-    ssd1306_writecommand(0xAE); //display off
-    ssd1306_writecommand(0x20); //Set Memory Addressing Mode   
-    ssd1306_writecommand(0x10); //00,Horizontal Addressing Mode;01,Vertical Addressing Mode;10,Page Addressing Mode (RESET);11,Invalid
-    ssd1306_writecommand(0xB0); //Set Page Start Address for Page Addressing Mode,0-7
-    ssd1306_writecommand(0xC8); //Set COM Output Scan Direction
-    ssd1306_writecommand(0x00); //---set low column address
-    ssd1306_writecommand(0x10); //---set high column address
-    ssd1306_writecommand(0x40); //--set start line address
-    ssd1306_writecommand(0x81); //--set contrast control register
-    ssd1306_writecommand(0xFF);
-    ssd1306_writecommand(0xA1); //--set segment re-map 0 to 127
-    ssd1306_writecommand(0xA6); //--set normal display
-    ssd1306_writecommand(0xA8); //--set multiplex ratio(1 to 64)
-    ssd1306_writecommand(0x3F); //
-    ssd1306_writecommand(0xA4); //0xa4,Output follows RAM content;0xa5,Output ignores RAM content
-    ssd1306_writecommand(0xD3); //-set display offset
-    ssd1306_writecommand(0x00); //-not offset
-    ssd1306_writecommand(0xD5); //--set display clock divide ratio/oscillator frequency
-    ssd1306_writecommand(0xF0); //--set divide ratio
-    ssd1306_writecommand(0xD9); //--set pre-charge period
-    ssd1306_writecommand(0x22); //
-    ssd1306_writecommand(0xDA); //--set com pins hardware configuration
-    ssd1306_writecommand(0x12);
-    ssd1306_writecommand(0xDB); //--set vcomh
-    ssd1306_writecommand(0x20); //0x20,0.77xVcc
-    ssd1306_writecommand(0x8D); //--set DC-DC enable
-    ssd1306_writecommand(0x14); //
-    ssd1306_writecommand(0xAF); //--turn on SSD1306 panel
+    if (ssd1306_writecommands(ssd1306_init_commands, sizeof(ssd1306_init_commands)) < 0)
+        return SSD1306_RES_ERR;
     
     /* 스크린 지움 */
     ssd1306_fill(SSD1306_COLOR_BLACK);
@@ -103,6 +132,7 @@ SSD1306_Res_t ssd1306_init(void)
     /* 기본 값 설정 */
     SSD1306.cursor_x = 0;
     SSD1306.cursor_y = 0;
+    SSD1306.smooth = SSD1306_SMOOTH_TEXT;
     
     /* Initialized OK */
     SSD1306.initialized = 1;
@@ -114,14 +144,15 @@ SSD1306_Res_t ssd1306_init(void)
 void ssd1306_updatescreen(void)
 {
     uint8_t m;
+    uint8_t commands[3] = {0xB0, 0x00, 0x10};
     
-    for (m = 0; m < 8; m++) {
-        ssd1306_writecommand(0xB0 + m);
-        ssd1306_writecommand(0x00);
-        ssd1306_writecommand(0x10);
+    for (m = 0; m < SSD1306_HEIGHT / 8; m++) {
+        commands[0] = 0xB0 + m;
         
-        /* Write multi data */
-        i2c_nwrite(SSD1306_I2C, SSD1306_I2C_ADDR, 0x40, &SSD1306_Buffer[SSD1306_WIDTH * m], SSD1306_WIDTH);
+        /* 페이지 주소 명령과 페이지 데이터를 한 번의 전송으로 쓴다.
+           I2C 는 다른 장치가 기다리지 않도록 페이지마다 버스를 점유하고 놓는다 */
+        if (transport_write(ssd1306_bus, commands, sizeof(commands), &SSD1306_Buffer[SSD1306_WIDTH * m], SSD1306_WIDTH) < 0)
+            return;
     }
 }
 
@@ -188,15 +219,14 @@ char ssd1306_putc(uint16_t ch, Font_t *font, SSD1306_Color_t color, uint8_t size
     }
     
     /* Go through font */
-    if (font->type == ASCII_FONT) {
+    if (size > 1) {
+        ssd1306_putc_scaled(ch, font, color, size);
+    } else if (font->type == ASCII_FONT) {
         for (i = 0; i < font->height; i++) {
             b = font->data.data[(ch - font->first) * font->height + i];
             for (j = 0; j < font->width; j++) {
                 if ((b << j) & 0x8000) {
-                    if (size == 1)
-                        ssd1306_drawpixel(SSD1306.cursor_x + j, (SSD1306.cursor_y + i), color);
-                    else
-                        ssd1306_fillrectangle(SSD1306.cursor_x + j*size, SSD1306.cursor_y + i*size, size, size, color);
+                    ssd1306_drawpixel(SSD1306.cursor_x + j, (SSD1306.cursor_y + i), color);
                 }/* else {
                     ssd1306_drawpixel(SSD1306.cursor_x + j, (SSD1306.cursor_y + i), (SSD1306_Color_t)!color);
                 }*/
@@ -206,6 +236,10 @@ char ssd1306_putc(uint16_t ch, Font_t *font, SSD1306_Color_t color, uint8_t size
         ssd1306_putc_gfx(ch, font, color, size);
     } else if (font->type == COMB_FONT) {
         ssd1306_putc_hangul(ch, font, color, size);
+    } else if (font->type == PAGE_FONT) {
+        ssd1306_putc_page(ch, font, color, size);
+    } else if (font->type == STORE_FONT) {
+        ssd1306_putc_scaled(ch, font, color, 1);
     }
     
     /* Increase pointer */
@@ -224,25 +258,19 @@ char ssd1306_putc_gfx(uint16_t ch, Font_t* font, SSD1306_Color_t color, uint8_t
 
     uint32_t bo = glyph->bitmapOffset;
     uint8_t  w  = glyph->width, h  = glyph->height;
-    int8_t   xo = glyph->xOffset, yo = 0/*glyph->yOffset*/;
+    int8_t   xo = glyph->xOffset, yo = glyph->yOffset + GFXFONT_BASELINE(gfxfont);
     uint8_t  xx, yy, bits = 0, bit = 0;
-    int16_t  xo16 = 0, yo16 = 0;
     //printf("ch=%d, offset=%ld, w=%d, h=%d\r\n", ch, bo, w, h);
 
-    if (size > 1) {
-        xo16 = xo;
-        yo16 = yo;
-    }
+    if (size > 1)
+        return ssd1306_putc_scaled(ch + gfxfont->first, font, color, size);
     for(yy=0; yy<h; yy++) {
         for(xx=0; xx<w; xx++) {
             if(!(bit++ & 7)) {
                 bits = bitmap[bo++];
             }
             if(bits & 0x80) {
-                if (size == 1)
-                    ssd1306_drawpixel(SSD1306.cursor_x + xo + xx, (SSD1306.cursor_y + yo + yy), color);
-                else
-                    ssd1306_fillrectangle(SSD1306.cursor_x + (xo16+xx)*size, SSD1306.cursor_y + (yo16+yy)*size, size, size, color);
+                ssd1306_drawpixel(SSD1306.cursor_x + xo + xx, (SSD1306.cursor_y + yo + yy), color);
             }
             bits <<= 1;
         }
@@ -256,6 +284,9 @@ char ssd1306_putc_hangul(uint16_t ch, Font_t* font, SSD1306_Color_t color, uint8
     uint8_t wb = font->width/8;
     uint8_t b, *pFs;
     
+    if (size > 1)
+        return ssd1306_putc_scaled(ch, font, color, size);
+
     /* Go through font */
     pFs = get_hangul_glyph(ch, font);
     for (i = 0; i < font->height; i++) {
@@ -263,10 +294,7 @@ char ssd1306_putc_hangul(uint16_t ch, Font_t* font, SSD1306_Color_t color, uint8
         b = pFs[i*wb+w];
         for (j = 0; j < 8; j++) {
             if ((b << j) & 0x80) {
-                if (size == 1)
-                    ssd1306_drawpixel(SSD1306.cursor_x + w*8 + j, SSD1306.cursor_y + i, color);
-                else
-                    ssd1306_fillrectangle(SSD1306.cursor_x + (w*8 + j)*size, SSD1306.cursor_y + i*size, size, size, color);
+                ssd1306_drawpixel(SSD1306.cursor_x + w*8 + j, SSD1306.cursor_y + i, color);
             }/* else {
                 ssd1306_drawpixel(SSD1306.cursor_x + w*8 + j, (SSD1306.cursor_y + i), (SSD1306_Color_t)!color);
             }*/
@@ -276,45 +304,149 @@ char ssd1306_putc_hangul(uint16_t ch, Font_t* font, SSD1306_Color_t color, uint8
     return 1;
 }
 
+char ssd1306_putc_page(uint16_t ch, Font_t* font, SSD1306_Color_t color, uint8_t size)
+{
+    uint16_t i, p, w;
+    uint8_t pages = PAGEFONT_PAGES(font);
+    uint8_t shift = SSD1306.cursor_y % 8;
+    uint8_t page0 = SSD1306.cursor_y / 8;
+    const uint8_t *pFs = font->data.page + (ch - font->first) * PAGEFONT_GLYPH_SIZE(font);
+    uint8_t *pB;
+
+    if (size > 1)
+        return ssd1306_putc_scaled(ch, font, color, size);
+
+    /* Check if pixels are inverted */
+    if (SSD1306.inverted) {
+        color = (SSD1306_Color_t)!color;
+    }
+
+    /* 페이지 단위로 자리 이동하여 버퍼에 복사 */
+    for (p = 0; p < pages; p++) {
+        pB = &SSD1306_Buffer[SSD1306.cursor_x + (page0 + p) * SSD1306_WIDTH];
+        for (i = 0; i < font->width; i++) {
+            w = (uint16_t)*pFs++ << shift;
+            if (color == SSD1306_COLOR_WHITE) {
+                pB[i] |= (uint8_t)w;
+                if ((w >> 8) && page0 + p + 1 < SSD1306_HEIGHT / 8)
+                    pB[i + SSD1306_WIDTH] |= (uint8_t)(w >> 8);
+            } else {
+                pB[i] &= ~(uint8_t)w;
+                if ((w >> 8) && page0 + p + 1 < SSD1306_HEIGHT / 8)
+                    pB[i + SSD1306_WIDTH] &= ~(uint8_t)(w >> 8);
+            }
+        }
+    }
+    return 1;
+}
+
+/* 버퍼의 사각형 영역을 페이지마다 한 번 계산한 바이트 마스크로 채운다 */
+static void ssd1306_fillspan(int16_t x, int16_t y, int16_t w, int16_t h, SSD1306_Color_t color)
+{
+    int16_t i, y1;
+    uint16_t p;
+    uint8_t mask, *pB;
+
+    /* Clip to the screen */
+    if (x < 0) {
+        w += x;
+        x = 0;
+    }
+    if (y < 0) {
+        h += y;
+        y = 0;
+    }
+    if (x + w > SSD1306_WIDTH)
+        w = SSD1306_WIDTH - x;
+    if (y + h > SSD1306_HEIGHT)
+        h = SSD1306_HEIGHT - y;
+    if (w <= 0 || h <= 0)
+        return;
+
+    /* Check if pixels are inverted */
+    if (SSD1306.inverted) {
+        color = (SSD1306_Color_t)!color;
+    }
+
+    y1 = y + h;
+    for (p = y / 8; p * 8 < y1; p++) {
+        mask = 0xFF;
+        if (p * 8 < y)
+            mask &= 0xFF << (y % 8);
+        if (p * 8 + 8 > y1)
+            mask &= 0xFF >> (8 - y1 % 8);
+        pB = &SSD1306_Buffer[x + p * SSD1306_WIDTH];
+        if (color == SSD1306_COLOR_WHITE) {
+            for (i = 0; i < w; i++)
+                pB[i] |= mask;
+        } else {
+            for (i = 0; i < w; i++)
+                pB[i] &= ~mask;
+        }
+    }
+}
+
+char ssd1306_putc_scaled(uint16_t ch, Font_t* font, SSD1306_Color_t color, uint8_t size)
+{
+    static FontGlyph_t glyph, smooth;
+    FontGlyph_t *g = &glyph;
+    uint8_t scale = size;
+    uint16_t i, n, a, b;
+    uint32_t row;
+
+    font_getglyph(font, ch, &glyph);
+    if (SSD1306.smooth && !(size & 1) && font_scale2x(&glyph, &smooth)) {
+        g = &smooth;
+        scale = size / 2;
+    }
+
+    for (i = 0; i < g->height; i += n) {
+        row = g->rows[i];
+        /* 같은 행이 이어지면 한 번에 그린다 */
+        for (n = 1; i + n < g->height && g->rows[i + n] == row; n++);
+        /* 행을 연속된 픽셀 구간으로 나눈다 */
+        for (a = 0; row; a = b) {
+            for (; !(row & 0x80000000UL); row <<= 1)
+                a++;
+            for (b = a; row & 0x80000000UL; row <<= 1)
+                b++;
+            ssd1306_fillspan(SSD1306.cursor_x + (g->x + a) * scale,
+                             SSD1306.cursor_y + (g->y + i) * scale,
+                             (b - a) * scale, n * scale, color);
+        }
+    }
+    return 1;
+}
+
+void ssd1306_setsmooth(uint8_t enable)
+{
+    SSD1306.smooth = enable ? 1 : 0;
+}
+
 char ssd1306_puts(char* str, FontSet_t* fontset, SSD1306_Color_t color, uint8_t size)
 {
-    int i;
-    char c, c2, c3;
     char count=0;
-    uint16_t utf16;
+    uint16_t utf16, next;
+    Font_t *font;
     int cursor_x = SSD1306.cursor_x;
 
     /* Write characters */
-    while (*str) {
-        c = *str++;
+    utf16 = font_getutf16(&str);
+    while (utf16) {
+        /* 커닝을 위해 다음 글자를 미리 읽는다 */
+        next = font_getutf16(&str);
         count++;
 
-        // convert utf-8 to unicode
-        if (c <= 0x7F){
-            utf16 = c;
-        } else {
-            /*------------------------------
-              UTF-8 을 UTF-16으로 변환한다.  UTF-8 1110xxxx 10xxxxxx 10xxxxxx
-            ------------------------------*/
-            c2 = *str++;
-            c3 = *str++;
-            utf16 = ((c & 0x0f) << 12) | ((c2 & 0x3f) << 6) | (c3 & 0x3f);
-        }
         if (utf16 == '\n') {
             /* Increase pointer */
             SSD1306.cursor_x = cursor_x;
             SSD1306.cursor_y += size * fontset->height;
-        } else {
+        } else if ((font = font_find(utf16, fontset)) != NULL) {
             /* Write character by character */
-            for (i = 0; fontset->fontlist[i] && i < 5; i++) {
-                Font_t *font = fontset->fontlist[i];
-                if (utf16 >= font->first && utf16 <= font->last) {
-                    ssd1306_putc(utf16, font, color, size);
-                    SSD1306.cursor_x += size * font->width;
-                    break;
-                }
-            }
+            ssd1306_putc(utf16, font, color, size);
+            SSD1306.cursor_x += size * font_getadvance(font, utf16, next);
         }
+        utf16 = next;
     }
     
     /* Everything OK, char count should be returned */
@@ -597,14 +729,14 @@ void ssd1306_fillcircle(int16_t x0, int16_t y0, int16_t r, SSD1306_Color_t c)
  
 void ssd1306_on(void)
 {
-    ssd1306_writecommand(0x8D);  
-    ssd1306_writecommand(0x14);  
-    ssd1306_writecommand(0xAF);  
+    static const uint8_t commands[] = {0x8D, 0x14, 0xAF};
+    
+    ssd1306_writecommands(commands, sizeof(commands));
 }
 
 void ssd1306_off(void)
 {
-    ssd1306_writecommand(0x8D);  
-    ssd1306_writecommand(0x10);
-    ssd1306_writecommand(0xAE);  
+    static const uint8_t commands[] = {0x8D, 0x10, 0xAE};
+    
+    ssd1306_writecommands(commands, sizeof(commands));
 }
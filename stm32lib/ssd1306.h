@@ -43,7 +43,9 @@ extern "C" {
  * @brief    STM32F4xx를 위한 SSD1306 I2C LCD 드라이버 라이브러리
  * @{
  *
- * SSD1306 LCD 장치는 I2C 통신을 사용한다
+ * SSD1306 LCD 장치는 I2C 통신을 사용한다.
+ * 버스는 @ref TRANSPORT 로 감싸져 있으므로 SPI 모델은 SSD1306_SPI 를 정의하거나,
+ * 다른 전송(소프트웨어 I2C 등)을 @ref ssd1306_init_transport() 에 넘겨서 사용할 수 있다.
  *
  * 이 라이브러리는 선, 사각형, 원을 그리는 기능을 물론
  * 영문/한글 글자를 쓰는 기능을 포함하고 있다.
@@ -73,6 +75,15 @@ SDA        PB9          I2C 를 위한 데이터 핀
 //LCD의 넓이 및 높이
 #define SSD1306_WIDTH            128
 #define SSD1306_HEIGHT           64
+\endcode
+ *
+ * SPI 모델은 다음과 같이 정의한다. SPI 버스는 @ref spi_init() 으로 먼저 초기화되어 있어야 한다.
+ *
+\code
+#define SSD1306_SPI              SPI_1
+#define SSD1306_SPI_CS           GPIO_PB_6
+#define SSD1306_SPI_DC           GPIO_PC_7
+#define SSD1306_SPI_RST          GPIO_PA_8
 \endcode
  *
  * \par Changelog
@@ -86,18 +97,20 @@ SDA        PB9          I2C 를 위한 데이터 핀
  *
 \verbatim
  - STM32F4xx HAL
- - I2C
+ - TRANSPORT
  - FONT
  - HANGULFONT
+ - PAGEFONT
  - string.h
  - stdlib.h
 \endverbatim
  */
 
 #include "stm32f4xx_hal.h"
-#include "../stm32lib/i2c.h"
+#include "../stm32lib/transport.h"
 #include "../stm32lib/font.h"
 #include "../stm32lib/hangulfont.h"
+#include "../stm32lib/pagefont.h"
 #include "stdlib.h"
 #include "string.h"
 
@@ -118,6 +131,27 @@ SDA        PB9          I2C 를 위한 데이터 핀
 #define SSD1306_I2C_ADDR         0x78
 #endif
 
+/* I2C 클럭 */
+#ifndef SSD1306_I2C_CLOCK
+#define SSD1306_I2C_CLOCK        400000
+#endif
+
+/* SPI 설정. SSD1306_SPI 를 정의하면 I2C 대신 SPI 를 사용한다 */
+#ifdef SSD1306_SPI
+#ifndef SSD1306_SPI_CS
+#define SSD1306_SPI_CS           GPIO_PB_6
+#endif
+#ifndef SSD1306_SPI_DC
+#define SSD1306_SPI_DC           GPIO_PC_7
+#endif
+#ifndef SSD1306_SPI_RST
+#define SSD1306_SPI_RST          GPIO_NC
+#endif
+#ifndef SSD1306_SPI_CLOCK
+#define SSD1306_SPI_CLOCK        8000000
+#endif
+#endif
+
 /* SSD1306 설정 */
 /* SSD1306 넓이 픽셀단위 */
 #ifndef SSD1306_WIDTH
@@ -127,6 +161,10 @@ SDA        PB9          I2C 를 위한 데이터 핀
 #ifndef SSD1306_HEIGHT
 #define SSD1306_HEIGHT           64
 #endif
+/* 확대된 글자에 scale2x 부드럽게 하기를 기본으로 적용할지 여부 */
+#ifndef SSD1306_SMOOTH_TEXT
+#define SSD1306_SMOOTH_TEXT      0
+#endif
 
 /**
  * @}
@@ -174,6 +212,16 @@ typedef enum {
  */
 SSD1306_Res_t ssd1306_init(void);
 
+/**
+ * @brief  주어진 전송으로 SSD1306 그래픽 장치를 초기화한다
+ * @note   전송 구조체는 사용하는 동안 유지되어야 한다
+ * @param  *t: @ref transport_i2c(), @ref transport_spi(), @ref transport_swi2c() 등으로 초기화된 전송
+ * @retval 초기화 상태:
+ *            - SSD1306_RES_OK: 정상
+ *            - 다른 값: 다른 경우
+ */
+SSD1306_Res_t ssd1306_init_transport(Transport_t* t);
+
 /** 
  * @brief  그래픽 장치의 내부 RAM 버퍼를 갱신한다
  * @note   이 함수는 그래픽 장치의 내용이 바뀔 때마다 내부 RAM 버퍼를 갱신하기 위해 호출되어야 한다.
@@ -227,6 +275,27 @@ void ssd1306_gotoxy(uint16_t x, uint16_t y);
 char ssd1306_putc(uint16_t ch, Font_t *font, SSD1306_Color_t color, uint8_t size);
 char ssd1306_putc_gfx(uint16_t ch, Font_t* font, SSD1306_Color_t color, uint8_t size);
 char ssd1306_putc_hangul(uint16_t ch, Font_t* font, SSD1306_Color_t color, uint8_t size);
+char ssd1306_putc_page(uint16_t ch, Font_t* font, SSD1306_Color_t color, uint8_t size);
+
+/**
+ * @brief  확대된 글자를 쓴다
+ * @note   글자의 각 행을 연속된 픽셀 구간으로 나누어 구간마다 한 번씩 버퍼를 채운다.
+ *         모든 폰트 종류에 대해 size 가 1보다 크면 @ref ssd1306_putc() 가 이 함수를 사용한다
+ * @param  ch: 쓰여질 글자
+ * @param  *font: 사용된 폰트에 대한 @ref Font_t 구조체의 포인터
+ * @param  color: 그리는 데 사용할 색. 이 매개변수는 @ref SSD1306_Color_t 열거형 값
+ * @param  size: 확대 배율
+ * @retval 쓰여진 글자 수(=1 or 0)
+ */
+char ssd1306_putc_scaled(uint16_t ch, Font_t* font, SSD1306_Color_t color, uint8_t size);
+
+/**
+ * @brief  확대된 글자에 scale2x 부드럽게 하기를 적용할지 정한다
+ * @note   배율이 짝수일 때만 적용된다. 기본값은 @ref SSD1306_SMOOTH_TEXT
+ * @param  enable: 0이면 적용하지 않음, 그 외에는 적용함
+ * @retval 없음
+ */
+void ssd1306_setsmooth(uint8_t enable);
 
 /**
  * @brief  그래픽 장치에 문자열을 쓴다
@@ -31,6 +31,8 @@
 #define ssd1331_writecommand(command)      spi_writeread(SSD1331_SPI, (command))
 /* Write data */
 #define ssd1331_writedata(data)            spi_writeread(SSD1331_SPI, (data))
+/* Write multiple commands or data */
+#define ssd1331_writebytes(list, n)        spi_nwrite(SSD1331_SPI, (list), (n))
 /* Absolute value */
 #define ABS(x)   ((x) > 0 ? (x) : -(x))
 
@@ -39,12 +41,17 @@ typedef struct {
     uint16_t cursor_x;
     uint16_t cursor_y;
     uint8_t inverted;
+    uint8_t smooth;
     uint8_t initialized;
 } SSD1331_t;
 
 /* Private variable */
 static SSD1331_t SSD1331;
 
+/* Private functions */
+static void ssd1331_fillspan(int16_t x, int16_t y, int16_t w, int16_t h, SSD1331_Color_t color);
+static void ssd1331_window(int16_t x, int16_t y, int16_t w, int16_t h);
+
 void ssd1331_init(void)
 {
     /* SPI 초기화 */
@@ -73,12 +80,12 @@ void ssd1331_init(void)
     HAL_Delay(1);
     gpio_write(SSD1331_RS_PIN, 1);
     HAL_Delay(50);
-    gpio_write(SSD1331_CS_PIN, 0);
+    spi_select(SSD1331_SPI, SSD1331_CS_PIN);
 
     /* LCD 초기화 */
     ssd1331_writecommand(0xAE); //display off
     ssd1331_writecommand(0xA0); //Set ReMap   
-    ssd1331_writecommand(0xB2); //65k format 2, RGB
+    ssd1331_writecommand(0x72); //65k format 1 (RGB565, 2 bytes/pixel), RGB
     ssd1331_writecommand(0xA1); //Set Display Start Line 
     ssd1331_writecommand(0x00);
     ssd1331_writecommand(0xA2); //Set Display Offset
@@ -124,7 +131,7 @@ void ssd1331_init(void)
 
     ssd1331_writecommand(0xA4); //Normal Display
     ssd1331_writecommand(0xAF); //--turn on SSD1331 panel
-    gpio_write(SSD1331_CS_PIN, 1);
+    spi_deselect(SSD1331_SPI, SSD1331_CS_PIN);
     HAL_Delay(1);
     
     /* 스크린 지움 */
@@ -133,6 +140,7 @@ void ssd1331_init(void)
     /* 기본 값 설정 */
     SSD1331.cursor_x = 0;
     SSD1331.cursor_y = 0;
+    SSD1331.smooth = SSD1331_SMOOTH_TEXT;
     
     /* Initialized OK */
     SSD1331.initialized = 1;
@@ -140,16 +148,14 @@ void ssd1331_init(void)
 
 void ssd1331_fill(SSD1331_Color_t color)
 {
-    uint8_t x, y;
-    
-    for (y = 0; y < SSD1331_HEIGHT; y++)
-        for (x = 0; x < SSD1331_WIDTH; x++)
-            ssd1331_drawpixel(x, y, color);
+    /* 화면 전체를 한 창으로 설정하여 연속으로 채운다 */
+    ssd1331_fillspan(0, 0, SSD1331_WIDTH, SSD1331_HEIGHT, color);
 }
 
 void ssd1331_drawpixel(uint16_t x, uint16_t y, SSD1331_Color_t color)
 {
-    uint8_t c[3];
+    uint16_t pixel = SSD1331_RGB565(color);
+    uint8_t c[2];
 
     if (
         x >= SSD1331_WIDTH ||
@@ -159,22 +165,12 @@ void ssd1331_drawpixel(uint16_t x, uint16_t y, SSD1331_Color_t color)
         return;
     }
 
-    gpio_write(SSD1331_DC_PIN, 0); /* command */
-    gpio_write(SSD1331_CS_PIN, 0); /* enable chip */
-    ssd1331_writecommand(0x15); // set x position
-    ssd1331_writecommand(x & 0xff);
-    ssd1331_writecommand(0x5F);
-    ssd1331_writecommand(0x75); // set y position
-    ssd1331_writecommand(y & 0xff);
-    ssd1331_writecommand(0x3F);
-    gpio_write(SSD1331_DC_PIN, 1); /* data */
-    c[0] = ((color>>16)&0xFF)>>2;
-    c[1] = ((color>>8)&0xFF)>>2;
-    c[2] = ((color>>0)&0xFF)>>2;
-    ssd1331_writedata(c[0]);
-    ssd1331_writedata(c[1]);
-    ssd1331_writedata(c[2]);
-    gpio_write(SSD1331_CS_PIN, 1); /* disable chip */
+    ssd1331_window(x, y, 1, 1);
+    /* 한 픽셀은 프레임 크기를 바꾸지 않고 8비트 두 개로 보낸다 */
+    c[0] = pixel >> 8;
+    c[1] = pixel & 0xFF;
+    ssd1331_writebytes(c, sizeof(c));
+    spi_deselect(SSD1331_SPI, SSD1331_CS_PIN); /* disable chip */
 }
 
 void ssd1331_gotoxy(uint16_t x, uint16_t y)
@@ -198,15 +194,14 @@ char ssd1331_putc(uint16_t ch, Font_t *font, SSD1331_Color_t color, uint8_t size
     }
     
     /* Go through font */
-    if (font->type == ASCII_FONT) {
+    if (size > 1) {
+        ssd1331_putc_scaled(ch, font, color, size);
+    } else if (font->type == ASCII_FONT) {
         for (i = 0; i < font->height; i++) {
             b = font->data.data[(ch - font->first) * font->height + i];
             for (j = 0; j < font->width; j++) {
                 if ((b << j) & 0x8000) {
-                    if (size == 1)
-                        ssd1331_drawpixel(SSD1331.cursor_x + j, (SSD1331.cursor_y + i), color);
-                    else
-                        ssd1331_fillrectangle(SSD1331.cursor_x + j*size, SSD1331.cursor_y + i*size, size, size, color);
+                    ssd1331_drawpixel(SSD1331.cursor_x + j, (SSD1331.cursor_y + i), color);
                 }/* else {
                     ssd1331_drawpixel(SSD1331.cursor_x + j, (SSD1331.cursor_y + i), (SSD1331_Color_t)!color);
                 }*/
@@ -216,6 +211,10 @@ char ssd1331_putc(uint16_t ch, Font_t *font, SSD1331_Color_t color, uint8_t size
         ssd1331_putc_gfx(ch, font, color, size);
     } else if (font->type == COMB_FONT) {
         ssd1331_putc_hangul(ch, font, color, size);
+    } else if (font->type == PAGE_FONT) {
+        ssd1331_putc_page(ch, font, color, size);
+    } else if (font->type == STORE_FONT) {
+        ssd1331_putc_scaled(ch, font, color, 1);
     }
     
     /* Increase pointer */
@@ -234,25 +233,19 @@ char ssd1331_putc_gfx(uint16_t ch, Font_t* font, SSD1331_Color_t color, uint8_t
 
     uint32_t bo = glyph->bitmapOffset;
     uint8_t  w  = glyph->width, h  = glyph->height;
-    int8_t   xo = glyph->xOffset, yo = 0/*glyph->yOffset*/;
+    int8_t   xo = glyph->xOffset, yo = glyph->yOffset + GFXFONT_BASELINE(gfxfont);
     uint8_t  xx, yy, bits = 0, bit = 0;
-    int16_t  xo16 = 0, yo16 = 0;
     //printf("ch=%d, offset=%ld, w=%d, h=%d\r\n", ch, bo, w, h);
 
-    if (size > 1) {
-        xo16 = xo;
-        yo16 = yo;
-    }
+    if (size > 1)
+        return ssd1331_putc_scaled(ch + gfxfont->first, font, color, size);
     for(yy=0; yy<h; yy++) {
         for(xx=0; xx<w; xx++) {
             if(!(bit++ & 7)) {
                 bits = bitmap[bo++];
             }
             if(bits & 0x80) {
-                if (size == 1)
-                    ssd1331_drawpixel(SSD1331.cursor_x + xo + xx, (SSD1331.cursor_y + yo + yy), color);
-                else
-                    ssd1331_fillrectangle(SSD1331.cursor_x + (xo16+xx)*size, SSD1331.cursor_y + (yo16+yy)*size, size, size, color);
+                ssd1331_drawpixel(SSD1331.cursor_x + xo + xx, (SSD1331.cursor_y + yo + yy), color);
             }
             bits <<= 1;
         }
@@ -266,6 +259,9 @@ char ssd1331_putc_hangul(uint16_t ch, Font_t* font, SSD1331_Color_t color, uint8
     uint8_t wb = font->width/8;
     uint8_t b, *pFs;
     
+    if (size > 1)
+        return ssd1331_putc_scaled(ch, font, color, size);
+
     /* Go through font */
     pFs = get_hangul_glyph(ch, font);
     for (i = 0; i < font->height; i++) {
@@ -273,10 +269,7 @@ char ssd1331_putc_hangul(uint16_t ch, Font_t* font, SSD1331_Color_t color, uint8
         b = pFs[i*wb+w];
         for (j = 0; j < 8; j++) {
             if ((b << j) & 0x80) {
-                if (size == 1)
-                    ssd1331_drawpixel(SSD1331.cursor_x + w*8 + j, SSD1331.cursor_y + i, color);
-                else
-                    ssd1331_fillrectangle(SSD1331.cursor_x + (w*8 + j)*size, SSD1331.cursor_y + i*size, size, size, color);
+                ssd1331_drawpixel(SSD1331.cursor_x + w*8 + j, SSD1331.cursor_y + i, color);
             }/* else {
                 ssd1331_drawpixel(SSD1331.cursor_x + w*8 + j, (SSD1331.cursor_y + i), (SSD1331_Color_t)!color);
             }*/
@@ -286,45 +279,159 @@ char ssd1331_putc_hangul(uint16_t ch, Font_t* font, SSD1331_Color_t color, uint8
     return 1;
 }
 
+char ssd1331_putc_page(uint16_t ch, Font_t* font, SSD1331_Color_t color, uint8_t size)
+{
+    uint16_t i, j, p;
+    uint8_t pages = PAGEFONT_PAGES(font);
+    const uint8_t *pFs = font->data.page + (ch - font->first) * PAGEFONT_GLYPH_SIZE(font);
+
+    if (size > 1)
+        return ssd1331_putc_scaled(ch, font, color, size);
+
+    /* Go through font */
+    for (p = 0; p < pages; p++) {
+        for (i = 0; i < font->width; i++) {
+            for (j = 0; j < 8; j++) {
+                if ((pFs[p*font->width + i] >> j) & 0x01)
+                    ssd1331_drawpixel(SSD1331.cursor_x + i, SSD1331.cursor_y + p*8 + j, color);
+            }
+        }
+    }
+    return 1;
+}
+
+/* 사각형 영역을 한 번의 창 설정 후 연속된 색 데이터로 채운다 */
+static void ssd1331_fillspan(int16_t x, int16_t y, int16_t w, int16_t h, SSD1331_Color_t color)
+{
+    /* Clip to the screen */
+    if (x < 0) {
+        w += x;
+        x = 0;
+    }
+    if (y < 0) {
+        h += y;
+        y = 0;
+    }
+    if (x + w > SSD1331_WIDTH)
+        w = SSD1331_WIDTH - x;
+    if (y + h > SSD1331_HEIGHT)
+        h = SSD1331_HEIGHT - y;
+    if (w <= 0 || h <= 0)
+        return;
+
+    ssd1331_window(x, y, w, h);
+    /* 같은 색을 버퍼 없이 w*h 번 연속으로 보낸다 */
+    spi_fill_pixels(SSD1331_SPI, SSD1331_RGB565(color), (int)w * h);
+    spi_deselect(SSD1331_SPI, SSD1331_CS_PIN); /* disable chip */
+}
+
+/* 쓸 창을 설정하고, CS 를 내린 채 데이터 모드로 둔다 */
+static void ssd1331_window(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+    uint8_t cmd[6];
+
+    gpio_write(SSD1331_DC_PIN, 0); /* command */
+    spi_select(SSD1331_SPI, SSD1331_CS_PIN); /* enable chip */
+    cmd[0] = 0x15;  // set x range
+    cmd[1] = x & 0xff;
+    cmd[2] = (x + w - 1) & 0xff;
+    cmd[3] = 0x75;  // set y range
+    cmd[4] = y & 0xff;
+    cmd[5] = (y + h - 1) & 0xff;
+    ssd1331_writebytes(cmd, sizeof(cmd));
+    gpio_write(SSD1331_DC_PIN, 1); /* data */
+}
+
+void ssd1331_drawimage(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t* pixels)
+{
+    uint16_t cw = w, ch = h, i;
+
+    if (
+        x >= SSD1331_WIDTH ||
+        y >= SSD1331_HEIGHT
+    ) {
+        /* Return error */
+        return;
+    }
+    if (x + cw > SSD1331_WIDTH)
+        cw = SSD1331_WIDTH - x;
+    if (y + ch > SSD1331_HEIGHT)
+        ch = SSD1331_HEIGHT - y;
+    if (cw == 0 || ch == 0)
+        return;
+
+    ssd1331_window(x, y, cw, ch);
+    if (cw == w) {
+        /* 잘리지 않았으면 한 번에 보낸다 */
+        spi_write_pixels(SSD1331_SPI, pixels, (int)cw * ch, SPI_PIXEL_MSB_FIRST);
+    } else {
+        for (i = 0; i < ch; i++)
+            spi_write_pixels(SSD1331_SPI, pixels + (uint32_t)i * w, cw, SPI_PIXEL_MSB_FIRST);
+    }
+    spi_deselect(SSD1331_SPI, SSD1331_CS_PIN); /* disable chip */
+}
+
+char ssd1331_putc_scaled(uint16_t ch, Font_t* font, SSD1331_Color_t color, uint8_t size)
+{
+    static FontGlyph_t glyph, smooth;
+    FontGlyph_t *g = &glyph;
+    uint8_t scale = size;
+    uint16_t i, n, a, b;
+    uint32_t row;
+
+    font_getglyph(font, ch, &glyph);
+    if (SSD1331.smooth && !(size & 1) && font_scale2x(&glyph, &smooth)) {
+        g = &smooth;
+        scale = size / 2;
+    }
+
+    for (i = 0; i < g->height; i += n) {
+        row = g->rows[i];
+        /* 같은 행이 이어지면 한 번에 그린다 */
+        for (n = 1; i + n < g->height && g->rows[i + n] == row; n++);
+        /* 행을 연속된 픽셀 구간으로 나눈다 */
+        for (a = 0; row; a = b) {
+            for (; !(row & 0x80000000UL); row <<= 1)
+                a++;
+            for (b = a; row & 0x80000000UL; row <<= 1)
+                b++;
+            ssd1331_fillspan(SSD1331.cursor_x + (g->x + a) * scale,
+                             SSD1331.cursor_y + (g->y + i) * scale,
+                             (b - a) * scale, n * scale, color);
+        }
+    }
+    return 1;
+}
+
+void ssd1331_setsmooth(uint8_t enable)
+{
+    SSD1331.smooth = enable ? 1 : 0;
+}
+
 char ssd1331_puts(char* str, FontSet_t* fontset, SSD1331_Color_t color, uint8_t size)
 {
-    int i;
-    char c, c2, c3;
     char count=0;
-    uint16_t utf16;
+    uint16_t utf16, next;
+    Font_t *font;
     int cursor_x = SSD1331.cursor_x;
 
     /* Write characters */
-    while (*str) {
-        c = *str++;
+    utf16 = font_getutf16(&str);
+    while (utf16) {
+        /* 커닝을 위해 다음 글자를 미리 읽는다 */
+        next = font_getutf16(&str);
         count++;
 
-        // convert utf-8 to unicode
-        if (c <= 0x7F){
-            utf16 = c;
-        } else {
-            /*------------------------------
-              UTF-8 을 UTF-16으로 변환한다.  UTF-8 1110xxxx 10xxxxxx 10xxxxxx
-            ------------------------------*/
-            c2 = *str++;
-            c3 = *str++;
-            utf16 = ((c & 0x0f) << 12) | ((c2 & 0x3f) << 6) | (c3 & 0x3f);
-        }
         if (utf16 == '\n') {
             /* Increase pointer */
             SSD1331.cursor_x = cursor_x;
             SSD1331.cursor_y += size * fontset->height;
-        } else {
+        } else if ((font = font_find(utf16, fontset)) != NULL) {
             /* Write character by character */
-            for (i = 0; fontset->fontlist[i] && i < 5; i++) {
-                Font_t *font = fontset->fontlist[i];
-                if (utf16 >= font->first && utf16 <= font->last) {
-                    ssd1331_putc(utf16, font, color, size);
-                    SSD1331.cursor_x += size * font->width;
-                    break;
-                }
-            }
+            ssd1331_putc(utf16, font, color, size);
+            SSD1331.cursor_x += size * font_getadvance(font, utf16, next);
         }
+        utf16 = next;
     }
     
     /* Everything OK, char count should be returned */
@@ -607,18 +714,18 @@ void ssd1331_fillcircle(int16_t x0, int16_t y0, int16_t r, SSD1331_Color_t c)
  
 void ssd1331_on(void)
 {
-    gpio_write(SSD1331_CS_PIN, 0);
+    spi_select(SSD1331_SPI, SSD1331_CS_PIN);
     ssd1331_writecommand(0xA4); //Set display:Normal
     ssd1331_writecommand(0xAF); //--turn on SSD1331 panel
     HAL_Delay(1);
-    gpio_write(SSD1331_CS_PIN, 1);
+    spi_deselect(SSD1331_SPI, SSD1331_CS_PIN);
 }
 
 void ssd1331_off(void)
 {
-    gpio_write(SSD1331_CS_PIN, 0);
+    spi_select(SSD1331_SPI, SSD1331_CS_PIN);
     ssd1331_writecommand(0xA6); //Set display:All pixel off
     ssd1331_writecommand(0xAE); //--turn off SSD1331 panel
     HAL_Delay(1);
-    gpio_write(SSD1331_CS_PIN, 1);
+    spi_deselect(SSD1331_SPI, SSD1331_CS_PIN);
 }
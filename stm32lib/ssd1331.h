@@ -95,6 +95,7 @@ RST        D8(PA9)      장치 를 위한 리셋 핀
  - SPI
  - FONT
  - HANGULFONT
+ - PAGEFONT
  - string.h
  - stdlib.h
 \endverbatim
@@ -105,6 +106,7 @@ RST        D8(PA9)      장치 를 위한 리셋 핀
 #include "../stm32lib/spi.h"
 #include "../stm32lib/font.h"
 #include "../stm32lib/hangulfont.h"
+#include "../stm32lib/pagefont.h"
 #include "stdlib.h"
 #include "string.h"
 
@@ -140,6 +142,10 @@ RST        D8(PA9)      장치 를 위한 리셋 핀
 #ifndef SSD1331_HEIGHT
 #define SSD1331_HEIGHT           64
 #endif
+/* 확대된 글자에 scale2x 부드럽게 하기를 기본으로 적용할지 여부 */
+#ifndef SSD1331_SMOOTH_TEXT
+#define SSD1331_SMOOTH_TEXT      0
+#endif
 
 /**
  * @}
@@ -164,6 +170,11 @@ typedef uint32_t SSD1331_Color_t;
 #define	SSD1331_COLOR_ORANGE 0xFFFF00
 #define	SSD1331_COLOR_PURPLE 0xFF00FF
 
+/**
+ * @brief  @ref SSD1331_Color_t 색을 장치가 받는 RGB565 픽셀 값으로 바꾼다
+ */
+#define SSD1331_RGB565(color)   ((uint16_t)((((color) >> 8) & 0xF800) | (((color) >> 5) & 0x07E0) | (((color) >> 3) & 0x001F)))
+
 /**
  * @}
  */
@@ -215,6 +226,28 @@ void ssd1331_gotoxy(uint16_t x, uint16_t y);
 char ssd1331_putc(uint16_t ch, Font_t *font, SSD1331_Color_t color, uint8_t size);
 char ssd1331_putc_gfx(uint16_t ch, Font_t* font, SSD1331_Color_t color, uint8_t size);
 char ssd1331_putc_hangul(uint16_t ch, Font_t* font, SSD1331_Color_t color, uint8_t size);
+char ssd1331_putc_page(uint16_t ch, Font_t* font, SSD1331_Color_t color, uint8_t size);
+
+/**
+ * @brief  확대된 글자를 쓴다
+ * @note   글자의 각 행을 연속된 픽셀 구간으로 나누어, 구간마다 한 번의 창(window) 설정 후
+ *         색 데이터를 연속으로 보낸다. 모든 폰트 종류에 대해 size 가 1보다 크면
+ *         @ref ssd1331_putc() 가 이 함수를 사용한다
+ * @param  ch: 쓰여질 글자
+ * @param  *font: 사용된 폰트에 대한 @ref Font_t 구조체의 포인터
+ * @param  color: 그리는 데 사용할 색. 이 매개변수는 @ref SSD1331_Color_t 값
+ * @param  size: 확대 배율
+ * @retval 쓰여진 글자 수(=1 or 0)
+ */
+char ssd1331_putc_scaled(uint16_t ch, Font_t* font, SSD1331_Color_t color, uint8_t size);
+
+/**
+ * @brief  확대된 글자에 scale2x 부드럽게 하기를 적용할지 정한다
+ * @note   배율이 짝수일 때만 적용된다. 기본값은 @ref SSD1331_SMOOTH_TEXT
+ * @param  enable: 0이면 적용하지 않음, 그 외에는 적용함
+ * @retval 없음
+ */
+void ssd1331_setsmooth(uint8_t enable);
 
 /**
  * @brief  그래픽 장치에 문자열을 쓴다
@@ -304,6 +337,18 @@ void ssd1331_drawcircle(int16_t x0, int16_t y0, int16_t r, SSD1331_Color_t c);
  */
 void ssd1331_fillcircle(int16_t x0, int16_t y0, int16_t r, SSD1331_Color_t c);
 
+/**
+ * @brief  RGB565 픽셀 배열을 그린다
+ * @note   픽셀은 16비트 프레임으로 연속해서 보낸다(@ref spi_write_pixels()). 화면을 벗어난 부분은 잘린다
+ * @param  x: 왼쪽 위 X 위치. 이 매개변수는 0 과 SSD1331_WIDTH - 1 사이의 값
+ * @param  y: 왼쪽 위 Y 위치. 이 매개변수는 0 과 SSD1331_HEIGHT - 1 사이의 값
+ * @param  w: 이미지 넓이
+ * @param  h: 이미지 높이
+ * @param  pixels: w * h 개의 RGB565 픽셀 배열. @ref SSD1331_RGB565() 로 만들 수 있다
+ * @retval 없음
+ */
+void ssd1331_drawimage(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t* pixels);
+
 /**
  * @}
  */
@@ -0,0 +1,253 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+#include "../stm32lib/swi2c.h"
+#include "../stm32lib/cyccnt.h"
+
+#define SWI2C_WRITE     0
+#define SWI2C_READ      1
+
+/* 라인을 놓으면 풀업으로 HIGH, 당기면 LOW. 출력 드레인이므로 방향을 바꿀 필요가 없다 */
+#define swi2c_scl_low(bus)      ((bus)->sclport->BSRR = (bus)->sclmask << 16)
+#define swi2c_scl_release(bus)  ((bus)->sclport->BSRR = (bus)->sclmask)
+#define swi2c_sda_low(bus)      ((bus)->sdaport->BSRR = (bus)->sdamask << 16)
+#define swi2c_sda_release(bus)  ((bus)->sdaport->BSRR = (bus)->sdamask)
+#define swi2c_scl_read(bus)     ((bus)->sclport->IDR & (bus)->sclmask)
+#define swi2c_sda_read(bus)     ((bus)->sdaport->IDR & (bus)->sdamask)
+
+/* Private functions */
+static void swi2c_delay(uint32_t cycles);
+static void swi2c_scl_high(SWI2C_t* bus);
+static int swi2c_begin(SWI2C_t* bus, int address);
+static int swi2c_end(SWI2C_t* bus, int result);
+
+void swi2c_init(SWI2C_t* bus, GPIO_Pin_t scl, GPIO_Pin_t sda, uint32_t hz)
+{
+    bus->sclport = gpio_get_port_base(scl);
+    bus->sdaport = gpio_get_port_base(sda);
+    bus->sclmask = GPIO_REG_VALUE(scl);
+    bus->sdamask = GPIO_REG_VALUE(sda);
+    bus->error = 0;
+
+    /* 지연에 쓸 사이클 카운터 */
+    cyccnt_enable();
+
+    /* 놓은 상태로 출력 드레인 설정 */
+    swi2c_scl_release(bus);
+    swi2c_sda_release(bus);
+    gpio_alternate_init(scl, (GPIO_Mode_t)GPIO_MODE_OUTPUT_OD, 0);
+    gpio_set_pinmode(scl, GPIO_PM_PULLUP);
+    gpio_alternate_init(sda, (GPIO_Mode_t)GPIO_MODE_OUTPUT_OD, 0);
+    gpio_set_pinmode(sda, GPIO_PM_PULLUP);
+
+    swi2c_set_frequency(bus, hz);
+}
+
+void swi2c_set_frequency(SWI2C_t* bus, uint32_t hz)
+{
+    uint32_t half;
+
+    if (hz == 0)
+        hz = 100000;
+    bus->hz = hz;
+    half = SystemCoreClock / (2 * hz);
+    bus->half = (half > SWI2C_OVERHEAD_CYCLES) ? half - SWI2C_OVERHEAD_CYCLES : 0;
+    bus->stretch = (SystemCoreClock / 1000000) * SWI2C_STRETCH_US;
+}
+
+int swi2c_ready(SWI2C_t* bus, int address)
+{
+    return swi2c_end(bus, swi2c_begin(bus, address & 0xFE));
+}
+
+int swi2c_nread(SWI2C_t* bus, int address, int reg, uint8_t* data, int length)
+{
+    int i;
+
+    if (swi2c_begin(bus, address & 0xFE) < 0 || swi2c_writebyte(bus, (uint8_t)reg) != SWI2C_ACK)
+        return swi2c_end(bus, -1);
+    /* 반복 시작 */
+    if (swi2c_begin(bus, address | SWI2C_READ) < 0)
+        return swi2c_end(bus, -1);
+    for (i = 0; i < length; i++)
+        data[i] = swi2c_readbyte(bus, (i < length - 1) ? SWI2C_ACK : SWI2C_NAK);
+    return swi2c_end(bus, 1);
+}
+
+int swi2c_readdata(SWI2C_t* bus, int address, uint8_t* data, int length)
+{
+    int i;
+
+    if (swi2c_begin(bus, address | SWI2C_READ) < 0)
+        return swi2c_end(bus, -1);
+    for (i = 0; i < length; i++)
+        data[i] = swi2c_readbyte(bus, (i < length - 1) ? SWI2C_ACK : SWI2C_NAK);
+    return swi2c_end(bus, 1);
+}
+
+int swi2c_read(SWI2C_t* bus, int address, uint8_t reg, uint8_t* data)
+{
+    return swi2c_nread(bus, address, reg, data, 1);
+}
+
+int swi2c_nwrite(SWI2C_t* bus, int address, int reg, const uint8_t* data, int length)
+{
+    int i;
+
+    if (swi2c_begin(bus, address & 0xFE) < 0 || swi2c_writebyte(bus, (uint8_t)reg) != SWI2C_ACK)
+        return swi2c_end(bus, -1);
+    for (i = 0; i < length; i++) {
+        if (swi2c_writebyte(bus, data[i]) != SWI2C_ACK)
+            return swi2c_end(bus, -1);
+    }
+    return swi2c_end(bus, 1);
+}
+
+int swi2c_write(SWI2C_t* bus, int address, uint8_t reg, uint8_t data)
+{
+    return swi2c_nwrite(bus, address, reg, &data, 1);
+}
+
+void swi2c_start(SWI2C_t* bus)
+{
+    /* SCL 이 LOW 인 반복 시작에서도 SDA 를 먼저 놓는다 */
+    swi2c_sda_release(bus);
+    swi2c_delay(bus->half);
+    swi2c_scl_high(bus);
+    swi2c_delay(bus->half);
+    /* SCL 이 HIGH 인 동안 SDA 를 내린다 */
+    swi2c_sda_low(bus);
+    swi2c_delay(bus->half);
+    swi2c_scl_low(bus);
+}
+
+void swi2c_stop(SWI2C_t* bus)
+{
+    swi2c_scl_low(bus);
+    swi2c_sda_low(bus);
+    swi2c_delay(bus->half);
+    swi2c_scl_high(bus);
+    swi2c_delay(bus->half);
+    /* SCL 이 HIGH 인 동안 SDA 를 올린다 */
+    swi2c_sda_release(bus);
+    swi2c_delay(bus->half);
+}
+
+SWI2C_Ack_t swi2c_writebyte(SWI2C_t* bus, uint8_t data)
+{
+    SWI2C_Ack_t ack;
+    uint8_t i;
+
+    for (i = 0; i < 8; i++) {
+        /* SCL 이 LOW 인 동안 데이터를 바꾼다 */
+        if (data & 0x80)
+            swi2c_sda_release(bus);
+        else
+            swi2c_sda_low(bus);
+        data <<= 1;
+        swi2c_delay(bus->half);
+        swi2c_scl_high(bus);
+        swi2c_delay(bus->half);
+        swi2c_scl_low(bus);
+    }
+
+    /* 9 번째 클록에서 ACK 를 읽는다 */
+    swi2c_sda_release(bus);
+    swi2c_delay(bus->half);
+    swi2c_scl_high(bus);
+    swi2c_delay(bus->half);
+    ack = swi2c_sda_read(bus) ? SWI2C_NAK : SWI2C_ACK;
+    swi2c_scl_low(bus);
+    return bus->error ? SWI2C_NAK : ack;
+}
+
+uint8_t swi2c_readbyte(SWI2C_t* bus, SWI2C_Ack_t ack)
+{
+    uint8_t data = 0;
+    uint8_t i;
+
+    swi2c_sda_release(bus);
+    for (i = 0; i < 8; i++) {
+        swi2c_delay(bus->half);
+        swi2c_scl_high(bus);
+        swi2c_delay(bus->half);
+        data = (data << 1) | (swi2c_sda_read(bus) ? 1 : 0);
+        swi2c_scl_low(bus);
+    }
+
+    /* 9 번째 클록에서 ACK/NAK 를 보낸다 */
+    if (ack == SWI2C_ACK)
+        swi2c_sda_low(bus);
+    swi2c_delay(bus->half);
+    swi2c_scl_high(bus);
+    swi2c_delay(bus->half);
+    swi2c_scl_low(bus);
+    swi2c_sda_release(bus);
+    return data;
+}
+
+static void swi2c_delay(uint32_t cycles)
+{
+    uint32_t start = SWI2C_TIMESTAMP();
+
+    while (SWI2C_TIMESTAMP() - start < cycles)
+        ;
+}
+
+/* SCL 을 놓고, 슬레이브가 잡고 있으면 놓을 때까지 기다린다 */
+static void swi2c_scl_high(SWI2C_t* bus)
+{
+    uint32_t start = SWI2C_TIMESTAMP();
+
+    swi2c_scl_release(bus);
+    while (!swi2c_scl_read(bus)) {
+        if (SWI2C_TIMESTAMP() - start >= bus->stretch) {
+            bus->error = 1;
+            return;
+        }
+    }
+}
+
+/* START 와 주소를 보낸다 */
+static int swi2c_begin(SWI2C_t* bus, int address)
+{
+    swi2c_start(bus);
+    if (bus->error || swi2c_writebyte(bus, (uint8_t)address) != SWI2C_ACK)
+        return -1;
+    return 1;
+}
+
+/* STOP 으로 전송을 끝내고 결과를 반환한다 */
+static int swi2c_end(SWI2C_t* bus, int result)
+{
+    swi2c_stop(bus);
+    if (bus->error) {
+        bus->error = 0;
+        return -1;
+    }
+    return result;
+}
@@ -0,0 +1,279 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+#ifndef SWI2C_H
+#define SWI2C_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup stm32lib
+ * @{
+ */
+
+/**
+ * @defgroup SWI2C
+ * @brief    GPIO 로 구현한 소프트웨어 I2C 마스터 라이브러리
+ * @{
+ *
+ * 임의의 두 GPIO 핀으로 I2C 마스터를 만든다. 두 핀은 출력 드레인으로 한 번만 설정되며,
+ * 라인을 놓을 때는 BSRR 로 1 을, 당길 때는 0 을 쓰고 IDR 로 실제 버스 레벨을 읽으므로
+ * 방향을 바꾸기 위한 재초기화가 없다.
+ *
+ * 반 주기 지연은 코어 클록(SystemCoreClock)과 DWT 사이클 카운터로 맞추며, 슬레이브가
+ * SCL 을 잡고 있으면(clock stretching) @ref SWI2C_STRETCH_US 까지 기다린다.
+ * 여러 바이트 읽기/쓰기는 하나의 전송으로 처리된다.
+ *
+ * 주소와 반환값은 I2C 라이브러리와 같다. 주소는 8 비트 형식(7 비트 주소 << 1)이다.
+ *
+ * \par 사용 예
+ *
+\code
+SWI2C_t bus;
+uint8_t data[14];
+
+swi2c_init(&bus, GPIO_PB_8, GPIO_PB_9, 400000);
+swi2c_nread(&bus, 0xD0, 0x3B, data, 14);
+\endcode
+ *
+ * \par Changelog
+ *
+\verbatim
+ 버전 1.0
+  - 최초 배포 (examples/sw4stm32/swi2ctest 에서 옮김)
+\endverbatim
+ *
+ * \par 의존성
+ *
+\verbatim
+ - STM32F4xx HAL
+ - GPIO
+\endverbatim
+ */
+#include "stm32f4xx_hal.h"
+#include "../stm32lib/gpio.h"
+
+/**
+ * @defgroup SWI2C_매크로
+ * @brief    SWI2C 매크로
+ * @{
+ */
+
+/**
+ * @brief  슬레이브의 클록 늘이기(clock stretching)를 기다리는 최대 시간 (us)
+ */
+#ifndef SWI2C_STRETCH_US
+#define SWI2C_STRETCH_US        1000
+#endif
+
+/**
+ * @brief  반 주기마다 GPIO 접근과 함수 호출에 드는 코어 클록 수. 지연 시간에서 뺀다
+ */
+#ifndef SWI2C_OVERHEAD_CYCLES
+#define SWI2C_OVERHEAD_CYCLES   20
+#endif
+
+/**
+ * @brief  지연에 사용하는 사이클 카운터
+ */
+#ifndef SWI2C_TIMESTAMP
+#define SWI2C_TIMESTAMP()       (DWT->CYCCNT)
+#endif
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup SWI2C_자료형
+ * @brief    SWI2C 자료형
+ * @{
+ */
+
+/**
+ * @brief  ACK 열거형
+ */
+typedef enum {
+    SWI2C_NAK = 0,  /*!< 응답 없음 */
+    SWI2C_ACK = 1,  /*!< 응답 */
+} SWI2C_Ack_t;
+
+/**
+ * @brief  소프트웨어 I2C 버스 구조체
+ */
+typedef struct {
+    GPIO_TypeDef *sclport;  /*!< SCL 포트 */
+    GPIO_TypeDef *sdaport;  /*!< SDA 포트 */
+    uint32_t sclmask;       /*!< SCL 핀 비트 */
+    uint32_t sdamask;       /*!< SDA 핀 비트 */
+    uint32_t half;          /*!< 반 주기 지연 (코어 클록 수) */
+    uint32_t stretch;       /*!< 클록 늘이기 최대 대기 (코어 클록 수) */
+    uint32_t hz;            /*!< 설정한 SCL 주파수 */
+    uint8_t error;          /*!< 클록 늘이기 타임아웃이 생기면 1 */
+} SWI2C_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup SWI2C_함수
+ * @brief    SWI2C 함수
+ * @{
+ */
+
+/**
+ * @brief  소프트웨어 I2C 버스를 초기화한다
+ * @note   두 핀을 풀업이 있는 출력 드레인으로 설정하고 DWT 사이클 카운터를 켠다
+ * @param  bus: 버스 구조체
+ * @param  scl: SCL 핀
+ * @param  sda: SDA 핀
+ * @param  hz: SCL 주파수(헤르쯔 단위)
+ * @retval 없음
+ */
+void swi2c_init(SWI2C_t* bus, GPIO_Pin_t scl, GPIO_Pin_t sda, uint32_t hz);
+
+/**
+ * @brief  SCL 주파수를 설정한다
+ * @note   SystemCoreClock 이 바뀌었으면 다시 호출해야 한다
+ * @param  bus: 버스 구조체
+ * @param  hz: SCL 주파수(헤르쯔 단위)
+ * @retval 없음
+ */
+void swi2c_set_frequency(SWI2C_t* bus, uint32_t hz);
+
+/**
+ * @brief  장치가 응답하는지 확인한다
+ * @param  bus: 버스 구조체
+ * @param  address: I2C 장치 주소
+ * @retval 실행 상태, 1: 응답, -1: 응답 없음
+ */
+int swi2c_ready(SWI2C_t* bus, int address);
+
+/**
+ * @brief  레지스터 주소를 쓴 후 반복 시작(repeated start)으로 여러 바이트를 읽는다
+ * @param  bus: 버스 구조체
+ * @param  address: I2C 장치 주소
+ * @param  reg: 레지스터 주소
+ * @param  data: 읽은 데이터를 저장할 버퍼
+ * @param  length: 읽을 바이트 수
+ * @retval 실행 상태, 1: 정상, -1: 오류
+ */
+int swi2c_nread(SWI2C_t* bus, int address, int reg, uint8_t* data, int length);
+
+/**
+ * @brief  레지스터 주소 없이 여러 바이트를 읽는다
+ * @param  bus: 버스 구조체
+ * @param  address: I2C 장치 주소
+ * @param  data: 읽은 데이터를 저장할 버퍼
+ * @param  length: 읽을 바이트 수
+ * @retval 실행 상태, 1: 정상, -1: 오류
+ */
+int swi2c_readdata(SWI2C_t* bus, int address, uint8_t* data, int length);
+
+/**
+ * @brief  레지스터로부터 1 바이트를 읽는다
+ * @param  bus: 버스 구조체
+ * @param  address: I2C 장치 주소
+ * @param  reg: 레지스터 주소
+ * @param  data: 읽은 데이터를 저장할 변수
+ * @retval 실행 상태, 1: 정상, -1: 오류
+ */
+int swi2c_read(SWI2C_t* bus, int address, uint8_t reg, uint8_t* data);
+
+/**
+ * @brief  레지스터 주소부터 여러 바이트를 하나의 전송으로 쓴다
+ * @param  bus: 버스 구조체
+ * @param  address: I2C 장치 주소
+ * @param  reg: 레지스터 주소
+ * @param  data: 쓸 데이터
+ * @param  length: 쓸 바이트 수
+ * @retval 실행 상태, 1: 정상, -1: 오류
+ */
+int swi2c_nwrite(SWI2C_t* bus, int address, int reg, const uint8_t* data, int length);
+
+/**
+ * @brief  레지스터에 1 바이트를 쓴다
+ * @param  bus: 버스 구조체
+ * @param  address: I2C 장치 주소
+ * @param  reg: 레지스터 주소
+ * @param  data: 쓸 데이터
+ * @retval 실행 상태, 1: 정상, -1: 오류
+ */
+int swi2c_write(SWI2C_t* bus, int address, uint8_t reg, uint8_t data);
+
+/**
+ * @brief  START 또는 반복 START 를 만든다
+ * @param  bus: 버스 구조체
+ * @retval 없음
+ */
+void swi2c_start(SWI2C_t* bus);
+
+/**
+ * @brief  STOP 을 만든다
+ * @param  bus: 버스 구조체
+ * @retval 없음
+ */
+void swi2c_stop(SWI2C_t* bus);
+
+/**
+ * @brief  1 바이트를 보내고 ACK 를 받는다
+ * @param  bus: 버스 구조체
+ * @param  data: 보낼 바이트
+ * @retval 슬레이브의 응답, @ref SWI2C_Ack_t
+ */
+SWI2C_Ack_t swi2c_writebyte(SWI2C_t* bus, uint8_t data);
+
+/**
+ * @brief  1 바이트를 받고 ACK 또는 NAK 를 보낸다
+ * @param  bus: 버스 구조체
+ * @param  ack: 더 읽을 것이면 SWI2C_ACK, 마지막 바이트이면 SWI2C_NAK
+ * @retval 받은 바이트
+ */
+uint8_t swi2c_readbyte(SWI2C_t* bus, SWI2C_Ack_t ack);
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,652 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+#include "../stm32lib/transport.h"
+#include "../stm32lib/cyccnt.h"
+
+/* 비동기 쓰기 결과가 아직 없음을 나타내는 값 */
+#define TRANSPORT_PENDING   0
+
+/* 비동기 쓰기를 끝낸다. 인터럽트 문맥에서 호출될 수 있다 */
+static void transport_complete(Transport_t* t, int result)
+{
+    t->result = (result > 0) ? 1 : -1;
+    if (result < 0)
+        t->stats.errors++;
+    if (t->callback)
+        t->callback(t, t->result, t->arg);
+}
+
+/*
+ * 하드웨어 I2C
+ */
+
+/* 명령 목록과 데이터를 한 번의 전송으로 보낸다.
+   명령마다 Co=1 제어 바이트를 두고, 마지막 데이터 제어 바이트 뒤로 데이터가 이어진다 */
+static int transport_i2c_combined(Transport_t* t, const uint8_t* cmds, int ncmds, const uint8_t* data, int ndata)
+{
+    uint8_t buf[TRANSPORT_MAX_COMMANDS * 2];
+    I2C_Segment_t segs[2];
+    int i, n = 0;
+
+    buf[n++] = cmds[0];
+    for (i = 1; i < ncmds; i++) {
+        buf[n++] = t->cmdctrl | 0x80;
+        buf[n++] = cmds[i];
+    }
+    buf[n++] = t->datactrl;
+    segs[0].data = buf;
+    segs[0].length = n;
+    segs[1].data = data;
+    segs[1].length = ndata;
+    return i2c_writev(t->bus.i2c.dev.bus, t->bus.i2c.dev.address, t->cmdctrl | 0x80, segs, 2);
+}
+
+static int transport_i2c_ready(Transport_t* t)
+{
+    int ret;
+
+    if (i2c_bus_acquire(&t->bus.i2c.dev, I2C_BUS_TIMEOUT) < 0)
+        return -1;
+    ret = i2c_ready(t->bus.i2c.dev.bus, t->bus.i2c.dev.address);
+    i2c_bus_release(&t->bus.i2c.dev);
+    return ret;
+}
+
+static int transport_i2c_write(Transport_t* t, const uint8_t* cmds, int ncmds, const uint8_t* data, int ndata)
+{
+    I2C_t bus = t->bus.i2c.dev.bus;
+    int address = t->bus.i2c.dev.address;
+    int ret = 1;
+
+    if (i2c_bus_acquire(&t->bus.i2c.dev, I2C_BUS_TIMEOUT) < 0)
+        return -1;
+    if (ncmds > 0 && ndata > 0 && ncmds <= TRANSPORT_MAX_COMMANDS) {
+        ret = transport_i2c_combined(t, cmds, ncmds, data, ndata);
+    } else {
+        if (ncmds > 0)
+            ret = i2c_nwrite(bus, address, t->cmdctrl, (uint8_t *)cmds, ncmds);
+        if (ret > 0 && ndata > 0)
+            ret = i2c_nwrite(bus, address, t->datactrl, (uint8_t *)data, ndata);
+    }
+    i2c_bus_release(&t->bus.i2c.dev);
+    return ret;
+}
+
+static int transport_i2c_read(Transport_t* t, uint8_t reg, uint8_t* data, int length)
+{
+    int ret;
+
+    if (i2c_bus_acquire(&t->bus.i2c.dev, I2C_BUS_TIMEOUT) < 0)
+        return -1;
+    ret = i2c_nread(t->bus.i2c.dev.bus, t->bus.i2c.dev.address, reg, data, length);
+    i2c_bus_release(&t->bus.i2c.dev);
+    return ret;
+}
+
+/* 비동기 전송 완료. 점유한 버스를 놓는다 */
+static void transport_i2c_done(I2C_Async_t* xfer, int result)
+{
+    Transport_t *t = (Transport_t *)xfer->arg;
+
+    i2c_bus_release(&t->bus.i2c.dev);
+    transport_complete(t, result);
+}
+
+/* 명령은 바로 보내고, 데이터만 인터럽트 전송으로 보낸다 */
+static int transport_i2c_write_async(Transport_t* t, const uint8_t* cmds, int ncmds, const uint8_t* data, int ndata)
+{
+    I2C_Async_t *xfer = &t->bus.i2c.xfer;
+
+    t->bus.i2c.queued = 0;
+    if (!t->bus.i2c.async || ndata == 0 || ndata > 0xFFFF) {
+        transport_complete(t, transport_i2c_write(t, cmds, ncmds, data, ndata));
+        return 1;
+    }
+    if (ncmds > 0 && transport_i2c_write(t, cmds, ncmds, NULL, 0) < 0)
+        return -1;
+
+    if (i2c_bus_acquire(&t->bus.i2c.dev, I2C_BUS_TIMEOUT) < 0)
+        return -1;
+    xfer->type = I2C_ASYNC_REG_WRITE;
+    xfer->address = t->bus.i2c.dev.address;
+    xfer->reg = t->datactrl;
+    xfer->regsize = 1;
+    xfer->data = (uint8_t *)data;
+    xfer->length = ndata;
+    xfer->callback = transport_i2c_done;
+    xfer->arg = t;
+    if (i2c_async_submit(t->bus.i2c.dev.bus, xfer) < 0) {
+        i2c_bus_release(&t->bus.i2c.dev);
+        return -1;
+    }
+    t->bus.i2c.queued = 1;
+    return 1;
+}
+
+static int transport_i2c_wait(Transport_t* t, uint32_t timeout)
+{
+    /* 블로킹 쓰기로 끝났으면 기술자는 지난 전송의 것이다 */
+    if (!t->bus.i2c.queued)
+        return t->result;
+    if (i2c_async_wait(&t->bus.i2c.xfer, timeout) > 0 || t->bus.i2c.xfer.state != I2C_ASYNC_PENDING)
+        return t->result;
+
+    /* 타임아웃이면 전송을 취소한다. 취소에는 완료 콜백이 없으므로 여기서 버스를 놓는다 */
+    if (i2c_async_cancel(t->bus.i2c.dev.bus, &t->bus.i2c.xfer) > 0) {
+        i2c_bus_release(&t->bus.i2c.dev);
+        transport_complete(t, -1);
+    }
+    return -1;
+}
+
+static const TransportOps_t transport_i2c_ops = {
+    transport_i2c_ready,
+    transport_i2c_write,
+    transport_i2c_read,
+    transport_i2c_write_async,
+    transport_i2c_wait,
+};
+
+int transport_i2c(Transport_t* t, I2C_t I2C_Num, I2C_PinsPack_t pack, int address, uint32_t hz)
+{
+    memset(t, 0, sizeof(Transport_t));
+    t->ops = &transport_i2c_ops;
+    t->cmdctrl = 0x00;
+    t->datactrl = 0x40;
+    t->result = 1;
+
+    /* 전송 시간을 잴 사이클 카운터 */
+    cyccnt_enable();
+    if (i2c_bus_attach(&t->bus.i2c.dev, I2C_Num, pack, address, hz) < 0)
+        return -1;
+    t->bus.i2c.xfer.state = I2C_ASYNC_DONE;
+    t->bus.i2c.async = (i2c_async_init(I2C_Num) > 0);
+    return 1;
+}
+
+/*
+ * SPI
+ */
+
+static void transport_spi_select(Transport_t* t, uint8_t dc)
+{
+    spi_set_profile(t->bus.spi.bus, &t->bus.spi.profile);
+    if (t->bus.spi.dc != GPIO_NC)
+        gpio_write(t->bus.spi.dc, dc);
+    spi_select(t->bus.spi.bus, t->bus.spi.cs);
+}
+
+static void transport_spi_deselect(Transport_t* t)
+{
+    spi_deselect(t->bus.spi.bus, t->bus.spi.cs);
+}
+
+static int transport_spi_ready(Transport_t* t)
+{
+    return 1;
+}
+
+static int transport_spi_write(Transport_t* t, const uint8_t* cmds, int ncmds, const uint8_t* data, int ndata)
+{
+    transport_spi_select(t, ncmds > 0 ? 0 : 1);
+    if (ncmds > 0) {
+        /* spi_nwrite() 는 마지막 바이트가 다 나간 뒤에 돌아오므로 바로 D/C 를 바꾸어도 된다 */
+        spi_nwrite(t->bus.spi.bus, cmds, ncmds);
+        if (ndata > 0 && t->bus.spi.dc != GPIO_NC)
+            gpio_write(t->bus.spi.dc, 1);
+    }
+    if (ndata > 0)
+        spi_nwrite(t->bus.spi.bus, data, ndata);
+    transport_spi_deselect(t);
+    return 1;
+}
+
+static int transport_spi_read(Transport_t* t, uint8_t reg, uint8_t* data, int length)
+{
+    uint8_t cmd = reg | t->readflag;
+    int ret;
+
+    transport_spi_select(t, 0);
+    spi_nwrite(t->bus.spi.bus, &cmd, 1);
+    ret = spi_nread(t->bus.spi.bus, data, length, 0xFF);
+    transport_spi_deselect(t);
+    return ret;
+}
+
+static void transport_spi_done(SPI_Async_t* xfer, int result)
+{
+    transport_complete((Transport_t *)xfer->arg, result);
+}
+
+/* 데이터가 뒤따르는 명령의 완료. 명령이 실패하면 명령 없이 데이터가 나가지 않도록 데이터를 취소한다 */
+static void transport_spi_command_done(SPI_Async_t* xfer, int result)
+{
+    Transport_t *t = (Transport_t *)xfer->arg;
+
+    if (result < 0 && spi_async_cancel(&t->bus.spi.xfer[1]) > 0)
+        transport_complete(t, result);
+}
+
+/* 명령은 CS 를 유지한 채 D/C low 로, 데이터는 D/C high 로 DMA 큐에 넣는다 */
+static int transport_spi_write_async(Transport_t* t, const uint8_t* cmds, int ncmds, const uint8_t* data, int ndata)
+{
+    SPI_Async_t *cmd = &t->bus.spi.xfer[0];
+    SPI_Async_t *dat = &t->bus.spi.xfer[1];
+    uint32_t primask;
+    int ret = 1;
+
+    if (!t->bus.spi.async || ncmds > 0xFFFF || ndata > 0xFFFF) {
+        transport_complete(t, transport_spi_write(t, cmds, ncmds, data, ndata));
+        return 1;
+    }
+
+    /* 명령이 실패했을 때 콜백에서 데이터를 취소할 수 있도록 두 기술자를 인터럽트 없이 함께 넣는다 */
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if (ncmds > 0) {
+        cmd->tx = cmds;
+        cmd->length = ncmds;
+        cmd->flags = (ndata > 0) ? SPI_ASYNC_HOLD : 0;
+        cmd->callback = (ndata > 0) ? transport_spi_command_done : transport_spi_done;
+        ret = spi_async_submit(cmd);
+        t->bus.spi.last = 0;
+    }
+    if (ret > 0 && ndata > 0) {
+        dat->tx = data;
+        dat->length = ndata;
+        if ((ret = spi_async_submit(dat)) < 0 && ncmds > 0)
+            spi_async_cancel(cmd);
+        t->bus.spi.last = 1;
+    }
+    __set_PRIMASK(primask);
+    return ret;
+}
+
+static int transport_spi_wait(Transport_t* t, uint32_t timeout)
+{
+    uint8_t cancelled;
+
+    /* 같은 장치의 전송은 순서대로 끝나므로 마지막 기술자만 기다리면 된다 */
+    if (spi_async_wait(&t->bus.spi.xfer[t->bus.spi.last], timeout) > 0)
+        return t->result;
+
+    /* 타임아웃이면 데이터, 명령 순서로 취소하여 데이터가 명령 없이 시작되지 않게 한다 */
+    cancelled = (spi_async_cancel(&t->bus.spi.xfer[1]) > 0);
+    cancelled |= (spi_async_cancel(&t->bus.spi.xfer[0]) > 0);
+    if (cancelled)
+        transport_complete(t, -1);
+    return -1;
+}
+
+static const TransportOps_t transport_spi_ops = {
+    transport_spi_ready,
+    transport_spi_write,
+    transport_spi_read,
+    transport_spi_write_async,
+    transport_spi_wait,
+};
+
+int transport_spi(Transport_t* t, SPI_t SPI_Num, GPIO_Pin_t cs, GPIO_Pin_t dc, SPI_Mode_t mode, uint32_t hz)
+{
+    int i;
+
+    memset(t, 0, sizeof(Transport_t));
+    t->ops = &transport_spi_ops;
+    t->readflag = 0x80;
+    t->result = 1;
+    t->bus.spi.bus = SPI_Num;
+    t->bus.spi.cs = cs;
+    t->bus.spi.dc = dc;
+    if (spi_make_profile(SPI_Num, &t->bus.spi.profile, mode, 8, hz) < 0)
+        return -1;
+
+    /* 전송 시간을 잴 사이클 카운터 */
+    cyccnt_enable();
+
+    if (cs != GPIO_NC) {
+        gpio_init(cs, GPIO_OUT);
+        gpio_write(cs, 1);
+    }
+    if (dc != GPIO_NC)
+        gpio_init(dc, GPIO_OUT);
+
+    t->bus.spi.async = (spi_async_init(SPI_Num) > 0);
+    if (t->bus.spi.async) {
+        spi_async_device(&t->bus.spi.dev, SPI_Num, cs, dc, mode, hz, 8);
+        for (i = 0; i < 2; i++) {
+            t->bus.spi.xfer[i].dev = &t->bus.spi.dev;
+            t->bus.spi.xfer[i].dc = i;
+            t->bus.spi.xfer[i].rx = NULL;
+            t->bus.spi.xfer[i].callback = transport_spi_done;
+            t->bus.spi.xfer[i].arg = t;
+            t->bus.spi.xfer[i].state = SPI_ASYNC_DONE;
+        }
+    }
+    return 1;
+}
+
+/*
+ * 소프트웨어 I2C
+ */
+
+static int transport_swi2c_ready(Transport_t* t)
+{
+    return swi2c_ready(t->bus.swi2c.bus, t->bus.swi2c.address);
+}
+
+/* 명령 목록과 데이터를 한 번의 전송으로 보낸다 */
+static int transport_swi2c_combined(Transport_t* t, const uint8_t* cmds, int ncmds, const uint8_t* data, int ndata)
+{
+    SWI2C_t *bus = t->bus.swi2c.bus;
+    int i, ret = 1;
+
+    swi2c_start(bus);
+    if (swi2c_writebyte(bus, t->bus.swi2c.address & 0xFE) != SWI2C_ACK) {
+        ret = -1;
+        goto stop;
+    }
+    for (i = 0; i < ncmds; i++) {
+        if (swi2c_writebyte(bus, t->cmdctrl | 0x80) != SWI2C_ACK ||
+            swi2c_writebyte(bus, cmds[i]) != SWI2C_ACK) {
+            ret = -1;
+            goto stop;
+        }
+    }
+    if (swi2c_writebyte(bus, t->datactrl) != SWI2C_ACK) {
+        ret = -1;
+        goto stop;
+    }
+    for (i = 0; i < ndata; i++) {
+        if (swi2c_writebyte(bus, data[i]) != SWI2C_ACK) {
+            ret = -1;
+            break;
+        }
+    }
+stop:
+    swi2c_stop(bus);
+    /* 클록 늘이기 타임아웃은 swi2c_nwrite() 처럼 이 전송에서 끝낸다 */
+    if (bus->error) {
+        bus->error = 0;
+        ret = -1;
+    }
+    return ret;
+}
+
+static int transport_swi2c_write(Transport_t* t, const uint8_t* cmds, int ncmds, const uint8_t* data, int ndata)
+{
+    int ret = 1;
+
+    if (ncmds > 0 && ndata > 0)
+        return transport_swi2c_combined(t, cmds, ncmds, data, ndata);
+    if (ncmds > 0)
+        ret = swi2c_nwrite(t->bus.swi2c.bus, t->bus.swi2c.address, t->cmdctrl, cmds, ncmds);
+    if (ret > 0 && ndata > 0)
+        ret = swi2c_nwrite(t->bus.swi2c.bus, t->bus.swi2c.address, t->datactrl, data, ndata);
+    return ret;
+}
+
+static int transport_swi2c_read(Transport_t* t, uint8_t reg, uint8_t* data, int length)
+{
+    return swi2c_nread(t->bus.swi2c.bus, t->bus.swi2c.address, reg, data, length);
+}
+
+static const TransportOps_t transport_swi2c_ops = {
+    transport_swi2c_ready,
+    transport_swi2c_write,
+    transport_swi2c_read,
+    NULL,
+    NULL,
+};
+
+int transport_swi2c(Transport_t* t, SWI2C_t* bus, int address)
+{
+    memset(t, 0, sizeof(Transport_t));
+    t->ops = &transport_swi2c_ops;
+    t->cmdctrl = 0x00;
+    t->datactrl = 0x40;
+    t->result = 1;
+    t->bus.swi2c.bus = bus;
+    t->bus.swi2c.address = address;
+
+    /* 전송 시간을 잴 사이클 카운터 */
+    cyccnt_enable();
+    return 1;
+}
+
+/*
+ * 기록 전송
+ */
+
+/* 동작 하나를 기록한다. 남은 공간이 모자라면 버린다 */
+static void transport_record_put(Transport_t* t, uint8_t kind, const uint8_t* data, int length)
+{
+    uint8_t *p;
+
+    if (t->bus.record.log == NULL)
+        return;
+    if (t->bus.record.length + 3 + length > t->bus.record.size) {
+        t->bus.record.dropped++;
+        return;
+    }
+    p = &t->bus.record.log[t->bus.record.length];
+    p[0] = kind;
+    p[1] = length & 0xFF;
+    p[2] = (length >> 8) & 0xFF;
+    if (length > 0)
+        memcpy(&p[3], data, length);
+    t->bus.record.length += 3 + length;
+}
+
+static int transport_record_ready(Transport_t* t)
+{
+    return 1;
+}
+
+static int transport_record_write(Transport_t* t, const uint8_t* cmds, int ncmds, const uint8_t* data, int ndata)
+{
+    if (ncmds > 0)
+        transport_record_put(t, TRANSPORT_REC_COMMAND, cmds, ncmds);
+    if (ndata > 0)
+        transport_record_put(t, TRANSPORT_REC_DATA, data, ndata);
+    return 1;
+}
+
+static int transport_record_read(Transport_t* t, uint8_t reg, uint8_t* data, int length)
+{
+    uint8_t *p;
+
+    memset(data, 0, length);
+    if (t->bus.record.log == NULL)
+        return 1;
+    if (t->bus.record.length + 4 > t->bus.record.size) {
+        t->bus.record.dropped++;
+        return 1;
+    }
+    p = &t->bus.record.log[t->bus.record.length];
+    p[0] = TRANSPORT_REC_READ;
+    p[1] = length & 0xFF;
+    p[2] = (length >> 8) & 0xFF;
+    p[3] = reg;
+    t->bus.record.length += 4;
+    return 1;
+}
+
+static const TransportOps_t transport_record_ops = {
+    transport_record_ready,
+    transport_record_write,
+    transport_record_read,
+    NULL,
+    NULL,
+};
+
+int transport_record(Transport_t* t, uint8_t* log, uint32_t size)
+{
+    memset(t, 0, sizeof(Transport_t));
+    t->ops = &transport_record_ops;
+    t->cmdctrl = 0x00;
+    t->datactrl = 0x40;
+    t->readflag = 0x80;
+    t->result = 1;
+    t->bus.record.log = log;
+    t->bus.record.size = size;
+
+    /* 전송 시간을 잴 사이클 카운터 */
+    cyccnt_enable();
+    return 1;
+}
+
+/*
+ * 공통 함수
+ */
+
+/* 진행 중인 비동기 쓰기를 기다린다. 결과가 나왔을 때만 진행 중 표시를 지운다 */
+static int transport_settle(Transport_t* t, uint32_t timeout)
+{
+    int ret = (t->ops->wait != NULL) ? t->ops->wait(t, timeout) : t->result;
+
+    /* 취소되지 않은 전송은 아직 버스와 데이터를 쓰고 있으므로 진행 중으로 남긴다 */
+    if (t->result != TRANSPORT_PENDING)
+        t->pending = 0;
+    return ret;
+}
+
+/* 다음 전송 전에 비동기 쓰기를 기다린다 */
+static int transport_idle(Transport_t* t)
+{
+    if (!t->pending)
+        return 1;
+    return transport_settle(t, TRANSPORT_TIMEOUT);
+}
+
+int transport_ready(Transport_t* t)
+{
+    if (transport_idle(t) < 0)
+        return -1;
+    return t->ops->ready(t);
+}
+
+int transport_write(Transport_t* t, const uint8_t* cmds, int ncmds, const uint8_t* data, int ndata)
+{
+    uint32_t start;
+    int ret;
+
+    if (ncmds < 0 || ndata < 0)
+        return -1;
+    if (ncmds == 0 && ndata == 0)
+        return 1;
+    if (transport_idle(t) < 0) {
+        t->stats.errors++;
+        /* 앞선 비동기 쓰기가 아직 버스를 쓰고 있다 */
+        if (t->pending)
+            return -1;
+    }
+
+    start = TRANSPORT_TIMESTAMP();
+    ret = t->ops->write(t, cmds, ncmds, data, ndata);
+    t->stats.cycles += TRANSPORT_TIMESTAMP() - start;
+    t->stats.calls++;
+    if (ret < 0) {
+        t->stats.errors++;
+        return -1;
+    }
+    t->stats.commands += ncmds;
+    t->stats.data += ndata;
+    return 1;
+}
+
+int transport_read(Transport_t* t, uint8_t reg, uint8_t* data, int length)
+{
+    uint32_t start;
+    int ret;
+
+    if (length <= 0)
+        return -1;
+    if (transport_idle(t) < 0) {
+        t->stats.errors++;
+        /* 앞선 비동기 쓰기가 아직 버스를 쓰고 있다 */
+        if (t->pending)
+            return -1;
+    }
+
+    start = TRANSPORT_TIMESTAMP();
+    ret = t->ops->read(t, reg, data, length);
+    t->stats.cycles += TRANSPORT_TIMESTAMP() - start;
+    t->stats.calls++;
+    if (ret < 0) {
+        t->stats.errors++;
+        return -1;
+    }
+    t->stats.reads += length;
+    return 1;
+}
+
+int transport_write_async(Transport_t* t, const uint8_t* cmds, int ncmds, const uint8_t* data, int ndata, TransportCallback_t callback, void* arg)
+{
+    uint32_t start;
+    int ret;
+
+    if (ncmds < 0 || ndata < 0 || (ncmds == 0 && ndata == 0))
+        return -1;
+    if (transport_idle(t) < 0) {
+        t->stats.errors++;
+        /* 앞선 비동기 쓰기가 아직 버스를 쓰고 있다 */
+        if (t->pending)
+            return -1;
+    }
+
+    t->callback = callback;
+    t->arg = arg;
+    t->result = TRANSPORT_PENDING;
+    t->pending = 1;
+    start = TRANSPORT_TIMESTAMP();
+    if (t->ops->write_async)
+        ret = t->ops->write_async(t, cmds, ncmds, data, ndata);
+    else {
+        transport_complete(t, t->ops->write(t, cmds, ncmds, data, ndata));
+        ret = 1;
+    }
+    t->stats.cycles += TRANSPORT_TIMESTAMP() - start;
+    t->stats.calls++;
+    t->stats.asyncs++;
+    if (ret < 0) {
+        t->pending = 0;
+        t->result = -1;
+        t->stats.errors++;
+        return -1;
+    }
+    t->stats.commands += ncmds;
+    t->stats.data += ndata;
+    return 1;
+}
+
+int transport_wait(Transport_t* t, uint32_t timeout)
+{
+    if (!t->pending)
+        return t->result;
+    return transport_settle(t, timeout);
+}
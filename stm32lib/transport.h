@@ -0,0 +1,363 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+#ifndef TRANSPORT_H
+#define TRANSPORT_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup stm32lib
+ * @{
+ */
+
+/**
+ * @defgroup TRANSPORT
+ * @brief    I2C, SPI, 소프트웨어 I2C 를 같은 방법으로 사용하는 장치 전송 계층
+ * @{
+ *
+ * SSD1306 처럼 I2C 와 SPI 모델이 모두 있는 장치의 드라이버를 한 번만 작성하고,
+ * 보드에서 가장 빠른 버스를 골라 쓸 수 있도록 버스를 @ref Transport_t 로 감싼다.
+ * 드라이버는 다음 네 가지 동작만 사용한다.
+ *  - 명령 목록 쓰기와 데이터 쓰기: @ref transport_write(). 둘을 함께 주면 한 트랜잭션으로 보낸다
+ *  - 레지스터 블록 읽기: @ref transport_read()
+ *  - 비동기 쓰기: @ref transport_write_async(), @ref transport_wait()
+ *  - 장치 확인: @ref transport_ready()
+ *
+ * 명령과 데이터는 버스마다 다음과 같이 구분된다.
+ *  - I2C, 소프트웨어 I2C: 주소 다음의 제어 바이트. cmdctrl(기본 0x00), datactrl(기본 0x40)
+ *  - SPI: D/C 핀. 명령은 low, 데이터는 high. 레지스터를 읽을 때에는 레지스터 주소에 readflag(기본 0x80)를 더한다
+ *
+ * 기록 전송(@ref transport_record())은 버스 없이 모든 동작을 메모리에 기록하므로,
+ * 호스트에서 드라이버를 시험하거나 버스와 관계없는 드라이버 자체의 시간을 잴 때 사용한다.
+ *
+ * \par 사용 예
+ *
+\code
+static Transport_t oled;
+
+//I2C 모델
+transport_i2c(&oled, I2C_1, I2C1_PINS2, 0x78, 400000);
+//또는 SPI 모델
+spi_init(SPI_1, SPI1_PINS1);
+transport_spi(&oled, SPI_1, GPIO_PB_6, GPIO_PC_7, SPI_Mode0, 8000000);
+
+ssd1306_init_transport(&oled);
+\endcode
+ *
+ * \par Changelog
+ *
+\verbatim
+ 버전 1.0
+  - 최초 배포
+\endverbatim
+ *
+ * \par 의존성
+ *
+\verbatim
+ - STM32F4xx HAL
+ - I2C, I2CBUS, I2CASYNC
+ - SPI, SPIASYNC
+ - SWI2C
+ - GPIO
+\endverbatim
+ */
+#include "stm32f4xx_hal.h"
+#include "../stm32lib/i2c.h"
+#include "../stm32lib/i2cbus.h"
+#include "../stm32lib/i2casync.h"
+#include "../stm32lib/spi.h"
+#include "../stm32lib/spiasync.h"
+#include "../stm32lib/swi2c.h"
+#include "../stm32lib/gpio.h"
+
+/**
+ * @defgroup TRANSPORT_매크로
+ * @brief    TRANSPORT 매크로
+ * @{
+ */
+
+/**
+ * @brief  명령과 데이터를 한 번의 I2C 전송으로 보낼 때 허용하는 최대 명령 수
+ * @note   더 많으면 명령과 데이터를 두 번에 나누어 보낸다
+ */
+#ifndef TRANSPORT_MAX_COMMANDS
+#define TRANSPORT_MAX_COMMANDS  8
+#endif
+
+/**
+ * @brief  앞선 비동기 전송을 기다리는 최대 시간(ms)
+ */
+#ifndef TRANSPORT_TIMEOUT
+#define TRANSPORT_TIMEOUT       100
+#endif
+
+/**
+ * @brief  전송 시간 측정에 사용하는 사이클 카운터
+ */
+#ifndef TRANSPORT_TIMESTAMP
+#define TRANSPORT_TIMESTAMP()   (DWT->CYCCNT)
+#endif
+
+/**
+ * @brief  기록 전송의 동작 종류. 기록은 종류 1 바이트, 길이 2 바이트(리틀 엔디안), 내용 순서이다
+ */
+#define TRANSPORT_REC_COMMAND   'C'     /*!< 명령 목록 */
+#define TRANSPORT_REC_DATA      'D'     /*!< 데이터 */
+#define TRANSPORT_REC_READ      'R'     /*!< 레지스터 읽기. 내용은 레지스터 주소 1 바이트, 길이는 읽은 바이트 수 */
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup TRANSPORT_자료형
+ * @brief    TRANSPORT 자료형
+ * @{
+ */
+
+typedef struct Transport Transport_t;
+
+/**
+ * @brief  비동기 쓰기 완료 콜백 함수. 인터럽트 문맥에서 호출될 수 있다
+ * @param  *t: 전송 구조체
+ * @param  result: 1: 정상, -1: 오류
+ * @param  *arg: @ref transport_write_async() 에 넘겨준 사용자 포인터
+ */
+typedef void (*TransportCallback_t)(Transport_t* t, int result, void* arg);
+
+/**
+ * @brief  버스별 동작 함수 구조체
+ * @note   write_async 와 wait 가 NULL 이면 비동기 쓰기는 블로킹 쓰기 후 콜백을 부른다
+ */
+typedef struct {
+    int (*ready)(Transport_t* t);
+    int (*write)(Transport_t* t, const uint8_t* cmds, int ncmds, const uint8_t* data, int ndata);
+    int (*read)(Transport_t* t, uint8_t reg, uint8_t* data, int length);
+    int (*write_async)(Transport_t* t, const uint8_t* cmds, int ncmds, const uint8_t* data, int ndata);
+    int (*wait)(Transport_t* t, uint32_t timeout);
+} TransportOps_t;
+
+/**
+ * @brief  통계 구조체
+ */
+typedef struct {
+    uint32_t calls;         /*!< 쓰기와 읽기 호출 수 */
+    uint32_t asyncs;        /*!< 그 중 비동기 쓰기 수 */
+    uint32_t commands;      /*!< 보낸 명령 바이트 수 */
+    uint32_t data;          /*!< 보낸 데이터 바이트 수 */
+    uint32_t reads;         /*!< 읽은 바이트 수 */
+    uint32_t errors;        /*!< 오류로 끝난 호출 수 */
+    uint32_t cycles;        /*!< 호출 안에서 보낸 사이클 수의 합. 비동기 쓰기는 시작까지만 */
+} TransportStats_t;
+
+/**
+ * @brief  전송 구조체
+ */
+struct Transport {
+    const TransportOps_t *ops;  /*!< 버스별 동작 함수 */
+    uint8_t cmdctrl;            /*!< I2C 명령 제어 바이트 */
+    uint8_t datactrl;           /*!< I2C 데이터 제어 바이트 */
+    uint8_t readflag;           /*!< SPI 레지스터 읽기 표시 */
+    uint8_t pending;            /*!< 비동기 쓰기가 진행 중이면 1. 내부용 */
+    volatile int8_t result;     /*!< 마지막 비동기 쓰기 결과. 내부용 */
+    TransportCallback_t callback; /*!< 비동기 쓰기 완료 콜백. 내부용 */
+    void *arg;                  /*!< 콜백 사용자 포인터. 내부용 */
+    union {
+        struct {
+            I2C_Device_t dev;   /*!< 공유 버스에 등록된 장치 */
+            I2C_Async_t xfer;   /*!< 비동기 전송 기술자 */
+            uint8_t async;      /*!< 비동기 전송을 사용할 수 있으면 1 */
+            uint8_t queued;     /*!< 마지막 비동기 쓰기를 큐에 넣었으면 1 */
+        } i2c;
+        struct {
+            SPI_t bus;          /*!< SPI 번호 */
+            GPIO_Pin_t cs;      /*!< CS 핀. 없으면 GPIO_NC */
+            GPIO_Pin_t dc;      /*!< D/C 핀. 없으면 GPIO_NC */
+            SPI_Profile_t profile; /*!< 버스 설정 */
+            SPI_Device_t dev;   /*!< 비동기 전송 장치 */
+            SPI_Async_t xfer[2]; /*!< 명령, 데이터 전송 기술자 */
+            uint8_t last;       /*!< 마지막으로 큐에 넣은 기술자 번호 */
+            uint8_t async;      /*!< 비동기 전송을 사용할 수 있으면 1 */
+        } spi;
+        struct {
+            SWI2C_t *bus;       /*!< 소프트웨어 I2C 버스 */
+            int address;        /*!< I2C 장치 주소 */
+        } swi2c;
+        struct {
+            uint8_t *log;       /*!< 기록 버퍼 */
+            uint32_t size;      /*!< 기록 버퍼 크기 */
+            uint32_t length;    /*!< 기록된 바이트 수 */
+            uint32_t dropped;   /*!< 버퍼가 가득 차서 버린 동작 수 */
+        } record;
+    } bus;                      /*!< 버스별 자료. 내부용 */
+    TransportStats_t stats;     /*!< 통계 */
+};
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup TRANSPORT_함수
+ * @brief    TRANSPORT 함수
+ * @{
+ */
+
+/**
+ * @brief  하드웨어 I2C 전송을 초기화한다
+ * @note   장치는 @ref i2c_bus_attach() 로 공유 버스에 등록되며, 동작마다 버스를 점유하고 놓는다.
+ *         @ref i2c_async_init() 이 성공하면 비동기 쓰기에 인터럽트 전송을 사용한다
+ * @param  *t: 초기화할 전송 구조체
+ * @param  I2C_Num: I2C 번호
+ * @param  pack: 버스를 처음 초기화할 때 사용할 핀 묶음
+ * @param  address: I2C 장치 주소
+ * @param  hz: 장치가 원하는 SCL 주파수
+ * @retval 실행 상태, 1: 정상, -1: 오류
+ */
+int transport_i2c(Transport_t* t, I2C_t I2C_Num, I2C_PinsPack_t pack, int address, uint32_t hz);
+
+/**
+ * @brief  SPI 전송을 초기화한다
+ * @note   SPI 버스는 @ref spi_init() 으로 먼저 초기화되어 있어야 한다.
+ *         @ref spi_async_init() 이 성공하면 비동기 쓰기에 DMA 를 사용한다
+ * @param  *t: 초기화할 전송 구조체
+ * @param  SPI_Num: SPI 번호
+ * @param  cs: CS 핀. 없으면 GPIO_NC
+ * @param  dc: D/C 핀. 없으면 GPIO_NC
+ * @param  mode: SPI 모드
+ * @param  hz: 장치가 허용하는 최대 SCK 주파수
+ * @retval 실행 상태, 1: 정상, -1: 오류
+ */
+int transport_spi(Transport_t* t, SPI_t SPI_Num, GPIO_Pin_t cs, GPIO_Pin_t dc, SPI_Mode_t mode, uint32_t hz);
+
+/**
+ * @brief  소프트웨어 I2C 전송을 초기화한다
+ * @param  *t: 초기화할 전송 구조체
+ * @param  *bus: @ref swi2c_init() 으로 초기화된 버스
+ * @param  address: I2C 장치 주소
+ * @retval 실행 상태, 1: 정상, -1: 오류
+ */
+int transport_swi2c(Transport_t* t, SWI2C_t* bus, int address);
+
+/**
+ * @brief  모든 동작을 메모리에 기록하는 전송을 초기화한다
+ * @note   읽기는 0 으로 채운다. log 가 NULL 이면 통계만 센다
+ * @param  *t: 초기화할 전송 구조체
+ * @param  *log: 기록 버퍼
+ * @param  size: 기록 버퍼 크기
+ * @retval 1
+ */
+int transport_record(Transport_t* t, uint8_t* log, uint32_t size);
+
+/**
+ * @brief  장치가 응답하는지 확인한다
+ * @note   SPI 와 기록 전송은 항상 1 이다
+ * @param  *t: 사용할 전송 구조체
+ * @retval 1: 응답, -1: 응답 없음
+ */
+int transport_ready(Transport_t* t);
+
+/**
+ * @brief  명령 목록과 데이터를 쓴다
+ * @note   둘 다 주면 명령 다음에 데이터가 이어지는 한 트랜잭션으로 보낸다. 진행 중인 비동기 쓰기가 있으면 먼저 기다린다
+ * @param  *t: 사용할 전송 구조체
+ * @param  *cmds: 명령 목록. ncmds 가 0 이면 NULL 가능
+ * @param  ncmds: 명령 바이트 수
+ * @param  *data: 데이터. ndata 가 0 이면 NULL 가능
+ * @param  ndata: 데이터 바이트 수
+ * @retval 실행 상태, 1: 정상, -1: 오류
+ */
+int transport_write(Transport_t* t, const uint8_t* cmds, int ncmds, const uint8_t* data, int ndata);
+
+/**
+ * @brief  명령 목록을 쓴다
+ * @retval 실행 상태, 1: 정상, -1: 오류
+ */
+#define transport_command(t, cmds, n)   transport_write((t), (cmds), (n), NULL, 0)
+
+/**
+ * @brief  데이터를 쓴다
+ * @retval 실행 상태, 1: 정상, -1: 오류
+ */
+#define transport_data(t, data, n)      transport_write((t), NULL, 0, (data), (n))
+
+/**
+ * @brief  레지스터 블록을 읽는다
+ * @param  *t: 사용할 전송 구조체
+ * @param  reg: 처음 읽을 레지스터 주소
+ * @param  *data: 읽은 데이터를 저장할 버퍼
+ * @param  length: 읽을 바이트 수
+ * @retval 실행 상태, 1: 정상, -1: 오류
+ */
+int transport_read(Transport_t* t, uint8_t reg, uint8_t* data, int length);
+
+/**
+ * @brief  명령 목록과 데이터를 기다리지 않고 쓴다
+ * @note   cmds 와 data 는 완료될 때까지 유지되어야 한다. 비동기 전송이 없는 버스는 바로 보내고 콜백을 부른다
+ * @param  *t: 사용할 전송 구조체
+ * @param  *cmds: 명령 목록. ncmds 가 0 이면 NULL 가능
+ * @param  ncmds: 명령 바이트 수
+ * @param  *data: 데이터. ndata 가 0 이면 NULL 가능
+ * @param  ndata: 데이터 바이트 수
+ * @param  callback: 완료 콜백 함수, NULL 가능
+ * @param  *arg: 콜백 함수에 넘겨줄 사용자 포인터
+ * @retval 실행 상태, 1: 시작함, -1: 오류
+ */
+int transport_write_async(Transport_t* t, const uint8_t* cmds, int ncmds, const uint8_t* data, int ndata, TransportCallback_t callback, void* arg);
+
+/**
+ * @brief  진행 중인 비동기 쓰기가 끝날 때까지 기다린다
+ * @note   SPI 는 타임아웃이면 남은 DMA 전송을 취소하고 오류로 끝낸다. 하드웨어 I2C 는 전송을 취소할 수 없으므로
+ *         진행 중으로 남고, 끝날 때까지 다른 쓰기와 읽기는 -1 을 돌려준다
+ * @param  *t: 사용할 전송 구조체
+ * @param  timeout: 밀리초 단위 타임아웃
+ * @retval 마지막 비동기 쓰기의 결과, 1: 정상, -1: 오류 또는 타임아웃
+ */
+int transport_wait(Transport_t* t, uint32_t timeout);
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
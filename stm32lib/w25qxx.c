@@ -0,0 +1,558 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+#include "../stm32lib/w25qxx.h"
+#include "../stm32lib/cyccnt.h"
+
+/* Commands */
+#define CMD_WRITE_ENABLE    0x06
+#define CMD_READ_STATUS1    0x05
+#define CMD_FAST_READ       0x0B
+#define CMD_FAST_READ_4B    0x0C
+#define CMD_PAGE_PROGRAM    0x02
+#define CMD_PAGE_PROGRAM_4B 0x12
+#define CMD_SECTOR_ERASE    0x20
+#define CMD_SECTOR_ERASE_4B 0x21
+#define CMD_BLOCK32_ERASE   0x52
+#define CMD_BLOCK64_ERASE   0xD8
+#define CMD_BLOCK64_ERASE_4B 0xDC
+#define CMD_CHIP_ERASE      0xC7
+#define CMD_RELEASE_PD      0xAB
+#define CMD_JEDEC_ID        0x9F
+
+/* Status register 1 */
+#define SR_BUSY             0x01
+#define SR_WEL              0x02
+
+/* Operation in progress */
+#define BUSY_NONE           0
+#define BUSY_PROGRAM        1
+#define BUSY_ERASE          2
+
+/* Timeouts in ms (datasheet maximum plus margin) */
+#define W25QXX_PAGE_TIMEOUT     5
+#define W25QXX_SECTOR_TIMEOUT   500
+#define W25QXX_BLOCK32_TIMEOUT  1600
+#define W25QXX_BLOCK64_TIMEOUT  2000
+#define W25QXX_CHIP_TIMEOUT     400000
+#define W25QXX_DMA_MARGIN       100     /* added to the SCK time of each DMA chunk */
+
+/* Private functions */
+static void w25qxx_select(W25QXX_t* flash);
+static void w25qxx_deselect(W25QXX_t* flash);
+static void w25qxx_command(W25QXX_t* flash, uint8_t cmd, uint32_t addr, int dummy);
+static int w25qxx_transfer(W25QXX_t* flash, const uint8_t* tx, uint8_t* rx, uint32_t length);
+static uint8_t w25qxx_status(W25QXX_t* flash);
+static void w25qxx_start(W25QXX_t* flash, uint8_t busy, uint32_t timeout);
+static int w25qxx_wait_ready(W25QXX_t* flash);
+static int w25qxx_write_enable(W25QXX_t* flash);
+static int w25qxx_erase_next(W25QXX_t* flash);
+static int w25qxx_read_raw(W25QXX_t* flash, uint32_t addr, uint8_t* data, uint32_t len);
+static int w25qxx_cache_find(W25QXX_t* flash, uint32_t line);
+static int w25qxx_cache_victim(W25QXX_t* flash);
+static void w25qxx_invalidate(W25QXX_t* flash, uint32_t addr, uint32_t len);
+
+W25QXX_Res_t w25qxx_init(W25QXX_t* flash, SPI_t SPI_Num, GPIO_Pin_t cs)
+{
+    uint32_t size = 0;
+    uint8_t i;
+
+    memset(flash, 0, sizeof(W25QXX_t));
+    flash->bus = SPI_Num;
+    flash->cs = cs;
+    gpio_init(cs, GPIO_OUT);
+    gpio_write(cs, 1);
+    flash->hz = spi_make_profile(SPI_Num, &flash->profile, SPI_Mode0, 8, W25QXX_FREQUENCY);
+
+    /* 읽기/쓰기 시간을 잴 사이클 카운터 */
+    cyccnt_enable();
+
+    /* 파워다운 상태일 수 있으므로 깨운다 (tRES1) */
+    w25qxx_select(flash);
+    spi_writeread(SPI_Num, CMD_RELEASE_PD);
+    w25qxx_deselect(flash);
+    HAL_Delay(1);
+
+    w25qxx_select(flash);
+    spi_writeread(SPI_Num, CMD_JEDEC_ID);
+    for (i = 0; i < 3; i++)
+        flash->jedec[i] = spi_writeread(SPI_Num, 0xFF);
+    w25qxx_deselect(flash);
+    if (flash->jedec[0] == 0x00 || flash->jedec[0] == 0xFF)
+        return W25QXX_RES_NODEV;
+
+    /* 용량 코드는 2 의 지수이며, Winbond 는 512Mbit 부터 0x20 으로 이어진다 */
+    if (flash->jedec[2] >= 0x10 && flash->jedec[2] <= 0x19)
+        size = 1UL << flash->jedec[2];
+    else if (flash->jedec[2] >= 0x20 && flash->jedec[2] <= 0x22)
+        size = 1UL << (flash->jedec[2] - 6);
+    else
+        return W25QXX_RES_NODEV;
+    flash->addrlen = (size > 0x1000000) ? 4 : 3;
+
+    /* MCU 만 리셋되었으면 칩은 지우기를 계속하고 있을 수 있다 */
+    w25qxx_start(flash, BUSY_ERASE, W25QXX_CHIP_TIMEOUT);
+    if (w25qxx_wait_ready(flash) < 0)
+        return W25QXX_RES_TIMEOUT;
+    flash->size = size;
+
+#if W25QXX_DMA
+    /* DMA 를 쓸 수 없는 버스이면 블로킹 전송을 사용한다. CS 는 이 드라이버가 직접 다룬다 */
+    flash->dma = (spi_async_init(SPI_Num) > 0);
+    if (flash->dma)
+        spi_async_device(&flash->dev, SPI_Num, GPIO_NC, GPIO_NC, SPI_Mode0, W25QXX_FREQUENCY, 8);
+#endif
+    return W25QXX_RES_OK;
+}
+
+W25QXX_Res_t w25qxx_read(W25QXX_t* flash, uint32_t addr, void* data, uint32_t len)
+{
+    W25QXX_Res_t res;
+    uint32_t start;
+
+    if (flash->size == 0)
+        return W25QXX_RES_NODEV;
+    if (len == 0 || addr >= flash->size || len > flash->size - addr)
+        return W25QXX_RES_PARAM;
+    if ((res = w25qxx_sync(flash)) != W25QXX_RES_OK)
+        return res;
+
+    start = W25QXX_TIMESTAMP();
+    if (w25qxx_read_raw(flash, addr, (uint8_t *)data, len) < 0)
+        return W25QXX_RES_ERR;
+    flash->stats.readbytes += len;
+    flash->stats.readcycles += W25QXX_TIMESTAMP() - start;
+    return W25QXX_RES_OK;
+}
+
+W25QXX_Res_t w25qxx_read_cached(W25QXX_t* flash, uint32_t addr, void* data, uint32_t len)
+{
+    uint8_t *p = (uint8_t *)data;
+    uint32_t start, line, offset, n;
+    W25QXX_Res_t res;
+    int i;
+
+    if (flash->size == 0)
+        return W25QXX_RES_NODEV;
+    if (len == 0 || addr >= flash->size || len > flash->size - addr)
+        return W25QXX_RES_PARAM;
+    if ((res = w25qxx_sync(flash)) != W25QXX_RES_OK)
+        return res;
+
+    start = W25QXX_TIMESTAMP();
+    while (len) {
+        line = addr / W25QXX_CACHE_LINE;
+        offset = addr & (W25QXX_CACHE_LINE - 1);
+        n = W25QXX_CACHE_LINE - offset;
+        if (n > len)
+            n = len;
+
+        i = w25qxx_cache_find(flash, line);
+        if (i >= 0) {
+            flash->stats.hits++;
+            memcpy(p, flash->cache[i] + offset, n);
+        } else if (n == W25QXX_CACHE_LINE) {
+            /* 캐시에 없는 온전한 라인들은 캐시를 밀어내지 않고 한 번에 바로 읽는다 */
+            while (n + W25QXX_CACHE_LINE <= len && w25qxx_cache_find(flash, line + n / W25QXX_CACHE_LINE) < 0)
+                n += W25QXX_CACHE_LINE;
+            flash->stats.misses += n / W25QXX_CACHE_LINE;
+            if (w25qxx_read_raw(flash, addr, p, n) < 0)
+                return W25QXX_RES_ERR;
+            flash->stats.readbytes += n;
+        } else {
+            flash->stats.misses++;
+            i = w25qxx_cache_victim(flash);
+            flash->tag[i] = 0;
+            if (w25qxx_read_raw(flash, line * W25QXX_CACHE_LINE, flash->cache[i], W25QXX_CACHE_LINE) < 0)
+                return W25QXX_RES_ERR;
+            flash->tag[i] = line + 1;
+            flash->stats.readbytes += W25QXX_CACHE_LINE;
+            memcpy(p, flash->cache[i] + offset, n);
+        }
+        if (i >= 0)
+            flash->age[i] = ++flash->clock;
+        addr += n;
+        p += n;
+        len -= n;
+    }
+    flash->stats.readcycles += W25QXX_TIMESTAMP() - start;
+    return W25QXX_RES_OK;
+}
+
+W25QXX_Res_t w25qxx_write(W25QXX_t* flash, uint32_t addr, const void* data, uint32_t len)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    W25QXX_Res_t res;
+    uint32_t start, n;
+
+    if (flash->size == 0)
+        return W25QXX_RES_NODEV;
+    if (len == 0 || addr >= flash->size || len > flash->size - addr)
+        return W25QXX_RES_PARAM;
+    /* 지우기가 모두 끝난 후에 쓴다. 지우기 시간은 쓰기 속도에 넣지 않는다 */
+    if (flash->busy == BUSY_ERASE || flash->eraseaddr < flash->eraseend) {
+        if ((res = w25qxx_sync(flash)) != W25QXX_RES_OK)
+            return res;
+    }
+    w25qxx_invalidate(flash, addr, len);
+
+    start = W25QXX_TIMESTAMP();
+    while (len) {
+        n = W25QXX_PAGE_SIZE - (addr & (W25QXX_PAGE_SIZE - 1));
+        if (n > len)
+            n = len;
+        /*
+         * 앞 페이지를 프로그램하는 동안 다음 페이지를 DMA 버퍼로 옮겨 둔다.
+         * 그래서 DMA 가 읽을 수 없는 CCM RAM 의 데이터도 쓸 수 있고, data 는 돌아오자마자 다시 쓸 수 있다
+         */
+        memcpy(flash->page, p, n);
+        if (w25qxx_wait_ready(flash) < 0)
+            return W25QXX_RES_TIMEOUT;
+        if (w25qxx_write_enable(flash) < 0)
+            return W25QXX_RES_ERR;
+
+        w25qxx_select(flash);
+        w25qxx_command(flash, (flash->addrlen == 4) ? CMD_PAGE_PROGRAM_4B : CMD_PAGE_PROGRAM, addr, 0);
+        if (w25qxx_transfer(flash, flash->page, NULL, n) < 0) {
+            w25qxx_deselect(flash);
+            return W25QXX_RES_ERR;
+        }
+        w25qxx_deselect(flash);
+        w25qxx_start(flash, BUSY_PROGRAM, W25QXX_PAGE_TIMEOUT);
+
+        flash->stats.pages++;
+        flash->stats.writebytes += n;
+        addr += n;
+        p += n;
+        len -= n;
+    }
+    /* 마지막 페이지는 다음 명령이나 w25qxx_sync() 에서 기다린다 */
+    flash->stats.writecycles += W25QXX_TIMESTAMP() - start;
+    return W25QXX_RES_OK;
+}
+
+W25QXX_Res_t w25qxx_erase(W25QXX_t* flash, uint32_t addr, uint32_t len)
+{
+    W25QXX_Res_t res;
+
+    if (flash->size == 0)
+        return W25QXX_RES_NODEV;
+    if (len == 0 || addr >= flash->size || len > flash->size - addr
+            || (addr | len) & (W25QXX_SECTOR_SIZE - 1))
+        return W25QXX_RES_PARAM;
+    if ((res = w25qxx_sync(flash)) != W25QXX_RES_OK)
+        return res;
+
+    w25qxx_invalidate(flash, addr, len);
+    flash->eraseaddr = addr;
+    flash->eraseend = addr + len;
+    if (w25qxx_erase_next(flash) < 0) {
+        flash->eraseaddr = flash->eraseend;
+        return W25QXX_RES_ERR;
+    }
+    return W25QXX_RES_OK;
+}
+
+W25QXX_Res_t w25qxx_poll(W25QXX_t* flash)
+{
+    if (flash->busy) {
+        if (w25qxx_status(flash) & SR_BUSY) {
+            flash->stats.polls++;
+            if (HAL_GetTick() - flash->started < flash->timeout)
+                return W25QXX_RES_BUSY;
+            flash->busy = BUSY_NONE;
+            flash->eraseaddr = flash->eraseend;
+            return W25QXX_RES_TIMEOUT;
+        }
+        flash->busy = BUSY_NONE;
+    }
+    if (flash->eraseaddr < flash->eraseend) {
+        if (w25qxx_erase_next(flash) < 0) {
+            flash->eraseaddr = flash->eraseend;
+            return W25QXX_RES_ERR;
+        }
+        return W25QXX_RES_BUSY;
+    }
+    return W25QXX_RES_OK;
+}
+
+W25QXX_Res_t w25qxx_sync(W25QXX_t* flash)
+{
+    uint32_t start = W25QXX_TIMESTAMP();
+    uint8_t program = (flash->busy == BUSY_PROGRAM);
+    W25QXX_Res_t res = W25QXX_RES_OK;
+
+    for (;;) {
+        if (w25qxx_wait_ready(flash) < 0) {
+            res = W25QXX_RES_TIMEOUT;
+            break;
+        }
+        if (flash->eraseaddr >= flash->eraseend)
+            break;
+        if (w25qxx_erase_next(flash) < 0) {
+            res = W25QXX_RES_ERR;
+            break;
+        }
+    }
+    if (res != W25QXX_RES_OK)
+        flash->eraseaddr = flash->eraseend;
+    /* write-behind 로 남은 프로그램 시간은 쓰기 속도에 넣는다 */
+    if (program)
+        flash->stats.writecycles += W25QXX_TIMESTAMP() - start;
+    return res;
+}
+
+void w25qxx_flush(W25QXX_t* flash)
+{
+    memset(flash->tag, 0, sizeof(flash->tag));
+}
+
+uint32_t w25qxx_read_rate(const W25QXX_t* flash)
+{
+    if (flash->stats.readcycles == 0)
+        return 0;
+    return (uint32_t)((uint64_t)flash->stats.readbytes * SystemCoreClock / flash->stats.readcycles);
+}
+
+uint32_t w25qxx_write_rate(const W25QXX_t* flash)
+{
+    if (flash->stats.writecycles == 0)
+        return 0;
+    return (uint32_t)((uint64_t)flash->stats.writebytes * SystemCoreClock / flash->stats.writecycles);
+}
+
+int w25qxx_store_read(void* ctx, uint32_t addr, uint8_t* buf, uint32_t len)
+{
+    return (w25qxx_read((W25QXX_t *)ctx, addr, buf, len) == W25QXX_RES_OK) ? 1 : -1;
+}
+
+/* 같은 버스의 다른 장치가 바꾼 설정을 되돌린 후 CS 를 내린다 */
+static void w25qxx_select(W25QXX_t* flash)
+{
+    spi_set_profile(flash->bus, &flash->profile);
+    spi_select(flash->bus, flash->cs);
+}
+
+static void w25qxx_deselect(W25QXX_t* flash)
+{
+    spi_deselect(flash->bus, flash->cs);
+}
+
+/* 명령, 주소와 더미 바이트를 한 번에 보낸다 */
+static void w25qxx_command(W25QXX_t* flash, uint8_t cmd, uint32_t addr, int dummy)
+{
+    uint8_t frame[6];
+    int n = 0;
+
+    frame[n++] = cmd;
+    if (flash->addrlen == 4)
+        frame[n++] = (uint8_t)(addr >> 24);
+    frame[n++] = (uint8_t)(addr >> 16);
+    frame[n++] = (uint8_t)(addr >> 8);
+    frame[n++] = (uint8_t)addr;
+    if (dummy)
+        frame[n++] = 0xFF;
+    spi_nwrite(flash->bus, frame, n);
+}
+
+/* 데이터를 주고 받는다. 긴 데이터는 가능하면 DMA 를 사용한다 */
+static int w25qxx_transfer(W25QXX_t* flash, const uint8_t* tx, uint8_t* rx, uint32_t length)
+{
+#if W25QXX_DMA
+    SPI_Async_t xfer;
+    uint32_t n, timeout;
+
+    if (flash->dma && length >= W25QXX_DMA_MIN) {
+        while (length) {
+            n = (length > 0x8000) ? 0x8000 : length;
+            memset(&xfer, 0, sizeof(SPI_Async_t));
+            xfer.dev = &flash->dev;
+            xfer.tx = tx;
+            xfer.rx = rx;
+            xfer.length = n;
+            /* 한 조각은 느린 SCK 에서 수백 ms 가 걸릴 수 있으므로 길이와 주파수로 기다릴 시간을 정한다 */
+            timeout = (uint32_t)((uint64_t)n * 8 * 1000 / flash->hz) + W25QXX_DMA_MARGIN;
+            if (spi_async_submit(&xfer) < 0)
+                return -1;
+            if (spi_async_wait(&xfer, timeout) < 0) {
+                /* 스택의 기술자가 큐에 남지 않도록 DMA 를 멈추고 뺀다 */
+                spi_async_cancel(&xfer);
+                return -1;
+            }
+            if (tx != NULL)
+                tx += n;
+            if (rx != NULL)
+                rx += n;
+            length -= n;
+        }
+        return 1;
+    }
+#endif
+    if (rx != NULL)
+        return spi_nread(flash->bus, rx, length, 0xFF);
+    spi_nwrite(flash->bus, tx, length);
+    return 1;
+}
+
+static uint8_t w25qxx_status(W25QXX_t* flash)
+{
+    uint8_t sr;
+
+    w25qxx_select(flash);
+    spi_writeread(flash->bus, CMD_READ_STATUS1);
+    sr = spi_writeread(flash->bus, 0xFF);
+    w25qxx_deselect(flash);
+    return sr;
+}
+
+static void w25qxx_start(W25QXX_t* flash, uint8_t busy, uint32_t timeout)
+{
+    flash->busy = busy;
+    flash->started = HAL_GetTick();
+    flash->timeout = timeout;
+}
+
+/* CS 를 내린 채로 상태 레지스터를 계속 읽으며 진행 중인 동작이 끝나기를 기다린다 */
+static int w25qxx_wait_ready(W25QXX_t* flash)
+{
+    int res = 1;
+
+    if (flash->busy == BUSY_NONE)
+        return 1;
+    w25qxx_select(flash);
+    spi_writeread(flash->bus, CMD_READ_STATUS1);
+    while (spi_writeread(flash->bus, 0xFF) & SR_BUSY) {
+        flash->stats.polls++;
+        if (HAL_GetTick() - flash->started >= flash->timeout) {
+            res = -1;
+            break;
+        }
+    }
+    w25qxx_deselect(flash);
+    flash->busy = BUSY_NONE;
+    return res;
+}
+
+/* 쓰기를 허용하고, 칩이 받아들였는지 확인한다 */
+static int w25qxx_write_enable(W25QXX_t* flash)
+{
+    w25qxx_select(flash);
+    spi_writeread(flash->bus, CMD_WRITE_ENABLE);
+    w25qxx_deselect(flash);
+    return (w25qxx_status(flash) & SR_WEL) ? 1 : -1;
+}
+
+/* 예약된 범위에서 주소 정렬이 허용하는 가장 큰 지우기 명령을 보낸다 */
+static int w25qxx_erase_next(W25QXX_t* flash)
+{
+    uint32_t addr = flash->eraseaddr;
+    uint32_t remain = flash->eraseend - addr;
+    uint32_t step, timeout;
+    uint8_t cmd;
+
+    if (addr == 0 && remain == flash->size) {
+        cmd = CMD_CHIP_ERASE;
+        step = remain;
+        timeout = W25QXX_CHIP_TIMEOUT;
+    } else if (!(addr & 0xFFFF) && remain >= 0x10000) {
+        cmd = (flash->addrlen == 4) ? CMD_BLOCK64_ERASE_4B : CMD_BLOCK64_ERASE;
+        step = 0x10000;
+        timeout = W25QXX_BLOCK64_TIMEOUT;
+    } else if (flash->addrlen == 3 && !(addr & 0x7FFF) && remain >= 0x8000) {
+        /* 32KB 지우기는 4 바이트 주소 명령이 없다 */
+        cmd = CMD_BLOCK32_ERASE;
+        step = 0x8000;
+        timeout = W25QXX_BLOCK32_TIMEOUT;
+    } else {
+        cmd = (flash->addrlen == 4) ? CMD_SECTOR_ERASE_4B : CMD_SECTOR_ERASE;
+        step = W25QXX_SECTOR_SIZE;
+        timeout = W25QXX_SECTOR_TIMEOUT;
+    }
+
+    if (w25qxx_write_enable(flash) < 0)
+        return -1;
+    w25qxx_select(flash);
+    if (cmd == CMD_CHIP_ERASE)
+        spi_writeread(flash->bus, cmd);
+    else
+        w25qxx_command(flash, cmd, addr, 0);
+    w25qxx_deselect(flash);
+    w25qxx_start(flash, BUSY_ERASE, timeout);
+
+    flash->eraseaddr += step;
+    flash->stats.erases++;
+    return 1;
+}
+
+static int w25qxx_read_raw(W25QXX_t* flash, uint32_t addr, uint8_t* data, uint32_t len)
+{
+    int res;
+
+    w25qxx_select(flash);
+    w25qxx_command(flash, (flash->addrlen == 4) ? CMD_FAST_READ_4B : CMD_FAST_READ, addr, 1);
+    res = w25qxx_transfer(flash, NULL, data, len);
+    w25qxx_deselect(flash);
+    return res;
+}
+
+static int w25qxx_cache_find(W25QXX_t* flash, uint32_t line)
+{
+    int i;
+
+    for (i = 0; i < W25QXX_CACHE_LINES; i++) {
+        if (flash->tag[i] == line + 1)
+            return i;
+    }
+    return -1;
+}
+
+/* 빈 라인이나 가장 오래 사용되지 않은 라인 */
+static int w25qxx_cache_victim(W25QXX_t* flash)
+{
+    int i, victim = 0;
+
+    for (i = 0; i < W25QXX_CACHE_LINES; i++) {
+        if (flash->tag[i] == 0)
+            return i;
+        if ((int32_t)(flash->age[i] - flash->age[victim]) < 0)
+            victim = i;
+    }
+    return victim;
+}
+
+/* 쓰거나 지운 범위에 걸친 캐시 라인을 버린다 */
+static void w25qxx_invalidate(W25QXX_t* flash, uint32_t addr, uint32_t len)
+{
+    uint32_t first = addr / W25QXX_CACHE_LINE;
+    uint32_t last = (addr + len - 1) / W25QXX_CACHE_LINE;
+    int i;
+
+    for (i = 0; i < W25QXX_CACHE_LINES; i++) {
+        if (flash->tag[i] && flash->tag[i] - 1 >= first && flash->tag[i] - 1 <= last)
+            flash->tag[i] = 0;
+    }
+}
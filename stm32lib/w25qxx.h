@@ -0,0 +1,352 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+#ifndef W25QXX_H
+#define W25QXX_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup stm32lib
+ * @{
+ */
+
+/**
+ * @defgroup W25QXX
+ * @brief    W25Qxx SPI NOR 플래시 드라이버
+ * @{
+ *
+ * 폰트, 로그, 설정 값 등을 보관하는 W25Qxx 계열(및 호환) SPI NOR 플래시를 사용한다.
+ * JEDEC ID 로 용량을 알아내며, 16MB 를 넘는 칩은 4 바이트 주소 명령을 사용한다.
+ *  - 읽기는 Fast Read(0x0B) 명령을 사용하며, 긴 데이터는 @ref SPIASYNC 의 DMA 로 받는다
+ *  - 페이지 쓰기는 앞 페이지를 프로그램하는 동안 다음 페이지를 준비하고,
+ *    마지막 페이지는 기다리지 않고 돌아온다(write-behind). 다음 명령이 필요할 때 끝나기를 기다린다
+ *  - 지우기는 범위를 예약해 두고, 주소 정렬에 따라 64KB/32KB/4KB 블록 또는 칩 전체 지우기를
+ *    골라 하나씩 내보낸다. @ref w25qxx_poll() 을 주기적으로 부르면 기다리지 않고 진행할 수 있다
+ *  - 작은 임의 읽기는 @ref w25qxx_read_cached() 로 LRU 라인 캐시를 거쳐 읽는다
+ *
+ * STM32F4 의 SPI 는 MISO 가 하나뿐이므로 Dual/Quad 출력 읽기는 지원하지 않는다.
+ * 이들이 필요하면 QUADSPI 가 있는 칩에서 메모리 맵 모드와 @ref fontstore_memread() 를 사용한다.
+ *
+ * \par 사용 예
+ *
+\code
+static W25QXX_t flash;
+static FontStore_t store;
+
+spi_init(SPI_1, SPI1_PINS1);
+if (w25qxx_init(&flash, SPI_1, GPIO_PA_4) == W25QXX_RES_OK) {
+    w25qxx_erase(&flash, 0x10000, 0x1000);
+    w25qxx_write(&flash, 0x10000, config, sizeof(config));
+    w25qxx_sync(&flash);
+    //폰트 캐시의 저장장치로 사용
+    fontstore_init(&store, w25qxx_store_read, &flash, flash.size, cache, 256, 8, 1);
+}
+\endcode
+ *
+ * \par Changelog
+ *
+\verbatim
+ 버전 1.0
+  - 최초 배포
+\endverbatim
+ *
+ * \par 의존성
+ *
+\verbatim
+ - STM32F4xx HAL
+ - SPI
+ - SPIASYNC (W25QXX_DMA 가 1 일 때)
+ - GPIO
+\endverbatim
+ */
+#include "stm32f4xx_hal.h"
+#include "../stm32lib/spi.h"
+#include "../stm32lib/gpio.h"
+
+/**
+ * @defgroup W25QXX_매크로
+ * @brief    W25QXX 매크로
+ * @{
+ */
+
+/**
+ * @brief  긴 읽기/쓰기 데이터를 DMA 로 전송한다. 0 이면 @ref spi_nread()/@ref spi_nwrite() 를 사용한다
+ */
+#ifndef W25QXX_DMA
+#define W25QXX_DMA              1
+#endif
+
+#if W25QXX_DMA
+#include "../stm32lib/spiasync.h"
+#endif
+
+/**
+ * @brief  이 바이트 수 이상의 데이터만 DMA 로 전송한다
+ */
+#ifndef W25QXX_DMA_MIN
+#define W25QXX_DMA_MIN          32
+#endif
+
+/**
+ * @brief  최대 SCK 주파수
+ */
+#ifndef W25QXX_FREQUENCY
+#define W25QXX_FREQUENCY        50000000
+#endif
+
+/**
+ * @brief  읽기 캐시의 라인 수
+ */
+#ifndef W25QXX_CACHE_LINES
+#define W25QXX_CACHE_LINES      8
+#endif
+
+/**
+ * @brief  읽기 캐시 한 라인의 바이트 수. 2 의 거듭제곱
+ */
+#ifndef W25QXX_CACHE_LINE
+#define W25QXX_CACHE_LINE       32
+#endif
+
+/**
+ * @brief  전송 속도 측정에 사용하는 사이클 카운터
+ */
+#ifndef W25QXX_TIMESTAMP
+#define W25QXX_TIMESTAMP()      (DWT->CYCCNT)
+#endif
+
+/**
+ * @brief  페이지 크기. 한 번의 프로그램 명령으로 쓸 수 있는 최대 바이트 수
+ */
+#define W25QXX_PAGE_SIZE        256
+
+/**
+ * @brief  섹터 크기. 지울 수 있는 가장 작은 단위
+ */
+#define W25QXX_SECTOR_SIZE      4096
+
+/**
+ * @brief  읽기 캐시 적중률(%)
+ */
+#define W25QXX_HITRATE(stats)   \
+    (((stats)->hits + (stats)->misses) ? (stats)->hits * 100 / ((stats)->hits + (stats)->misses) : 0)
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup W25QXX_자료형
+ * @brief    W25QXX 자료형
+ * @{
+ */
+
+/**
+ * @brief  결과 열거형
+ */
+typedef enum {
+    W25QXX_RES_OK = 0x00,   /*!< 정상 */
+    W25QXX_RES_ERR,         /*!< 쓰기 보호 등으로 칩이 명령을 받아들이지 않음 */
+    W25QXX_RES_TIMEOUT,     /*!< 프로그램이나 지우기가 제 시간에 끝나지 않음 */
+    W25QXX_RES_NODEV,       /*!< 칩이 없거나 JEDEC ID 를 알 수 없음 */
+    W25QXX_RES_PARAM,       /*!< 잘못된 인자 (범위를 벗어난 주소, 정렬되지 않은 지우기 등) */
+    W25QXX_RES_BUSY,        /*!< 프로그램이나 지우기가 진행 중 (@ref w25qxx_poll()) */
+} W25QXX_Res_t;
+
+/**
+ * @brief  통계 구조체
+ */
+typedef struct {
+    uint32_t readbytes;     /*!< 플래시에서 읽은 바이트 수 */
+    uint32_t writebytes;    /*!< 프로그램한 바이트 수 */
+    uint32_t pages;         /*!< 프로그램 명령 수 */
+    uint32_t erases;        /*!< 지우기 명령 수 */
+    uint32_t polls;         /*!< 칩이 바쁠 때 읽은 상태 레지스터 수 */
+    uint32_t hits;          /*!< 읽기 캐시에서 찾은 라인 수 */
+    uint32_t misses;        /*!< 읽기 캐시에 없어 플래시에서 읽은 라인 수 */
+    uint64_t readcycles;    /*!< 읽기에 걸린 사이클 수의 합 */
+    uint64_t writecycles;   /*!< 쓰기와 프로그램 완료 대기에 걸린 사이클 수의 합 */
+} W25QXX_Stats_t;
+
+/**
+ * @brief  플래시 구조체
+ */
+typedef struct {
+    SPI_t bus;              /*!< SPI 번호 */
+    GPIO_Pin_t cs;          /*!< CS 핀 */
+    uint8_t jedec[3];       /*!< 제조사 ID, 메모리 종류, 용량 */
+    uint8_t addrlen;        /*!< 주소 바이트 수, 3 또는 4 */
+    uint32_t size;          /*!< 전체 바이트 수 */
+    uint32_t hz;            /*!< 실제 SCK 주파수 */
+    SPI_Profile_t profile;  /*!< 버스 설정. 내부용 */
+#if W25QXX_DMA
+    SPI_Device_t dev;       /*!< DMA 전송에 사용하는 장치. 내부용 */
+    uint8_t dma;            /*!< DMA 를 사용할 수 있으면 1 */
+#endif
+    uint8_t busy;           /*!< 진행 중인 동작. 0: 없음, 1: 프로그램, 2: 지우기. 내부용 */
+    uint32_t started;       /*!< 진행 중인 동작을 시작한 시각(ms). 내부용 */
+    uint32_t timeout;       /*!< 진행 중인 동작의 최대 시간(ms). 내부용 */
+    uint32_t eraseaddr;     /*!< 예약된 지우기 범위의 시작. 내부용 */
+    uint32_t eraseend;      /*!< 예약된 지우기 범위의 끝. 내부용 */
+    uint8_t page[W25QXX_PAGE_SIZE]; /*!< 다음에 프로그램할 페이지. 내부용 */
+    uint32_t tag[W25QXX_CACHE_LINES]; /*!< 각 캐시 라인의 라인 번호 + 1, 0 은 빈 라인. 내부용 */
+    uint32_t age[W25QXX_CACHE_LINES]; /*!< 각 캐시 라인의 마지막 사용 시점. 내부용 */
+    uint32_t clock;         /*!< 사용 시점 카운터. 내부용 */
+    uint8_t cache[W25QXX_CACHE_LINES][W25QXX_CACHE_LINE]; /*!< 캐시 메모리. 내부용 */
+    W25QXX_Stats_t stats;   /*!< 통계 */
+} W25QXX_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup W25QXX_함수
+ * @brief    W25QXX 함수
+ * @{
+ */
+
+/**
+ * @brief  플래시를 초기화한다
+ * @note   SPI 버스는 @ref spi_init() 으로 먼저 초기화되어 있어야 한다
+ * @param  *flash: 초기화할 @ref W25QXX_t 구조체의 포인터
+ * @param  SPI_Num: 플래시가 연결된 SPI 번호
+ * @param  cs: CS 핀
+ * @retval @ref W25QXX_Res_t
+ */
+W25QXX_Res_t w25qxx_init(W25QXX_t* flash, SPI_t SPI_Num, GPIO_Pin_t cs);
+
+/**
+ * @brief  플래시에서 데이터를 읽는다
+ * @note   읽기 캐시를 거치지 않는다. 진행 중인 쓰기나 지우기가 있으면 끝나기를 기다린다
+ * @param  *flash: 사용할 @ref W25QXX_t 구조체의 포인터
+ * @param  addr: 읽을 주소
+ * @param  *data: 읽은 데이터를 저장할 버퍼
+ * @param  len: 읽을 바이트 수
+ * @retval @ref W25QXX_Res_t
+ */
+W25QXX_Res_t w25qxx_read(W25QXX_t* flash, uint32_t addr, void* data, uint32_t len);
+
+/**
+ * @brief  읽기 캐시를 통해 플래시에서 데이터를 읽는다
+ * @note   캐시에 없는 라인 중 요청이 라인 전체를 덮는 것은 캐시에 넣지 않고 바로 읽는다
+ * @param  *flash: 사용할 @ref W25QXX_t 구조체의 포인터
+ * @param  addr: 읽을 주소
+ * @param  *data: 읽은 데이터를 저장할 버퍼
+ * @param  len: 읽을 바이트 수
+ * @retval @ref W25QXX_Res_t
+ */
+W25QXX_Res_t w25qxx_read_cached(W25QXX_t* flash, uint32_t addr, void* data, uint32_t len);
+
+/**
+ * @brief  플래시에 데이터를 쓴다
+ * @note   쓸 영역은 미리 지워져 있어야 한다. 마지막 페이지의 프로그램이 끝나기 전에 돌아오며,
+ *         data 는 돌아온 후 바로 다시 사용할 수 있다
+ * @param  *flash: 사용할 @ref W25QXX_t 구조체의 포인터
+ * @param  addr: 쓸 주소. 페이지 경계에 맞추지 않아도 된다
+ * @param  *data: 쓸 데이터
+ * @param  len: 쓸 바이트 수
+ * @retval @ref W25QXX_Res_t
+ */
+W25QXX_Res_t w25qxx_write(W25QXX_t* flash, uint32_t addr, const void* data, uint32_t len);
+
+/**
+ * @brief  지울 범위를 예약하고 첫 지우기 명령을 보낸다
+ * @note   나머지는 @ref w25qxx_poll() 이나 @ref w25qxx_sync() 가 차례로 보낸다
+ * @param  *flash: 사용할 @ref W25QXX_t 구조체의 포인터
+ * @param  addr: 지울 주소. @ref W25QXX_SECTOR_SIZE 의 배수
+ * @param  len: 지울 바이트 수. @ref W25QXX_SECTOR_SIZE 의 배수
+ * @retval @ref W25QXX_Res_t
+ */
+W25QXX_Res_t w25qxx_erase(W25QXX_t* flash, uint32_t addr, uint32_t len);
+
+/**
+ * @brief  기다리지 않고 진행 중인 동작을 확인하며, 칩이 쉬고 있으면 예약된 다음 지우기를 보낸다
+ * @param  *flash: 사용할 @ref W25QXX_t 구조체의 포인터
+ * @retval W25QXX_RES_OK: 모든 동작이 끝남, W25QXX_RES_BUSY: 진행 중, 그 밖의 값: 오류
+ */
+W25QXX_Res_t w25qxx_poll(W25QXX_t* flash);
+
+/**
+ * @brief  진행 중인 프로그램과 예약된 지우기가 모두 끝날 때까지 기다린다
+ * @param  *flash: 사용할 @ref W25QXX_t 구조체의 포인터
+ * @retval @ref W25QXX_Res_t
+ */
+W25QXX_Res_t w25qxx_sync(W25QXX_t* flash);
+
+/**
+ * @brief  읽기 캐시를 비운다
+ * @note   이 드라이버가 쓰거나 지운 영역은 자동으로 캐시에서 지워지므로, 다른 방법으로 플래시를 바꾼 경우에만 호출한다
+ * @param  *flash: 사용할 @ref W25QXX_t 구조체의 포인터
+ * @retval 없음
+ */
+void w25qxx_flush(W25QXX_t* flash);
+
+/**
+ * @brief  평균 읽기 속도를 구한다
+ * @param  *flash: 사용할 @ref W25QXX_t 구조체의 포인터
+ * @retval 초당 바이트 수. 읽은 적이 없으면 0
+ */
+uint32_t w25qxx_read_rate(const W25QXX_t* flash);
+
+/**
+ * @brief  평균 쓰기 속도를 구한다
+ * @note   프로그램이 끝나기를 기다린 시간을 포함한 지속 속도이다
+ * @param  *flash: 사용할 @ref W25QXX_t 구조체의 포인터
+ * @retval 초당 바이트 수. 쓴 적이 없으면 0
+ */
+uint32_t w25qxx_write_rate(const W25QXX_t* flash);
+
+/**
+ * @brief  @ref FONTSTORE 의 저장장치 읽기 함수
+ * @note   ctx 에 @ref W25QXX_t 구조체의 포인터를 넘겨준다. FONTSTORE 가 캐시를 가지므로 읽기 캐시를 거치지 않는다
+ * @retval 1: 정상, -1: 오류
+ */
+int w25qxx_store_read(void* ctx, uint32_t addr, uint8_t* buf, uint32_t len);
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,167 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+/*
+ * FONTSTORE 호스트 시험
+ *
+ * CombineFont_16x16 으로 조합한 한글 11172 자를 폰트 파일로 만든 뒤,
+ * FONTSTORE_FILE 의 표준 입출력 읽기 함수로 다시 읽어서 다음을 확인한다.
+ *   - 파일에서 읽은 글자가 조합한 글자와 같은지
+ *   - 저장장치 밖을 읽지 않는지 (마지막 블록, 미리 읽기, 범위를 넘는 요청)
+ *   - fontstore_memread() 가 영역을 넘는 요청을 거절하는지
+ * 마지막에 문장을 세 번 그릴 때의 캐시 통계를 출력한다. 실패하면 0 이 아닌 값으로 끝난다.
+ *
+ * 사용법:
+ *   cc -I tools/host -DFONTSTORE_FILE_STDIO=1 -DFONTSTORE_TIMESTAMP=host_cycles \
+ *      -o fontstoretest tools/fontstoretest.c stm32lib/fontstore.c stm32lib/fontstore_file.c \
+ *      stm32lib/font.c stm32lib/hangulfont.c stm32lib/pagefont.c stm32lib/combine_font_16.c tools/host/host.c
+ *   ./fontstoretest [폰트 파일]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../stm32lib/fontstore_file.h"
+#include "../stm32lib/hangulfont.h"
+
+#define GLYPH_SIZE  32
+#define NGLYPHS     (0xD7A3 - 0xAC00 + 1)
+
+/* 파일 읽기 함수를 감싸서 저장장치 밖을 읽는지 센다 */
+typedef struct {
+    FILE *fp;
+    uint32_t size;
+    uint32_t reads;
+    uint32_t outside;
+} Probe_t;
+
+static int probe_read(void *ctx, uint32_t addr, uint8_t *buf, uint32_t len)
+{
+    Probe_t *probe = (Probe_t *)ctx;
+
+    probe->reads++;
+    if (addr + len > probe->size)
+        probe->outside++;
+    return fontstore_fileread(probe->fp, addr, buf, len);
+}
+
+static int failures;
+
+static void check(int ok, const char *what)
+{
+    printf("%-44s %s\n", what, ok ? "ok" : "FAIL");
+    if (!ok)
+        failures++;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *path = (argc > 1) ? argv[1] : "fontstoretest.bin";
+    static uint8_t cache[8 * 256];
+    static FontStore_t store;
+    static StoreFont_t hangul_data = {&store, 0};
+    Font_t hangul = {STORE_FONT, 16, 16, 0xAC00, 0xD7A3, {.store = &hangul_data}};
+    const char *text = "가나다라마바사아자차카타파하 안녕하세요 한글 폰트 캐시 시험입니다";
+    FontGlyph_t a, b;
+    FontStoreStats_t stats;
+    Probe_t probe;
+    uint8_t buf[8];
+    uint32_t ch;
+    int r, mismatch = 0;
+    FILE *fp;
+
+    /* 조합한 글자로 폰트 파일을 만든다 */
+    if ((fp = fopen(path, "wb")) == NULL) {
+        perror(path);
+        return 1;
+    }
+    for (ch = 0xAC00; ch <= 0xD7A3; ch++)
+        fwrite(get_hangul_glyph(ch, &CombineFont_16x16), 1, GLYPH_SIZE, fp);
+    fclose(fp);
+
+    if ((fp = fopen(path, "rb")) == NULL) {
+        perror(path);
+        return 1;
+    }
+    memset(&probe, 0, sizeof(probe));
+    probe.fp = fp;
+    probe.size = fontstore_filesize(fp);
+    check(probe.size == NGLYPHS * GLYPH_SIZE, "fontstore_filesize");
+    /* 파일 크기가 블록 크기의 배수가 아니므로 마지막 블록은 일부만 읽는다 */
+    check(fontstore_init(&store, probe_read, &probe, probe.size, cache, 240, 8, 3) > 0, "fontstore_init");
+
+    for (ch = 0xAC00; ch <= 0xD7A3; ch++) {
+        font_getglyph(&CombineFont_16x16, ch, &a);
+        font_getglyph(&hangul, ch, &b);
+        if (memcmp(&a, &b, sizeof(a)) != 0)
+            mismatch++;
+    }
+    check(mismatch == 0, "file glyphs match combined glyphs");
+    check(probe.outside == 0, "no read past the end of the file");
+    check(fontstore_read(&store, probe.size - 4, buf, 4) > 0, "read the last 4 bytes");
+    check(fontstore_read(&store, probe.size - 2, buf, 4) < 0, "reject a read crossing the end");
+    check(fontstore_read(&store, probe.size + 1000, buf, 4) < 0, "reject a read past the end");
+    check(fontstore_read(&store, 0xFFFFFFF0, buf, 0x20) < 0, "reject a wrapping read");
+    check(probe.outside == 0, "still no read past the end");
+
+    /* 문장을 세 번 그릴 때의 캐시 통계 */
+    fontstore_flush(&store);
+    fontstore_resetstats(&store);
+    for (r = 0; r < 3; r++) {
+        char *p = (char *)text;
+        uint16_t u;
+
+        while ((u = font_getutf16(&p)) != 0)
+            if (u >= 0xAC00)
+                font_getglyph(&hangul, u, &b);
+    }
+    fontstore_getstats(&store, &stats);
+    printf("hits %lu misses %lu readaheads %lu errors %lu bytes %lu hitrate %lu%%\n",
+           (unsigned long)stats.hits, (unsigned long)stats.misses, (unsigned long)stats.readaheads,
+           (unsigned long)stats.errors, (unsigned long)stats.bytes, (unsigned long)FONTSTORE_HITRATE(&stats));
+    fclose(fp);
+
+    /* 메모리 맵 영역 */
+    {
+        static uint8_t blob[64];
+        static uint8_t memcache[4 * 16];
+        FontStoreMem_t mem = {blob, 50};
+        FontStore_t m;
+        int i;
+
+        for (i = 0; i < 64; i++)
+            blob[i] = i;
+        check(fontstore_init(&m, fontstore_memread, &mem, mem.size, memcache, 16, 4, 2) > 0, "memread: init");
+        check(fontstore_read(&m, 14, buf, 4) > 0 && buf[0] == 14 && buf[3] == 17, "memread: read across blocks");
+        check(fontstore_read(&m, 46, buf, 4) > 0 && buf[3] == 49, "memread: read the partial last block");
+        check(fontstore_read(&m, 48, buf, 4) < 0, "memread: reject a read past the area");
+        check(fontstore_memread(&mem, 48, buf, 4) < 0, "memread: bound direct reads");
+    }
+
+    remove(path);
+    printf("%s\n", failures ? "FAILED" : "PASSED");
+    return failures ? 1 : 0;
+}
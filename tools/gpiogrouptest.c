@@ -0,0 +1,159 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+/*
+ * GPIO 핀 묶음 호스트 시험
+ *
+ * 흉내 낸 포트 레지스터에 BSRR 쓰기를 ODR 로 반영하여 다음을 확인한다.
+ *   - 다른 포트의 핀이나 중복된 핀으로는 묶음을 만들지 않는지
+ *   - 이어진 핀은 shift 로, 흩어진 핀은 표로 값을 바꾸는지
+ *   - write 가 묶인 핀 모두를 한 번의 BSRR 쓰기로 바꾸고 다른 핀은 건드리지 않는지
+ *   - set, clear, toggle, read 가 값의 비트와 핀을 맞게 잇는지
+ * 끝으로 4 비트 버스를 핀마다 gpio_write() 로 쓸 때와 gpio_group_write() 로 쓸 때의
+ * 호스트 속도를 참고로 출력한다.
+ * 실패하면 0 이 아닌 값으로 끝난다.
+ *
+ * 사용법:
+ *   cc -O2 -I tools/host -o gpiogrouptest tools/gpiogrouptest.c stm32lib/gpio.c tools/host/host.c
+ *   ./gpiogrouptest
+ */
+#include <stdio.h>
+#include <time.h>
+#include "../stm32lib/gpio.h"
+
+static int failed;
+
+static void check(int ok, const char* what)
+{
+    printf("%-44s %s\n", what, ok ? "ok" : "FAIL");
+    if (!ok)
+        failed = 1;
+}
+
+/* 마지막 BSRR 쓰기를 ODR 에 반영하고 입력도 출력과 같게 둔다 */
+static void apply(GPIO_TypeDef* port)
+{
+    uint32_t bsrr = port->BSRR;
+
+    port->ODR = (port->ODR & ~(bsrr >> 16)) | (bsrr & 0xFFFF);
+    port->IDR = port->ODR;
+}
+
+static double now_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+int main(void)
+{
+    static const GPIO_Pin_t bus[4] = {GPIO_PB_12, GPIO_PB_3, GPIO_PB_7, GPIO_PB_0};
+    static const GPIO_Pin_t bar[8] = {GPIO_PC_0, GPIO_PC_1, GPIO_PC_2, GPIO_PC_3,
+                                      GPIO_PC_4, GPIO_PC_5, GPIO_PC_6, GPIO_PC_7};
+    static const GPIO_Pin_t mixed[2] = {GPIO_PA_0, GPIO_PB_0};
+    static const GPIO_Pin_t twice[2] = {GPIO_PA_0, GPIO_PA_0};
+    GPIO_Group_t g, c, x;
+    int i, v, n = 2000000, bad_write = 0, bad_single = 0, bad_ops = 0, bad_bar = 0;
+    double t0, tpin, tgroup;
+    volatile uint16_t sink = 0;
+
+    check(gpio_group_init(&x, mixed, 2, GPIO_OUT) == -1 && gpio_group_init(&x, twice, 2, GPIO_OUT) == -1 &&
+          gpio_group_init(&x, bus, 0, GPIO_OUT) == -1 && gpio_group_init(&x, bus, 17, GPIO_OUT) == -1,
+          "invalid groups rejected");
+    check(gpio_group_init(&g, bus, 4, GPIO_OUT) == 1 && g.port == GPIOB && g.shift == -1 &&
+          g.mask == ((1 << 12) | (1 << 3) | (1 << 7) | (1 << 0)), "scattered pins use tables");
+    check(gpio_group_init(&c, bar, 8, GPIO_OUT) == 1 && c.port == GPIOC && c.shift == 0 && c.mask == 0x00FF,
+          "consecutive pins use a shift");
+
+    GPIOB->ODR = 0xA5A5 & ~g.mask;
+    for (v = 0; v < 16; v++) {
+        uint16_t other = GPIOB->ODR & ~g.mask, expect = 0;
+
+        for (i = 0; i < 4; i++)
+            if (v & (1 << i))
+                expect |= 1 << (bus[i] & 0xF);
+        gpio_group_write(&g, v);
+        /* 한 번의 쓰기에 묶인 핀 모두의 set 또는 reset 비트가 들어 있어야 한다 */
+        bad_single += ((GPIOB->BSRR | GPIOB->BSRR >> 16) & 0xFFFF) != g.mask || (GPIOB->BSRR & (GPIOB->BSRR >> 16));
+        apply(GPIOB);
+        bad_write += (GPIOB->ODR & g.mask) != expect || (GPIOB->ODR & ~g.mask) != other ||
+                     gpio_group_read(&g) != v;
+
+        gpio_group_toggle(&g, 0x5);
+        apply(GPIOB);
+        bad_ops += gpio_group_read(&g) != (v ^ 0x5);
+        gpio_group_clear(&g, 0xF);
+        apply(GPIOB);
+        bad_ops += (GPIOB->ODR & g.mask) != 0;
+        gpio_group_set(&g, v);
+        apply(GPIOB);
+        bad_ops += gpio_group_read(&g) != v || (GPIOB->ODR & ~g.mask) != other;
+    }
+    check(bad_single == 0, "write is one BSRR store for all pins");
+    check(bad_write == 0, "write maps bits and keeps other pins");
+    check(bad_ops == 0, "set, clear, toggle and read");
+
+    GPIOC->ODR = 0xFF00;
+    for (v = 0; v < 256; v++) {
+        gpio_group_write(&c, v);
+        apply(GPIOC);
+        bad_bar += gpio_group_read(&c) != v || GPIOC->ODR != (0xFF00U | v);
+    }
+    check(bad_bar == 0, "8-bit bar on PC0-PC7");
+
+    /* 참고용 속도. 대상 보드에서는 BSRR 쓰기 수(4 대 1)가 차이를 만든다 */
+    t0 = now_us();
+    for (i = 0; i < n; i++) {
+        v = i & 0xF;
+        gpio_write(bus[3], (v >> 3) & 1);
+        gpio_write(bus[2], (v >> 2) & 1);
+        gpio_write(bus[1], (v >> 1) & 1);
+        gpio_write(bus[0], v & 1);
+    }
+    tpin = now_us() - t0;
+    t0 = now_us();
+    for (i = 0; i < n; i++)
+        gpio_group_write(&g, i & 0xF);
+    tgroup = now_us() - t0;
+    printf("nibble write, gpio_write x4    %7.1f /us\n", n / tpin);
+    printf("nibble write, gpio_group_write %7.1f /us (%.1fx)\n", n / tgroup, tpin / tgroup);
+    t0 = now_us();
+    for (i = 0; i < n; i++)
+        sink += gpio_read(bus[0]) | gpio_read(bus[1]) << 1 | gpio_read(bus[2]) << 2 | gpio_read(bus[3]) << 3;
+    tpin = now_us() - t0;
+    t0 = now_us();
+    for (i = 0; i < n; i++)
+        sink += gpio_group_read(&g);
+    tgroup = now_us() - t0;
+    printf("nibble read, gpio_read x4      %7.1f /us\n", n / tpin);
+    printf("nibble read, gpio_group_read   %7.1f /us (%.1fx)\n", n / tgroup, tpin / tgroup);
+
+    printf("%s\n", failed ? "FAILED" : "PASSED");
+    return failed;
+}
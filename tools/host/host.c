@@ -0,0 +1,158 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+/*
+ * 호스트 시험용 HAL 함수 본체
+ *
+ * stm32f4xx_hal.h 에 선언한 HAL 함수를 아무 일도 하지 않는 약한(weak) 심볼로 정의하고,
+ * 주변장치 주소 영역(PERIPH_BASE)을 메모리로 매핑해 라이브러리가 레지스터를 읽고 쓸 수 있게 한다.
+ * 시험 프로그램은 흉내 낼 HAL 함수만 다시 정의하면 된다. Linux 에서만 동작한다.
+ */
+#include "stm32f4xx_hal.h"
+#include <sys/mman.h>
+#include <time.h>
+
+DWT_Type host_dwt;
+CoreDebug_Type host_coredebug;
+uint32_t SystemCoreClock = 84000000;
+
+/* 주변장치 레지스터 영역을 main() 전에 매핑한다 */
+__attribute__((constructor)) static void host_map_periph(void)
+{
+    if (mmap((void *)PERIPH_BASE, PERIPH_SIZE, PROT_READ | PROT_WRITE,
+             MAP_FIXED | MAP_PRIVATE | MAP_ANONYMOUS, -1, 0) == MAP_FAILED) {
+        perror("mmap PERIPH_BASE");
+    }
+}
+
+__weak uint32_t host_cycles(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * SystemCoreClock + (uint64_t)ts.tv_nsec * (SystemCoreClock / 1000000) / 1000);
+}
+
+__weak void host_spi_reset(SPI_TypeDef *SPIx)
+{
+    SPIx->CR1 = 0;
+    SPIx->CR2 = 0;
+}
+
+__weak uint32_t HAL_GetTick(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+__weak void HAL_Delay(uint32_t Delay)
+{
+    uint32_t start = HAL_GetTick();
+
+    while (HAL_GetTick() - start < Delay)
+        ;
+}
+
+/* 코어 */
+__weak void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority) {}
+__weak void HAL_NVIC_EnableIRQ(IRQn_Type IRQn) {}
+__weak void HAL_NVIC_DisableIRQ(IRQn_Type IRQn) {}
+__weak void NVIC_EnableIRQ(IRQn_Type IRQn) {}
+__weak void NVIC_DisableIRQ(IRQn_Type IRQn) {}
+__weak void NVIC_SetVector(IRQn_Type IRQn, uint32_t vector) {}
+__weak uint32_t HAL_RCC_GetHCLKFreq(void) { return SystemCoreClock; }
+__weak uint32_t HAL_RCC_GetPCLK1Freq(void) { return SystemCoreClock / 2; }
+__weak uint32_t HAL_RCC_GetPCLK2Freq(void) { return SystemCoreClock; }
+
+/* GPIO */
+__weak void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init) {}
+__weak void HAL_GPIO_DeInit(GPIO_TypeDef *GPIOx, uint32_t GPIO_Pin) {}
+__weak void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+    GPIOx->BSRR = (PinState == GPIO_PIN_SET) ? GPIO_Pin : (uint32_t)GPIO_Pin << 16;
+}
+__weak GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+    return (GPIOx->IDR & GPIO_Pin) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+}
+
+/* DMA */
+__weak HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *hdma) { return HAL_OK; }
+__weak HAL_StatusTypeDef HAL_DMA_DeInit(DMA_HandleTypeDef *hdma) { return HAL_OK; }
+__weak HAL_StatusTypeDef HAL_DMA_Abort(DMA_HandleTypeDef *hdma) { return HAL_OK; }
+__weak void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma) {}
+
+/* I2C */
+__weak HAL_StatusTypeDef HAL_I2C_Init(I2C_HandleTypeDef *hi2c) { return HAL_OK; }
+__weak HAL_StatusTypeDef HAL_I2C_DeInit(I2C_HandleTypeDef *hi2c) { return HAL_OK; }
+__weak HAL_StatusTypeDef HAL_I2C_Master_Transmit(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData, uint16_t Size, uint32_t Timeout) { return HAL_OK; }
+__weak HAL_StatusTypeDef HAL_I2C_Master_Receive(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData, uint16_t Size, uint32_t Timeout) { return HAL_OK; }
+__weak HAL_StatusTypeDef HAL_I2C_Mem_Write(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout) { return HAL_OK; }
+__weak HAL_StatusTypeDef HAL_I2C_Mem_Read(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout) { return HAL_OK; }
+__weak HAL_StatusTypeDef HAL_I2C_IsDeviceReady(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint32_t Trials, uint32_t Timeout) { return HAL_OK; }
+__weak HAL_StatusTypeDef HAL_I2C_Master_Transmit_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData, uint16_t Size) { return HAL_OK; }
+__weak HAL_StatusTypeDef HAL_I2C_Master_Receive_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData, uint16_t Size) { return HAL_OK; }
+__weak HAL_StatusTypeDef HAL_I2C_Mem_Write_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size) { return HAL_OK; }
+__weak HAL_StatusTypeDef HAL_I2C_Mem_Read_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size) { return HAL_OK; }
+__weak HAL_StatusTypeDef HAL_I2C_Master_Transmit_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData, uint16_t Size) { return HAL_OK; }
+__weak HAL_StatusTypeDef HAL_I2C_Master_Receive_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData, uint16_t Size) { return HAL_OK; }
+__weak HAL_StatusTypeDef HAL_I2C_Mem_Write_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size) { return HAL_OK; }
+__weak HAL_StatusTypeDef HAL_I2C_Mem_Read_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size) { return HAL_OK; }
+__weak HAL_StatusTypeDef HAL_I2C_Master_Sequential_Transmit_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData, uint16_t Size, uint32_t XferOptions) { return HAL_OK; }
+__weak HAL_StatusTypeDef HAL_I2C_Master_Sequential_Receive_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData, uint16_t Size, uint32_t XferOptions) { return HAL_OK; }
+__weak HAL_StatusTypeDef HAL_I2C_Slave_Seq_Transmit_IT(I2C_HandleTypeDef *hi2c, uint8_t *pData, uint16_t Size, uint32_t XferOptions) { return HAL_OK; }
+__weak HAL_StatusTypeDef HAL_I2C_Slave_Seq_Receive_IT(I2C_HandleTypeDef *hi2c, uint8_t *pData, uint16_t Size, uint32_t XferOptions) { return HAL_OK; }
+__weak HAL_StatusTypeDef HAL_I2C_Slave_Seq_Transmit_DMA(I2C_HandleTypeDef *hi2c, uint8_t *pData, uint16_t Size, uint32_t XferOptions) { return HAL_ERROR; }
+__weak HAL_StatusTypeDef HAL_I2C_Slave_Seq_Receive_DMA(I2C_HandleTypeDef *hi2c, uint8_t *pData, uint16_t Size, uint32_t XferOptions) { return HAL_ERROR; }
+__weak HAL_StatusTypeDef HAL_I2C_EnableListen_IT(I2C_HandleTypeDef *hi2c) { return HAL_OK; }
+__weak HAL_StatusTypeDef HAL_I2C_DisableListen_IT(I2C_HandleTypeDef *hi2c) { return HAL_OK; }
+__weak HAL_StatusTypeDef HAL_I2C_Master_Abort_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress) { return HAL_OK; }
+__weak void HAL_I2C_EV_IRQHandler(I2C_HandleTypeDef *hi2c) {}
+__weak void HAL_I2C_ER_IRQHandler(I2C_HandleTypeDef *hi2c) {}
+__weak HAL_I2C_StateTypeDef HAL_I2C_GetState(I2C_HandleTypeDef *hi2c) { return hi2c->State; }
+__weak uint32_t HAL_I2C_GetError(I2C_HandleTypeDef *hi2c) { return hi2c->ErrorCode; }
+__weak void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef *hi2c) {}
+__weak void HAL_I2C_MasterRxCpltCallback(I2C_HandleTypeDef *hi2c) {}
+__weak void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c) {}
+__weak void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c) {}
+__weak void HAL_I2C_SlaveTxCpltCallback(I2C_HandleTypeDef *hi2c) {}
+__weak void HAL_I2C_SlaveRxCpltCallback(I2C_HandleTypeDef *hi2c) {}
+__weak void HAL_I2C_AddrCallback(I2C_HandleTypeDef *hi2c, uint8_t TransferDirection, uint16_t AddrMatchCode) {}
+__weak void HAL_I2C_ListenCpltCallback(I2C_HandleTypeDef *hi2c) {}
+__weak void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c) {}
+__weak void HAL_I2C_AbortCpltCallback(I2C_HandleTypeDef *hi2c) {}
+
+/* SPI */
+__weak HAL_StatusTypeDef HAL_SPI_Init(SPI_HandleTypeDef *hspi) { return HAL_OK; }
+__weak HAL_StatusTypeDef HAL_SPI_DeInit(SPI_HandleTypeDef *hspi) { return HAL_OK; }
+__weak HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size) { return HAL_OK; }
+__weak HAL_StatusTypeDef HAL_SPI_Receive_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size) { return HAL_OK; }
+__weak HAL_StatusTypeDef HAL_SPI_TransmitReceive_DMA(SPI_HandleTypeDef *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size) { return HAL_OK; }
+__weak HAL_StatusTypeDef HAL_SPI_DMAStop(SPI_HandleTypeDef *hspi) { return HAL_OK; }
+__weak void HAL_SPI_IRQHandler(SPI_HandleTypeDef *hspi) {}
@@ -0,0 +1,434 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+/*
+ * 호스트 시험용 STM32F4xx HAL 대체 헤더
+ *
+ * tools/ 의 시험 프로그램이 stm32lib 의 소스를 PC 에서 컴파일할 수 있도록
+ * 라이브러리가 사용하는 HAL/CMSIS 자료형, 레지스터 구조체, 상수와 함수 선언만 흉내 낸다.
+ * 레지스터 값과 비트 위치는 라이브러리 동작을 시험하는 데 필요한 만큼만 맞춘다.
+ * 함수 본체는 tools/host/host.c 에 약한(weak) 심볼로 있으므로, 시험 프로그램이 필요한 것만 다시 정의한다.
+ *
+ * 사용법:
+ *   cc -I tools/host -o 시험 tools/시험.c stm32lib/모듈.c ... tools/host/host.c
+ */
+#ifndef HOST_STM32F4XX_HAL_H
+#define HOST_STM32F4XX_HAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define __IO                volatile
+#define __STATIC_INLINE     static inline
+#ifndef __weak
+#define __weak              __attribute__((weak))
+#endif
+#define assert_param(x)     ((void)0)
+
+typedef enum { RESET = 0, SET = !RESET } FlagStatus, ITStatus;
+typedef enum { HAL_OK = 0, HAL_ERROR, HAL_BUSY, HAL_TIMEOUT } HAL_StatusTypeDef;
+typedef enum { GPIO_PIN_RESET = 0, GPIO_PIN_SET } GPIO_PinState;
+
+/*
+ * 코어
+ */
+
+typedef int IRQn_Type;
+enum {
+    EXTI0_IRQn = 6, DMA1_Stream0_IRQn = 11, DMA1_Stream3_IRQn = 14,
+    I2C1_EV_IRQn = 31, I2C1_ER_IRQn = 32, I2C2_EV_IRQn = 33, I2C2_ER_IRQn = 34,
+    SPI1_IRQn = 35, SPI2_IRQn = 36, SPI3_IRQn = 51,
+    DMA2_Stream0_IRQn = 56, DMA2_Stream3_IRQn = 59, I2C3_EV_IRQn = 72, I2C3_ER_IRQn = 73
+};
+
+typedef struct { __IO uint32_t CTRL, CYCCNT; } DWT_Type;
+typedef struct { __IO uint32_t DEMCR; } CoreDebug_Type;
+extern DWT_Type host_dwt;
+extern CoreDebug_Type host_coredebug;
+#define DWT                         (&host_dwt)
+#define CoreDebug                   (&host_coredebug)
+#define CoreDebug_DEMCR_TRCENA_Msk  (1UL << 24)
+#define DWT_CTRL_CYCCNTENA_Msk      (1UL)
+
+/* 인터럽트는 없으므로 PRIMASK 는 아무 일도 하지 않는다 */
+static inline uint32_t __get_PRIMASK(void) { return 0; }
+static inline void __set_PRIMASK(uint32_t x) { (void)x; }
+static inline void __disable_irq(void) {}
+static inline void __enable_irq(void) {}
+static inline void __DMB(void) {}
+static inline void __NOP(void) {}
+
+extern uint32_t SystemCoreClock;
+uint32_t HAL_GetTick(void);
+void HAL_Delay(uint32_t Delay);
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority);
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn);
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn);
+void NVIC_EnableIRQ(IRQn_Type IRQn);
+void NVIC_DisableIRQ(IRQn_Type IRQn);
+void NVIC_SetVector(IRQn_Type IRQn, uint32_t vector);
+uint32_t HAL_RCC_GetHCLKFreq(void);
+uint32_t HAL_RCC_GetPCLK1Freq(void);
+uint32_t HAL_RCC_GetPCLK2Freq(void);
+
+/*
+ * 주변장치 레지스터. host.c 가 PERIPH_BASE 부터 메모리를 매핑해 둔다
+ */
+
+typedef struct { __IO uint32_t MODER, OTYPER, OSPEEDR, PUPDR, IDR, ODR, BSRR, LCKR, AFR[2]; } GPIO_TypeDef;
+typedef struct { __IO uint32_t CR1, CR2, OAR1, OAR2, DR, SR1, SR2, CCR, TRISE, FLTR; } I2C_TypeDef;
+#if defined(__cplusplus) && defined(HOST_SPI_SIM)
+/* C++ 로 컴파일하고 HOST_SPI_SIM 을 정의하면 SR/DR 읽기와 DR 쓰기가 시험 프로그램이 정의한
+   연산자로 간다. 레지스터 접근마다 SPI 모델의 시간을 진행시킬 때 쓴다 */
+struct HostSpiSR { operator uint32_t() const; };
+struct HostSpiDR { operator uint32_t() const; HostSpiDR& operator=(uint32_t value); };
+typedef struct { __IO uint32_t CR1, CR2; HostSpiSR SR; HostSpiDR DR; __IO uint32_t CRCPR, RXCRCR, TXCRCR, I2SCFGR, I2SPR; } SPI_TypeDef;
+#else
+typedef struct { __IO uint32_t CR1, CR2, SR, DR, CRCPR, RXCRCR, TXCRCR, I2SCFGR, I2SPR; } SPI_TypeDef;
+#endif
+typedef struct { __IO uint32_t CR, NDTR, PAR, M0AR, M1AR, FCR; } DMA_Stream_TypeDef;
+typedef struct { __IO uint32_t LISR, HISR, LIFCR, HIFCR; } DMA_TypeDef;
+
+#define PERIPH_BASE     0x40000000UL
+#define PERIPH_SIZE     0x30000UL
+#define SPI2_BASE       0x40003800UL
+#define SPI3_BASE       0x40003C00UL
+#define I2C1_BASE       0x40005400UL
+#define I2C2_BASE       0x40005800UL
+#define I2C3_BASE       0x40005C00UL
+#define SPI1_BASE       0x40013000UL
+#define GPIOA_BASE      0x40020000UL
+#define GPIOB_BASE      0x40020400UL
+#define GPIOC_BASE      0x40020800UL
+#define GPIOD_BASE      0x40020C00UL
+#define DMA1_BASE       0x40026000UL
+#define DMA2_BASE       0x40026400UL
+
+#define GPIOA           ((GPIO_TypeDef *)GPIOA_BASE)
+#define GPIOB           ((GPIO_TypeDef *)GPIOB_BASE)
+#define GPIOC           ((GPIO_TypeDef *)GPIOC_BASE)
+#define GPIOD           ((GPIO_TypeDef *)GPIOD_BASE)
+#define I2C1            ((I2C_TypeDef *)I2C1_BASE)
+#define I2C2            ((I2C_TypeDef *)I2C2_BASE)
+#define I2C3            ((I2C_TypeDef *)I2C3_BASE)
+#define SPI1            ((SPI_TypeDef *)SPI1_BASE)
+#define SPI2            ((SPI_TypeDef *)SPI2_BASE)
+#define SPI3            ((SPI_TypeDef *)SPI3_BASE)
+#define DMA1            ((DMA_TypeDef *)DMA1_BASE)
+#define DMA2            ((DMA_TypeDef *)DMA2_BASE)
+#define DMA1_Stream0    ((DMA_Stream_TypeDef *)(DMA1_BASE + 0x010))
+#define DMA1_Stream3    ((DMA_Stream_TypeDef *)(DMA1_BASE + 0x058))
+#define DMA1_Stream4    ((DMA_Stream_TypeDef *)(DMA1_BASE + 0x070))
+#define DMA1_Stream5    ((DMA_Stream_TypeDef *)(DMA1_BASE + 0x088))
+#define DMA2_Stream0    ((DMA_Stream_TypeDef *)(DMA2_BASE + 0x010))
+#define DMA2_Stream3    ((DMA_Stream_TypeDef *)(DMA2_BASE + 0x058))
+
+/*
+ * RCC
+ */
+
+#define __GPIOA_CLK_ENABLE()            ((void)0)
+#define __GPIOB_CLK_ENABLE()            ((void)0)
+#define __GPIOC_CLK_ENABLE()            ((void)0)
+#define __GPIOD_CLK_ENABLE()            ((void)0)
+#define __GPIOA_CLK_DISABLE()           ((void)0)
+#define __GPIOB_CLK_DISABLE()           ((void)0)
+#define __GPIOC_CLK_DISABLE()           ((void)0)
+#define __GPIOD_CLK_DISABLE()           ((void)0)
+#define __HAL_RCC_I2C1_CLK_ENABLE()     ((void)0)
+#define __HAL_RCC_I2C2_CLK_ENABLE()     ((void)0)
+#define __HAL_RCC_I2C3_CLK_ENABLE()     ((void)0)
+#define __HAL_RCC_I2C1_FORCE_RESET()    ((void)0)
+#define __HAL_RCC_I2C1_RELEASE_RESET()  ((void)0)
+#define __HAL_RCC_SPI1_CLK_ENABLE()     ((void)0)
+#define __HAL_RCC_SPI2_CLK_ENABLE()     ((void)0)
+#define __HAL_RCC_SPI3_CLK_ENABLE()     ((void)0)
+#define __HAL_RCC_SPI1_CLK_DISABLE()    ((void)0)
+#define __HAL_RCC_SPI2_CLK_DISABLE()    ((void)0)
+#define __HAL_RCC_SPI3_CLK_DISABLE()    ((void)0)
+#define __HAL_RCC_SPI1_FORCE_RESET()    host_spi_reset(SPI1)
+#define __HAL_RCC_SPI2_FORCE_RESET()    host_spi_reset(SPI2)
+#define __HAL_RCC_SPI3_FORCE_RESET()    host_spi_reset(SPI3)
+#define __HAL_RCC_SPI1_RELEASE_RESET()  ((void)0)
+#define __HAL_RCC_SPI2_RELEASE_RESET()  ((void)0)
+#define __HAL_RCC_SPI3_RELEASE_RESET()  ((void)0)
+#define __HAL_RCC_DMA1_CLK_ENABLE()     ((void)0)
+#define __HAL_RCC_DMA2_CLK_ENABLE()     ((void)0)
+
+/*
+ * GPIO
+ */
+
+typedef struct { uint32_t Pin, Mode, Pull, Speed, Alternate; } GPIO_InitTypeDef;
+
+#define GPIO_MODE_INPUT             0x00
+#define GPIO_MODE_OUTPUT_PP         0x01
+#define GPIO_MODE_AF_PP             0x02
+#define GPIO_MODE_OUTPUT_OD         0x11
+#define GPIO_MODE_AF_OD             0x12
+#define GPIO_NOPULL                 0
+#define GPIO_PULLUP                 1
+#define GPIO_SPEED_HIGH             3
+#define GPIO_SPEED_FREQ_VERY_HIGH   3
+#define GPIO_PIN_8                  0x0100
+#define GPIO_PIN_9                  0x0200
+#define GPIO_AF4_I2C1               4
+#define GPIO_AF4_I2C2               4
+#define GPIO_AF4_I2C3               4
+#define GPIO_AF5_SPI1               5
+#define GPIO_AF5_SPI2               5
+#define GPIO_AF5_SPI3               5
+#define GPIO_AF6_SPI3               6
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init);
+void HAL_GPIO_DeInit(GPIO_TypeDef *GPIOx, uint32_t GPIO_Pin);
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
+
+/*
+ * DMA
+ */
+
+typedef struct { uint32_t Channel, Direction, PeriphInc, MemInc, PeriphDataAlignment, MemDataAlignment, Mode, Priority, FIFOMode; } DMA_InitTypeDef;
+typedef struct __DMA_HandleTypeDef { DMA_Stream_TypeDef *Instance; DMA_InitTypeDef Init; void *Parent; } DMA_HandleTypeDef;
+
+#define DMA_PERIPH_TO_MEMORY        0x00
+#define DMA_MEMORY_TO_PERIPH        0x40
+#define DMA_CIRCULAR                0x100
+#define DMA_NORMAL                  0
+#define DMA_PINC_DISABLE            0
+#define DMA_MINC_ENABLE             0x400
+#define DMA_MINC_DISABLE            0
+#define DMA_PDATAALIGN_BYTE         0
+#define DMA_PDATAALIGN_HALFWORD     0x800
+#define DMA_MDATAALIGN_BYTE         0
+#define DMA_MDATAALIGN_HALFWORD     0x2000
+#define DMA_PRIORITY_HIGH           0x20000
+#define DMA_FIFOMODE_DISABLE        0
+#define DMA_SxCR_EN                 0x1U
+#define DMA_SxCR_TEIE               0x4U
+#define DMA_SxCR_TCIE               0x10U
+#define DMA_SxCR_DIR_0              0x40U
+#define DMA_SxCR_CIRC               0x100U
+#define DMA_SxCR_MINC               0x400U
+#define DMA_SxCR_PSIZE_0            0x800U
+#define DMA_SxCR_MSIZE_0            0x2000U
+#define DMA_SxCR_PL_1               0x20000U
+
+#define __HAL_DMA_GET_COUNTER(h)    ((h)->Instance->NDTR)
+#define __HAL_LINKDMA(h, f, d)      do { (h)->f = &(d); (d).Parent = (h); } while (0)
+
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *hdma);
+HAL_StatusTypeDef HAL_DMA_DeInit(DMA_HandleTypeDef *hdma);
+HAL_StatusTypeDef HAL_DMA_Abort(DMA_HandleTypeDef *hdma);
+void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma);
+
+/*
+ * I2C
+ */
+
+typedef struct { uint32_t ClockSpeed, DutyCycle, OwnAddress1, AddressingMode, DualAddressMode, OwnAddress2, GeneralCallMode, NoStretchMode, Timing; } I2C_InitTypeDef;
+typedef enum { HAL_I2C_MODE_NONE = 0, HAL_I2C_MODE_MASTER = 0x10, HAL_I2C_MODE_SLAVE = 0x20, HAL_I2C_MODE_MEM = 0x40 } HAL_I2C_ModeTypeDef;
+typedef enum { HAL_I2C_STATE_RESET = 0, HAL_I2C_STATE_READY = 0x20, HAL_I2C_STATE_BUSY = 0x24, HAL_I2C_STATE_LISTEN = 0x28 } HAL_I2C_StateTypeDef;
+typedef struct __I2C_HandleTypeDef {
+    I2C_TypeDef *Instance;
+    I2C_InitTypeDef Init;
+    uint8_t *pBuffPtr;
+    uint16_t XferSize;
+    __IO uint16_t XferCount;
+    DMA_HandleTypeDef *hdmatx, *hdmarx;
+    __IO HAL_I2C_StateTypeDef State;
+    __IO HAL_I2C_ModeTypeDef Mode;
+    __IO uint32_t ErrorCode;
+} I2C_HandleTypeDef;
+
+#define I2C_ADDRESSINGMODE_7BIT     0x4000
+#define I2C_DUALADDRESS_DISABLED    0
+#define I2C_GENERALCALL_DISABLED    0
+#define I2C_NOSTRETCH_DISABLED      0
+#define I2C_DUTYCYCLE_2             0
+#define I2C_DUTYCYCLE_16_9          0x4000
+#define I2C_CR1_PE                  0x0001
+#define I2C_CR1_ACK                 0x0400
+#define I2C_CR1_SWRST               0x8000
+#define I2C_CCR_DUTY                0x4000
+#define I2C_CCR_FS                  0x8000
+#define I2C_SR2_BUSY                0x0002
+#define I2C_MEMADD_SIZE_8BIT        1
+#define I2C_MEMADD_SIZE_16BIT       0x10
+#define HAL_I2C_ERROR_NONE          0x00
+#define HAL_I2C_ERROR_BERR          0x01
+#define HAL_I2C_ERROR_ARLO          0x02
+#define HAL_I2C_ERROR_AF            0x04
+#define HAL_I2C_ERROR_OVR           0x08
+#define HAL_I2C_ERROR_DMA           0x10
+#define HAL_I2C_ERROR_TIMEOUT       0x20
+#define I2C_FIRST_FRAME             0
+#define I2C_NEXT_FRAME              1
+#define I2C_FIRST_AND_LAST_FRAME    8
+#define I2C_LAST_FRAME              0x20
+#define I2C_DIRECTION_TRANSMIT      0
+#define I2C_DIRECTION_RECEIVE       1
+
+#define __HAL_I2C_ENABLE(h)         ((h)->Instance->CR1 |= I2C_CR1_PE)
+#define __HAL_I2C_DISABLE(h)        ((h)->Instance->CR1 &= ~I2C_CR1_PE)
+
+HAL_StatusTypeDef HAL_I2C_Init(I2C_HandleTypeDef *hi2c);
+HAL_StatusTypeDef HAL_I2C_DeInit(I2C_HandleTypeDef *hi2c);
+HAL_StatusTypeDef HAL_I2C_Master_Transmit(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_I2C_Master_Receive(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_I2C_Mem_Write(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_I2C_Mem_Read(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_I2C_IsDeviceReady(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint32_t Trials, uint32_t Timeout);
+HAL_StatusTypeDef HAL_I2C_Master_Transmit_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_I2C_Master_Receive_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_I2C_Mem_Write_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_I2C_Mem_Read_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_I2C_Master_Transmit_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_I2C_Master_Receive_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_I2C_Mem_Write_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_I2C_Mem_Read_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_I2C_Master_Sequential_Transmit_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData, uint16_t Size, uint32_t XferOptions);
+HAL_StatusTypeDef HAL_I2C_Master_Sequential_Receive_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData, uint16_t Size, uint32_t XferOptions);
+HAL_StatusTypeDef HAL_I2C_Slave_Seq_Transmit_IT(I2C_HandleTypeDef *hi2c, uint8_t *pData, uint16_t Size, uint32_t XferOptions);
+HAL_StatusTypeDef HAL_I2C_Slave_Seq_Receive_IT(I2C_HandleTypeDef *hi2c, uint8_t *pData, uint16_t Size, uint32_t XferOptions);
+HAL_StatusTypeDef HAL_I2C_Slave_Seq_Transmit_DMA(I2C_HandleTypeDef *hi2c, uint8_t *pData, uint16_t Size, uint32_t XferOptions);
+HAL_StatusTypeDef HAL_I2C_Slave_Seq_Receive_DMA(I2C_HandleTypeDef *hi2c, uint8_t *pData, uint16_t Size, uint32_t XferOptions);
+HAL_StatusTypeDef HAL_I2C_EnableListen_IT(I2C_HandleTypeDef *hi2c);
+HAL_StatusTypeDef HAL_I2C_DisableListen_IT(I2C_HandleTypeDef *hi2c);
+HAL_StatusTypeDef HAL_I2C_Master_Abort_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress);
+void HAL_I2C_EV_IRQHandler(I2C_HandleTypeDef *hi2c);
+void HAL_I2C_ER_IRQHandler(I2C_HandleTypeDef *hi2c);
+HAL_I2C_StateTypeDef HAL_I2C_GetState(I2C_HandleTypeDef *hi2c);
+uint32_t HAL_I2C_GetError(I2C_HandleTypeDef *hi2c);
+void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef *hi2c);
+void HAL_I2C_MasterRxCpltCallback(I2C_HandleTypeDef *hi2c);
+void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c);
+void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c);
+void HAL_I2C_SlaveTxCpltCallback(I2C_HandleTypeDef *hi2c);
+void HAL_I2C_SlaveRxCpltCallback(I2C_HandleTypeDef *hi2c);
+void HAL_I2C_AddrCallback(I2C_HandleTypeDef *hi2c, uint8_t TransferDirection, uint16_t AddrMatchCode);
+void HAL_I2C_ListenCpltCallback(I2C_HandleTypeDef *hi2c);
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c);
+void HAL_I2C_AbortCpltCallback(I2C_HandleTypeDef *hi2c);
+
+/*
+ * SPI
+ */
+
+typedef struct { uint32_t Mode, Direction, DataSize, CLKPolarity, CLKPhase, NSS, BaudRatePrescaler, FirstBit, TIMode, CRCCalculation, CRCPolynomial; } SPI_InitTypeDef;
+typedef enum { HAL_SPI_STATE_RESET = 0, HAL_SPI_STATE_READY = 1, HAL_SPI_STATE_BUSY = 2 } HAL_SPI_StateTypeDef;
+typedef struct __SPI_HandleTypeDef {
+    SPI_TypeDef *Instance;
+    SPI_InitTypeDef Init;
+    uint8_t *pTxBuffPtr;
+    uint16_t TxXferSize;
+    uint8_t *pRxBuffPtr;
+    DMA_HandleTypeDef *hdmatx, *hdmarx;
+    __IO HAL_SPI_StateTypeDef State;
+    __IO uint32_t ErrorCode;
+} SPI_HandleTypeDef;
+
+#define SPI_MODE_SLAVE              0
+#define SPI_MODE_MASTER             0x104
+#define SPI_DIRECTION_2LINES        0
+#define SPI_DATASIZE_8BIT           0
+#define SPI_DATASIZE_16BIT          0x800
+#define SPI_POLARITY_LOW            0
+#define SPI_POLARITY_HIGH           2
+#define SPI_PHASE_1EDGE             0
+#define SPI_PHASE_2EDGE             1
+#define SPI_NSS_HARD_INPUT          0
+#define SPI_NSS_SOFT                0x200
+#define SPI_NSS_HARD_OUTPUT         0x40000
+#define SPI_BAUDRATEPRESCALER_2     0x00
+#define SPI_BAUDRATEPRESCALER_8     0x10
+#define SPI_BAUDRATEPRESCALER_256   0x38
+#define SPI_FIRSTBIT_MSB            0
+#define SPI_TIMODE_DISABLE          0
+#define SPI_CRCCALCULATION_DISABLE  0
+#define SPI_FLAG_RXNE               0x01
+#define SPI_FLAG_TXE                0x02
+#define SPI_FLAG_OVR                0x40
+#define SPI_FLAG_BSY                0x80
+#define SPI_CR1_CPHA                0x0001
+#define SPI_CR1_CPOL                0x0002
+#define SPI_CR1_MSTR                0x0004
+#define SPI_CR1_BR_Pos              3
+#define SPI_CR1_BR                  0x0038
+#define SPI_CR1_SPE                 0x0040
+#define SPI_CR1_SSI                 0x0100
+#define SPI_CR1_SSM                 0x0200
+#define SPI_CR1_DFF                 0x0800
+#define SPI_CR2_RXDMAEN             0x01
+#define SPI_CR2_TXDMAEN             0x02
+#define SPI_CR2_SSOE                0x04
+#define SPI_SR_RXNE                 0x01
+#define SPI_SR_TXE                  0x02
+#define SPI_SR_MODF                 0x20
+#define SPI_SR_OVR                  0x40
+#define SPI_SR_BSY                  0x80
+
+#define __HAL_SPI_ENABLE(h)         ((h)->Instance->CR1 |= SPI_CR1_SPE)
+#define __HAL_SPI_DISABLE(h)        ((h)->Instance->CR1 &= ~SPI_CR1_SPE)
+#define __HAL_SPI_GET_FLAG(h, f)    ((((h)->Instance->SR) & (f)) == (f))
+#define __HAL_SPI_CLEAR_OVRFLAG(h)  do { (void)(h)->Instance->DR; (void)(h)->Instance->SR; } while (0)
+
+HAL_StatusTypeDef HAL_SPI_Init(SPI_HandleTypeDef *hspi);
+HAL_StatusTypeDef HAL_SPI_DeInit(SPI_HandleTypeDef *hspi);
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_SPI_Receive_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_SPI_TransmitReceive_DMA(SPI_HandleTypeDef *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size);
+HAL_StatusTypeDef HAL_SPI_DMAStop(SPI_HandleTypeDef *hspi);
+void HAL_SPI_IRQHandler(SPI_HandleTypeDef *hspi);
+
+/*
+ * 호스트 전용
+ */
+
+/**
+ * @brief  SystemCoreClock 단위로 환산한 실제 경과 시간. *_TIMESTAMP() 매크로를 대신한다.
+ *         시간을 흉내 내는 시험 프로그램은 다시 정의할 수 있다
+ */
+uint32_t host_cycles(void);
+
+/**
+ * @brief  RCC 로 SPI 를 리셋할 때 불린다. 기본 동작은 CR1/CR2 를 지우는 것이며, 시험 프로그램이 다시 정의할 수 있다
+ */
+void host_spi_reset(SPI_TypeDef *SPIx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,123 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+/*
+ * I2C 버스별 설정 호스트 시험
+ *
+ * HAL 의 초기화와 블로킹 전송 함수를 흉내 내어 각 호출이 어느 I2C 인스턴스에서 어떤
+ * 클록과 타임아웃으로 불렸는지 기록한다. 다음을 확인한다.
+ *   - 한 버스의 주파수를 바꿔도 다른 버스의 핸들과 클록은 그대로인지
+ *   - 타임아웃이 버스마다 따로 전달되는지
+ *   - 전송, 오류, 타임아웃, 바이트 통계가 버스마다 따로 쌓이는지
+ * 실패하면 0 이 아닌 값으로 끝난다.
+ *
+ * 사용법:
+ *   cc -I tools/host -o i2cbustest tools/i2cbustest.c stm32lib/i2c.c stm32lib/gpio.c tools/host/host.c
+ *   ./i2cbustest
+ */
+#include <stdio.h>
+#include <string.h>
+#include "../stm32lib/i2c.h"
+
+static I2C_TypeDef *last_init;
+static uint32_t last_clock, last_timeout[3];
+static int inits, failed;
+
+static int bus_index(I2C_HandleTypeDef *hi2c)
+{
+    return (hi2c->Instance == I2C1) ? 0 : (hi2c->Instance == I2C2) ? 1 : 2;
+}
+
+/* 흉내 낸 HAL. I2C3 의 전송은 모두 타임아웃으로 끝난다 */
+HAL_StatusTypeDef HAL_I2C_Init(I2C_HandleTypeDef *hi2c)
+{
+    last_init = hi2c->Instance;
+    last_clock = hi2c->Init.ClockSpeed;
+    inits++;
+    return HAL_OK;
+}
+
+static HAL_StatusTypeDef transfer(I2C_HandleTypeDef *hi2c, uint32_t Timeout)
+{
+    last_timeout[bus_index(hi2c)] = Timeout;
+    return (hi2c->Instance == I2C3) ? HAL_TIMEOUT : HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Transmit(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+    return transfer(hi2c, Timeout);
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Read(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+    memset(pData, 0x5A, Size);
+    return transfer(hi2c, Timeout);
+}
+
+static void check(int ok, const char* what)
+{
+    printf("%-44s %s\n", what, ok ? "ok" : "FAIL");
+    if (!ok)
+        failed = 1;
+}
+
+int main(void)
+{
+    I2C_Stats_t s1, s3;
+    uint8_t b[4];
+
+    i2c_init(I2C_1, I2C1_PINS2);
+    i2c_init(I2C_3, I2C3_PINS1);
+    check(i2c_get_handle(I2C_1) != i2c_get_handle(I2C_3) && i2c_get_handle(I2C_1)->Instance == I2C1 &&
+          i2c_get_handle(I2C_3)->Instance == I2C3, "separate handle per bus");
+
+    i2c_set_frequency(I2C_3, 400000);
+    check(last_init == I2C3 && last_clock == 400000, "I2C3 set to 400 kHz");
+    inits = 0;
+    i2c_set_frequency(I2C_1, 100000);
+    check(inits == 1 && last_init == I2C1 && last_clock == 100000, "I2C1 set to 100 kHz alone");
+    check(i2c_get_handle(I2C_3)->Init.ClockSpeed == 400000 && i2c_get_frequency(I2C_3) <= 400000 &&
+          i2c_get_frequency(I2C_3) > 350000, "I2C3 keeps its own clock");
+    check(i2c_get_frequency(I2C_1) <= 100000 && i2c_get_frequency(I2C_1) > 90000, "I2C1 clock not above request");
+
+    i2c_set_timeout(I2C_3, 5);
+    check(i2c_write(I2C_1, 0x78, 0, 1) == 1 && i2c_nread(I2C_1, 0x78, 0, b, 4) == 1, "transfers on I2C1");
+    check(i2c_write(I2C_3, 0xD0, 0x6B, 0) == -1 && i2c_read(I2C_3, 0xD0, 0x75, b) == -1, "timed-out transfers on I2C3");
+    check(last_timeout[0] == I2C_TIMEOUT && last_timeout[2] == 5, "timeout per bus");
+
+    i2c_get_stats(I2C_1, &s1);
+    i2c_get_stats(I2C_3, &s3);
+    check(s1.transfers == 2 && s1.errors == 0 && s1.timeouts == 0 && s1.bytes == 5, "I2C1 stats");
+    check(s3.transfers == 2 && s3.errors == 2 && s3.timeouts == 2 && s3.bytes == 0, "I2C3 stats");
+    i2c_reset_stats(I2C_3);
+    i2c_get_stats(I2C_1, &s1);
+    i2c_get_stats(I2C_3, &s3);
+    check(s3.transfers == 0 && s1.transfers == 2, "reset stats of one bus only");
+
+    printf("%s\n", failed ? "FAILED" : "PASSED");
+    return failed;
+}
@@ -0,0 +1,181 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+/*
+ * I2CSLAVE 호스트 시험
+ *
+ * HAL 의 슬레이브 순차 전송 함수와 콜백을 흉내 내어, 마스터가 레지스터 맵을 쓰고 읽는
+ * 전송을 i2cslave.c 에 그대로 보낸다. 다음을 확인한다.
+ *   - 읽기 전용 레지스터는 바뀌지 않고, 레지스터 포인터가 이어지고, 맵 끝에서 되돌아가는지
+ *   - 받기 버퍼보다 긴 쓰기가 모두 반영되는지
+ *   - 듣기 시작에 실패하면 마스터 모드와 오류 처리 함수가 되돌려지고 다시 초기화할 수 있는지
+ * 실패하면 0 이 아닌 값으로 끝난다.
+ *
+ * 사용법:
+ *   cc -I tools/host -o i2cslavetest tools/i2cslavetest.c stm32lib/i2cslave.c stm32lib/i2c.c \
+ *      stm32lib/gpio.c tools/host/host.c
+ *   ./i2cslavetest
+ */
+#include <stdio.h>
+#include <string.h>
+#include "../stm32lib/i2cslave.h"
+
+static I2C_HandleTypeDef *bus;
+static int listens, listen_fail, slave_mode;
+
+/* 흉내 낸 HAL. 초기화는 주소 ACK 가 켜졌는지(슬레이브 모드)를 기억하고 CR1 을 지운다.
+   인터럽트 전송은 버퍼 위치와 남은 수만 기억한다 */
+HAL_StatusTypeDef HAL_I2C_Init(I2C_HandleTypeDef *hi2c)
+{
+    slave_mode = (hi2c->Instance->CR1 & I2C_CR1_ACK) != 0;
+    hi2c->Instance->CR1 = 0;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Slave_Seq_Receive_IT(I2C_HandleTypeDef *hi2c, uint8_t *pData, uint16_t Size, uint32_t XferOptions)
+{
+    hi2c->pBuffPtr = pData;
+    hi2c->XferCount = Size;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Slave_Seq_Transmit_IT(I2C_HandleTypeDef *hi2c, uint8_t *pData, uint16_t Size, uint32_t XferOptions)
+{
+    hi2c->pBuffPtr = pData;
+    hi2c->XferCount = Size;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_EnableListen_IT(I2C_HandleTypeDef *hi2c)
+{
+    if (listen_fail)
+        return HAL_ERROR;
+    listens++;
+    return HAL_OK;
+}
+
+/* 마스터가 n 바이트를 쓴다. stop 이 0 이면 반복 START 로 이어진다 */
+static void master_write(const uint8_t *data, int n, int stop)
+{
+    int i;
+
+    HAL_I2C_AddrCallback(bus, I2C_DIRECTION_TRANSMIT, 0);
+    for (i = 0; i < n; i++) {
+        *bus->pBuffPtr++ = data[i];
+        if (--bus->XferCount == 0)
+            HAL_I2C_SlaveRxCpltCallback(bus);
+    }
+    if (stop)
+        HAL_I2C_ListenCpltCallback(bus);
+}
+
+/* 마스터가 n 바이트를 읽고 마지막 바이트에 NACK 를 보낸다 */
+static void master_read(uint8_t *data, int n)
+{
+    int i;
+
+    HAL_I2C_AddrCallback(bus, I2C_DIRECTION_RECEIVE, 0);
+    for (i = 0; i < n; i++) {
+        data[i] = *bus->pBuffPtr++;
+        if (--bus->XferCount == 0)
+            HAL_I2C_SlaveTxCpltCallback(bus);
+    }
+    bus->ErrorCode = HAL_I2C_ERROR_AF;
+    HAL_I2C_ErrorCallback(bus);
+    bus->ErrorCode = HAL_I2C_ERROR_NONE;
+}
+
+static uint8_t regs[16];
+static const uint8_t writable[2] = {0xFE, 0xFF};   /* 레지스터 0 은 읽기 전용 */
+static int callbacks;
+
+static void regs_written(I2C_Slave_t *slave, uint8_t reg, uint16_t length)
+{
+    callbacks++;
+}
+
+static I2C_Slave_t dev = {regs, sizeof(regs), writable, regs_written, NULL};
+static int failures;
+
+static void check(int ok, const char *what)
+{
+    printf("%-44s %s\n", what, ok ? "ok" : "FAIL");
+    if (!ok)
+        failures++;
+}
+
+int main(void)
+{
+    const uint8_t w1[] = {0x00, 0x11, 0x22, 0x33};
+    uint8_t big[100], r[20];
+    I2C_SlaveStats_t stats;
+    uint8_t reg;
+    int i, n;
+
+    i2c_init(I2C_1, I2C1_PINS1);
+    bus = i2c_get_handle(I2C_1);
+
+    /* 듣기 시작에 실패하면 마스터로 되돌린다 */
+    listen_fail = 1;
+    check(i2c_slave_init(I2C_1, 0x84, &dev) < 0, "init fails when listen fails");
+    check(!slave_mode, "bus reinitialised as master");
+    listen_fail = 0;
+    check(i2c_slave_init(I2C_1, 0x84, &dev) > 0 && slave_mode, "retry succeeds");
+    check(bus->Init.OwnAddress1 == 0x84, "own address");
+
+    regs[0] = 0x5A;
+    master_write(w1, 4, 1);
+    check(regs[0] == 0x5A && regs[1] == 0x22 && regs[2] == 0x33, "read-only register kept");
+
+    reg = 0x01;
+    master_write(&reg, 1, 0);
+    master_read(r, 3);
+    check(r[0] == 0x22 && r[1] == 0x33 && r[2] == 0x00, "read after register write");
+    master_read(r, 2);
+    check(r[0] == 0x00 && r[1] == 0x00, "read continues from the pointer");
+
+    /* 받기 버퍼보다 길고 레지스터 맵을 몇 번 도는 쓰기 */
+    big[0] = 4;
+    for (i = 1; i < 100; i++)
+        big[i] = i;
+    master_write(big, 100, 1);
+    check(regs[4] == 97 && regs[15] == 92 && regs[1] == 94 && regs[0] == 0x5A, "long write wraps the map");
+
+    reg = 14;
+    master_write(&reg, 1, 0);
+    master_read(r, 20);
+    check(r[0] == regs[14] && r[2] == 0x5A && r[18] == 0x5A, "read wraps the map");
+
+    i2c_slave_get_stats(I2C_1, &stats);
+    printf("writes %lu reads %lu rxbytes %lu txbytes %lu wraps %lu errors %lu callbacks %d\n",
+           (unsigned long)stats.writes, (unsigned long)stats.reads, (unsigned long)stats.rxbytes,
+           (unsigned long)stats.txbytes, (unsigned long)stats.wraps, (unsigned long)stats.errors, callbacks);
+    check(stats.errors == 0, "no errors counted");
+
+    printf("%s\n", failures ? "FAILED" : "PASSED");
+    return failures ? 1 : 0;
+}
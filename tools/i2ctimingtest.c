@@ -0,0 +1,142 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+/*
+ * I2C 타이밍 계산 호스트 시험
+ *
+ * 여러 커널 클록(8 ~ 216 MHz)과 SCL 주파수(10 kHz ~ 1 MHz)로 i2c_calc_timing() 을 부르고
+ * 계산된 레지스터 값을 다시 풀어 다음을 확인한다.
+ *   - 실제 주파수가 요청한 주파수(F4 는 400 kHz, F0/F7 은 1 MHz 까지)를 넘지 않는지
+ *   - 클록이 충분하면 요청한 주파수의 95% 이상인지
+ *   - tLOW, tHIGH 가 각 모드의 최소값 이상인지
+ *   - F4 는 TRISE 가 최대 상승 시간과 맞는지, F0/F7 은 SCLDEL 이 상승 + 셋업 시간 이상인지
+ *   - 만들 수 없는 조합(분주비가 레지스터에 들어가지 않는 경우)만 오류가 되는지
+ * 실패하면 0 이 아닌 값으로 끝난다.
+ *
+ * 사용법:
+ *   cc -I tools/host -o i2ctimingtest tools/i2ctimingtest.c stm32lib/i2c.c stm32lib/gpio.c tools/host/host.c
+ *   cc -DSTM32F7xx -I tools/host -o i2ctimingtest tools/i2ctimingtest.c stm32lib/i2c.c stm32lib/gpio.c tools/host/host.c
+ *   ./i2ctimingtest
+ */
+#include <stdio.h>
+#include "../stm32lib/i2c.h"
+
+static const uint32_t clocks[] = {8000000, 16000000, 42000000, 45000000, 48000000, 50000000,
+                                  54000000, 108000000, 216000000};
+static const uint32_t rates[] = {10000, 100000, 400000, 1000000};
+static int failed;
+
+static void check(int ok, const char* what)
+{
+    printf("%-44s %s\n", what, ok ? "ok" : "FAIL");
+    if (!ok)
+        failed = 1;
+}
+
+#if defined(STM32F7xx) || defined(STM32F0xx)
+#define MAX_RATE  1000000
+#else
+#define MAX_RATE  400000
+#endif
+
+/* 모드별 최소 tLOW, tHIGH 와 최대 상승 시간, 데이터 셋업 시간 (ns) */
+static void spec(uint32_t hz, uint32_t* lowmin, uint32_t* highmin, uint32_t* rise, uint32_t* setup)
+{
+    if (hz > 400000) {
+        *lowmin = 500; *highmin = 260; *rise = 120; *setup = 50;
+    } else if (hz > 100000) {
+        *lowmin = 1300; *highmin = 600; *rise = 300; *setup = 100;
+    } else {
+        *lowmin = 4700; *highmin = 4000; *rise = 1000; *setup = 250;
+    }
+}
+
+/* 계산된 값이 규격을 만족하면 1 */
+static int verify(uint32_t pclk, uint32_t hz, const I2C_Timing_t* t)
+{
+    uint32_t lowmin, highmin, rise, setup;
+    double tp, low, high;
+
+    spec(hz, &lowmin, &highmin, &rise, &setup);
+#if defined(STM32F7xx) || defined(STM32F0xx)
+    uint32_t presc = t->timing >> 28, scldel = (t->timing >> 20) & 0xF;
+
+    tp = (presc + 1) * 1e9 / pclk;
+    low = ((t->timing & 0xFF) + 1) * tp;
+    high = (((t->timing >> 8) & 0xFF) + 1) * tp;
+    /* 가장 큰 분주비에서는 SCLDEL 이 최대값으로 제한될 수 있다 */
+    if (presc < 15 && (scldel + 1) * tp < rise + setup)
+        return 0;
+#else
+    uint32_t ccr = t->ccr & 0xFFF, mhz = pclk / 1000000;
+
+    tp = 1e9 / pclk;
+    if (!(t->ccr & I2C_CCR_FS)) {
+        low = high = ccr * tp;
+    } else if (t->ccr & I2C_CCR_DUTY) {
+        low = 16 * ccr * tp;
+        high = 9 * ccr * tp;
+    } else {
+        low = 2 * ccr * tp;
+        high = ccr * tp;
+    }
+    if (((t->ccr & I2C_CCR_DUTY) != 0) != (t->duty == I2C_DUTYCYCLE_16_9))
+        return 0;
+    if (t->trise != mhz * rise / 1000 + 1)
+        return 0;
+#endif
+    return low >= lowmin && high >= highmin;
+}
+
+int main(void)
+{
+    char what[64];
+    unsigned i, j;
+
+    for (i = 0; i < sizeof(clocks) / sizeof(clocks[0]); i++) {
+        for (j = 0; j < sizeof(rates) / sizeof(rates[0]); j++) {
+            uint32_t pclk = clocks[i], target = (rates[j] < MAX_RATE) ? rates[j] : MAX_RATE;
+            I2C_Timing_t t;
+            int r = i2c_calc_timing(pclk, rates[j], &t);
+
+            snprintf(what, sizeof(what), "%3lu MHz %7lu Hz -> %7lu Hz", (unsigned long)(pclk / 1000000),
+                     (unsigned long)rates[j], (unsigned long)t.hz);
+            if (pclk / target > 2 * 0xFFF) {
+                /* SCL 한 주기가 12 비트 CCR (F0/F7 은 16 분주 x 512) 에 들어가지 않는다 */
+                check(r == -1, what);
+                continue;
+            }
+            check(r == 1 && t.hz <= target && (pclk / target < 40 || t.hz >= target / 100 * 95) &&
+                  verify(pclk, target, &t), what);
+        }
+    }
+    I2C_Timing_t t;
+    check(i2c_calc_timing(0, 100000, &t) == -1 && i2c_calc_timing(42000000, 0, &t) == -1, "zero clock or rate rejected");
+
+    printf("%s\n", failed ? "FAILED" : "PASSED");
+    return failed;
+}
@@ -0,0 +1,178 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+/*
+ * I2C 추적 해석기 (호스트 도구)
+ *
+ * I2C_TRACE=1 로 빌드한 펌웨어에서 i2c_trace_dump() 가 출력한 로그를 읽어서
+ * 전송 시간표와 장치별 버스 점유/대역폭 요약을 출력한다.
+ * 로그에 섞인 다른 출력 줄은 무시한다.
+ *
+ * 사용법:
+ *   cc -o i2ctrace tools/i2ctrace.c
+ *   ./i2ctrace [-c 클럭Hz] [-s] uart.log
+ *     -c: 로그에 클럭 줄이 없을 때 사용할 사이클 카운터 주파수 (기본 16000000)
+ *     -s: 시간표는 생략하고 요약만 출력
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_DEVICES 64
+
+typedef struct {
+    unsigned bus;
+    unsigned address;
+    unsigned long count;
+    unsigned long errors;
+    unsigned long bytes;
+    double busy;        /* 점유 시간 합계 (마이크로초) */
+    double longest;
+} Device_t;
+
+static Device_t devices[MAX_DEVICES];
+static int ndevices;
+
+static Device_t *find_device(unsigned bus, unsigned address)
+{
+    int i;
+
+    for (i = 0; i < ndevices; i++)
+        if (devices[i].bus == bus && devices[i].address == address)
+            return &devices[i];
+    if (ndevices == MAX_DEVICES)
+        return NULL;
+    memset(&devices[ndevices], 0, sizeof(Device_t));
+    devices[ndevices].bus = bus;
+    devices[ndevices].address = address;
+    return &devices[ndevices++];
+}
+
+static const char *status_name(unsigned status)
+{
+    static const char *names[] = {"OK", "ERROR", "BUSY", "TIMEOUT"};
+
+    return (status < 4) ? names[status] : "?";
+}
+
+int main(int argc, char *argv[])
+{
+    FILE *fp = stdin;
+    char line[256], dir;
+    double clock = 16000000.0, us, now = 0.0, window, prevend = 0.0;
+    unsigned long start, end, prevstart = 0, error, lost = 0, value;
+    unsigned bus, address, reg, length, status;
+    int i, summary = 0, first = 1, entries = 0;
+    Device_t *dev;
+
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-c") == 0 && i + 1 < argc)
+            clock = atof(argv[++i]);
+        else if (strcmp(argv[i], "-s") == 0)
+            summary = 1;
+        else if ((fp = fopen(argv[i], "r")) == NULL) {
+            perror(argv[i]);
+            return 1;
+        }
+    }
+
+    if (!summary)
+        printf("%12s %10s %10s  bus  addr dir  reg   len  result\n", "time(us)", "dur(us)", "gap(us)");
+
+    while (fgets(line, sizeof(line), fp) != NULL) {
+        if (sscanf(line, "# i2ctrace clock=%lu", &value) == 1) {
+            clock = (double)value;
+            continue;
+        }
+        if (sscanf(line, "# dropped=%lu", &value) == 1) {
+            lost += value;
+            continue;
+        }
+        if (sscanf(line, "I2C%u %x %x %c %u %u %lx %lu %lu",
+                   &bus, &address, &reg, &dir, &length, &status, &error, &start, &end) != 9)
+            continue;
+
+        /* 사이클 카운터는 32비트이므로 차이로 계산하여 넘침을 처리한다 */
+        if (!first)
+            now += (double)((unsigned long)(unsigned int)(start - prevstart)) * 1e6 / clock;
+        us = (double)((unsigned long)(unsigned int)(end - start)) * 1e6 / clock;
+
+        if (!summary) {
+            printf("%12.1f %10.1f ", now, us);
+            if (first)
+                printf("%10s ", "-");
+            else
+                printf("%10.1f ", now - prevend);
+            printf(" I2C%u  %02X   %c  ", bus, address, dir);
+            if (reg == 0xFFFF)
+                printf("  -  ");
+            else
+                printf("%04X ", reg);
+            printf("%5u  %s", length, status_name(status));
+            if (error != 0)
+                printf(" (error 0x%lX)", error);
+            printf("\n");
+        }
+
+        dev = find_device(bus, address);
+        if (dev != NULL) {
+            dev->count++;
+            if (status != 0)
+                dev->errors++;
+            else
+                dev->bytes += length;
+            dev->busy += us;
+            if (us > dev->longest)
+                dev->longest = us;
+        }
+
+        prevstart = start;
+        prevend = now + us;
+        first = 0;
+        entries++;
+    }
+    if (fp != stdin)
+        fclose(fp);
+
+    if (entries == 0) {
+        fprintf(stderr, "no trace entries\n");
+        return 1;
+    }
+
+    /* 첫 전송 시작부터 마지막 전송 끝까지를 측정 구간으로 본다 */
+    window = prevend;
+    printf("\n%d transfers in %.1f us, %lu dropped, clock %.0f Hz\n", entries, window, lost, clock);
+    printf(" bus  addr  count  errors    bytes   busy(us)  longest(us)  occupancy  bandwidth(B/s)\n");
+    for (i = 0; i < ndevices; i++) {
+        dev = &devices[i];
+        printf(" I2C%u  %02X %6lu %7lu %8lu %10.1f %12.1f %9.1f%% %15.0f\n",
+               dev->bus, dev->address, dev->count, dev->errors, dev->bytes, dev->busy, dev->longest,
+               (window > 0) ? dev->busy * 100.0 / window : 0.0,
+               (dev->busy > 0) ? dev->bytes * 1e6 / dev->busy : 0.0);
+    }
+    return 0;
+}
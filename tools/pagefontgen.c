@@ -0,0 +1,201 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+/*
+ * 페이지 폰트 생성기 (호스트 도구)
+ *
+ * stm32lib/font.c 의 행 단위 ASCII 폰트 테이블(한 행당 uint16_t, MSB가 왼쪽 픽셀)을
+ * 읽어서 SSD1306 버퍼와 같은 8 픽셀 세로 페이지 형식(LSB가 위쪽 픽셀)의
+ * stm32lib/pagefont.c 를 생성한다.
+ *
+ * 사용법:
+ *   cc -o pagefontgen tools/pagefontgen.c
+ *   ./pagefontgen stm32lib/font.c > stm32lib/pagefont.c
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_VALUES  (128 * 32)
+#define FIRST_CHAR  32
+
+typedef struct {
+    int width;
+    int height;
+    int count;
+    unsigned short rows[MAX_VALUES];
+} RowFont_t;
+
+static const char *license =
+"/*\n"
+" *----------------------------------------------------------------------\n"
+" * Copyright (C) Seong-Woo Kim, 2018\n"
+" * \n"
+" * Permission is hereby granted, free of charge,\n"
+" * to any person obtaining a copy of\n"
+" * this software and associated documentation files\n"
+" * (the \"Software\"), to deal in the Software without\n"
+" * restriction, including without limitation the rights\n"
+" * to use, copy, modify, merge, publish, distribute,\n"
+" * sublicense, and/or sell copies of the Software, and\n"
+" * to permit persons to whom the Software is furnished\n"
+" * to do so, subject to the following conditions:\n"
+" * \n"
+" * The above copyright notice and this permission notice\n"
+" * shall be included in all copies or substantial portions\n"
+" * of the Software.\n"
+" * \n"
+" * THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND,\n"
+" * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF\n"
+" * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.\n"
+" * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY\n"
+" * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,\n"
+" * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE\n"
+" * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.\n"
+" *----------------------------------------------------------------------\n"
+" */\n";
+
+/* "const uint16_t Font7x10 [] = {" 형식의 줄에서 넓이와 높이를 얻는다 */
+static int parse_header(const char *line, int *w, int *h)
+{
+    const char *p = strstr(line, "const uint16_t Font");
+
+    if (p == NULL)
+        return 0;
+    return sscanf(p, "const uint16_t Font%dx%d", w, h) == 2;
+}
+
+/* 한 줄에서 주석을 제외한 16진수 값들을 읽는다 */
+static void parse_values(char *line, RowFont_t *font)
+{
+    char *p, *end;
+    char *comment = strstr(line, "//");
+
+    if (comment)
+        *comment = '\0';
+    for (p = line; *p; p++) {
+        if (p[0] == '0' && (p[1] == 'x' || p[1] == 'X')) {
+            unsigned long v = strtoul(p, &end, 16);
+            if (font->count < MAX_VALUES)
+                font->rows[font->count++] = (unsigned short)v;
+            p = end - 1;
+        }
+    }
+}
+
+static void emit_font(const RowFont_t *font)
+{
+    int glyphs = font->count / font->height;
+    int pages = (font->height + 7) / 8;
+    int g, p, x, b, y;
+
+    printf("const uint8_t PageFont%dx%d [] = {\n", font->width, font->height);
+    for (g = 0; g < glyphs; g++) {
+        const unsigned short *rows = &font->rows[g * font->height];
+        for (p = 0; p < pages; p++) {
+            for (x = 0; x < font->width; x++) {
+                unsigned char v = 0;
+                for (b = 0; b < 8; b++) {
+                    y = p * 8 + b;
+                    if (y < font->height && ((rows[y] << x) & 0x8000))
+                        v |= 1 << b;
+                }
+                printf("0x%02X,", v);
+            }
+        }
+        printf(" // Ascii = [%c]\n", FIRST_CHAR + g);
+    }
+    printf("};\n\n");
+}
+
+static void emit_struct(const RowFont_t *font)
+{
+    int glyphs = font->count / font->height;
+
+    printf("Font_t PageFont_%dx%d = {\n", font->width, font->height);
+    printf("    PAGE_FONT,\n");
+    printf("    %d,\n", font->width);
+    printf("    %d,\n", font->height);
+    printf("    %d, %d,\n", FIRST_CHAR, FIRST_CHAR + glyphs - 1);
+    printf("    (FontData_t)PageFont%dx%d\n", font->width, font->height);
+    printf("};\n\n");
+}
+
+static void emit_fontset(const RowFont_t *font)
+{
+    printf("FontSet_t PageFontSet_%d = {\n", font->height);
+    printf("    %d,\n", font->height);
+    printf("    %d,\n", font->height);
+    printf("    {&PageFont_%dx%d, NULL}\n", font->width, font->height);
+    printf("};\n\n");
+}
+
+int main(int argc, char *argv[])
+{
+    static RowFont_t fonts[8];
+    int nfonts = 0, infont = 0, i;
+    char line[1024];
+    FILE *fp;
+
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s font.c > pagefont.c\n", argv[0]);
+        return 1;
+    }
+    if ((fp = fopen(argv[1], "r")) == NULL) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    while (fgets(line, sizeof(line), fp)) {
+        int w, h;
+        if (!infont && nfonts < 8 && parse_header(line, &w, &h)) {
+            fonts[nfonts].width = w;
+            fonts[nfonts].height = h;
+            fonts[nfonts].count = 0;
+            infont = 1;
+        } else if (infont) {
+            if (strstr(line, "};")) {
+                infont = 0;
+                nfonts++;
+            } else {
+                parse_values(line, &fonts[nfonts]);
+            }
+        }
+    }
+    fclose(fp);
+
+    printf("%s", license);
+    printf("/*\n * 이 파일은 tools/pagefontgen.c 로 생성되었다. 직접 수정하지 말 것.\n */\n");
+    printf("#include \"../stm32lib/pagefont.h\"\n\n");
+    for (i = 0; i < nfonts; i++)
+        emit_font(&fonts[i]);
+    for (i = 0; i < nfonts; i++)
+        emit_struct(&fonts[i]);
+    for (i = 0; i < nfonts; i++)
+        emit_fontset(&fonts[i]);
+    return 0;
+}
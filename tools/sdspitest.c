@@ -0,0 +1,423 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+/*
+ * SDSPI 호스트 시험
+ *
+ * SPI 모드 SD 카드(SDHC, 2 MB)를 메모리 안에 흉내 내고, spi/spiasync 함수를 카드에
+ * 바이트를 넘기는 함수로 바꿔 sdspi.c 를 그대로 실행한다. 카드는 CMD0/8/55/41/58/59/9/16,
+ * CMD17/18/12, ACMD23, CMD24/25 와 데이터 토큰, 명령과 블록의 CRC 를 처리한다. 다음을 확인한다.
+ *   - 초기화 과정과 CSD 로 구한 블록 수
+ *   - 한 블록과 여러 블록 읽기/쓰기, 범위를 벗어난 블록 거부
+ *   - CRC 를 켰을 때(SDSPI_CRC=1) 깨진 블록을 SDSPI_RES_CRC 로 알리는지
+ *   - DMA 전송이 끝나지 않으면 기술자를 취소하고 오류를 돌려주는지(SDSPI_DMA=1)
+ *   - 64 블록씩 이어 쓰고 읽을 때 선 위의 바이트 중 데이터가 차지하는 비율
+ * 사이클은 SCK 클럭(168 MHz, 최대 21 MHz)으로 계산하여 DWT->CYCCNT 에 더하므로
+ * sdspi_read_rate()/sdspi_write_rate() 는 이 모델의 값이다. 실패하면 0 이 아닌 값으로 끝난다.
+ *
+ * 사용법:
+ *   cc -I tools/host -o sdspitest tools/sdspitest.c stm32lib/sdspi.c tools/host/host.c
+ *   cc -I tools/host -DSDSPI_DMA=0 -DSDSPI_CRC=1 -o sdspitest tools/sdspitest.c stm32lib/sdspi.c \
+ *      tools/host/host.c
+ *   ./sdspitest
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../stm32lib/sdspi.h"
+
+#define NSECT   4096
+
+static uint8_t disk[NSECT][512];
+static uint8_t queue[4096];             /* MISO 로 나갈 바이트 */
+static int qhead, qtail;
+static uint8_t cmd[6];
+static int ncmd;
+static int cs = 1, idle = 1, app, ready_tries, crc_on, busy;
+static int mode;                        /* 0: 명령, 1: 연속 읽기, 2: 쓰기 토큰 대기, 3: 쓰기 데이터 */
+static uint32_t addr;
+static int multi, nw;
+static uint8_t wbuf[514];
+static uint64_t wire;
+static int sck_div = 8;
+static int acmd23, cmd12s, bad_cmd_crc, blocks_in, inject_crc;
+#if SDSPI_DMA
+static int dma_stall, cancels;
+#endif
+static int failed;
+
+static void put(uint8_t b)
+{
+    queue[qtail++ & 4095] = b;
+}
+
+static uint8_t crc7(const uint8_t* d, int n)
+{
+    uint8_t c = 0, b, i;
+
+    while (n--)
+        for (b = *d++, i = 0; i < 8; i++, b <<= 1) {
+            c <<= 1;
+            if ((b ^ c) & 0x80)
+                c ^= 0x09;
+        }
+    return c & 0x7F;
+}
+
+static uint16_t crc16(const uint8_t* d, int n)
+{
+    uint16_t c = 0;
+    int i;
+
+    while (n--) {
+        c ^= (uint16_t)*d++ << 8;
+        for (i = 0; i < 8; i++)
+            c = (c & 0x8000) ? (c << 1) ^ 0x1021 : c << 1;
+    }
+    return c;
+}
+
+/* 읽기 지연 두 바이트, 시작 토큰, 데이터, CRC 순으로 내보낸다 */
+static void put_block(const uint8_t* d, int n)
+{
+    uint16_t c = crc16(d, n);
+    int i;
+
+    put(0xFF);
+    put(0xFF);
+    put(0xFE);
+    for (i = 0; i < n; i++)
+        put(d[i]);
+    if (inject_crc && n == 512) {
+        inject_crc = 0;
+        c ^= 1;
+    }
+    put(c >> 8);
+    put(c);
+}
+
+static void r1(uint8_t v)
+{
+    put(0xFF);
+    put(v);
+}
+
+static void command(void)
+{
+    uint8_t c = cmd[0] & 0x3F;
+    uint32_t arg = ((uint32_t)cmd[1] << 24) | (cmd[2] << 16) | (cmd[3] << 8) | cmd[4];
+    int was_app = app;
+
+    app = 0;
+    if ((crc_on || c == 0 || c == 8) && cmd[5] != ((crc7(cmd, 5) << 1) | 1)) {
+        bad_cmd_crc++;
+        r1(0x08 | idle);
+        return;
+    }
+    if (was_app && c == 41) {
+        if (++ready_tries >= 3)
+            idle = 0;
+        r1(idle);
+        return;
+    }
+    if (was_app && c == 23) {
+        acmd23 = arg;
+        r1(0);
+        return;
+    }
+    switch (c) {
+    case 0:  idle = 1; ready_tries = 0; r1(1); break;
+    case 8:  r1(idle); put(0); put(0); put(arg >> 8 & 0x0F); put(arg & 0xFF); break;
+    case 55: app = 1; r1(idle); break;
+    case 58: r1(idle); put(0xC0); put(0xFF); put(0x80); put(0); break;
+    case 59: crc_on = arg & 1; r1(idle); break;
+    case 16: r1(0); break;
+    case 9: {
+        /* CSD 버전 2: C_SIZE = 블록 수 / 1024 - 1 */
+        uint8_t csd[16] = {0};
+        uint32_t size = NSECT / 1024 - 1;
+        csd[0] = 0x40;
+        csd[7] = size >> 16 & 0x3F;
+        csd[8] = size >> 8;
+        csd[9] = size;
+        r1(0);
+        put_block(csd, 16);
+        break;
+    }
+    case 17: addr = arg; r1(0); put_block(disk[addr], 512); break;
+    case 18: addr = arg; r1(0); mode = 1; break;
+    case 12: qhead = qtail; mode = 0; cmd12s++; put(0xFF); put(0); put(0); put(0); break;
+    case 24:
+    case 25: addr = arg; multi = (c == 25); r1(0); mode = 2; break;
+    default: r1(0x04); break;
+    }
+}
+
+/* 카드와 한 바이트를 주고받는다 */
+static uint8_t card_xchg(uint8_t mosi)
+{
+    uint8_t miso = 0xFF;
+
+    wire++;
+    if (cs)
+        return 0xFF;
+    if (qhead != qtail)
+        miso = queue[qhead++ & 4095];
+    else if (busy) {
+        busy--;
+        miso = 0;
+    } else if (mode == 1 && ncmd == 0) {
+        put_block(disk[addr++], 512);
+        miso = queue[qhead++ & 4095];
+    }
+    if (mode == 2) {
+        if (mosi == 0xFE || mosi == 0xFC) {
+            mode = 3;
+            nw = 0;
+            return miso;
+        }
+        if (mosi == 0xFD && multi) {
+            mode = 0;
+            busy = 5;
+            return miso;
+        }
+    } else if (mode == 3) {
+        wbuf[nw++] = mosi;
+        if (nw == 514) {
+            if (crc_on && ((wbuf[512] << 8) | wbuf[513]) != crc16(wbuf, 512))
+                put(0x0B);
+            else {
+                memcpy(disk[addr++], wbuf, 512);
+                put(0x05);
+                blocks_in++;
+                busy = multi ? 3 : 40;
+            }
+            mode = multi ? 2 : 0;
+        }
+        return miso;
+    }
+    if (ncmd == 0 && (mosi & 0xC0) == 0x40)
+        cmd[ncmd++] = mosi;
+    else if (ncmd > 0) {
+        cmd[ncmd++] = mosi;
+        if (ncmd == 6) {
+            ncmd = 0;
+            command();
+        }
+    }
+    return miso;
+}
+
+/* 바이트 하나는 SCK 8 클럭, 바이트마다 함수를 부르면 24 사이클을 더한다 */
+static void tick(int bulk)
+{
+    DWT->CYCCNT += 8 * sck_div + (bulk ? 0 : 24);
+}
+
+/* 흉내 낸 SPI/GPIO/SPIASYNC */
+int spi_writeread(SPI_t SPI_Num, int value)
+{
+    tick(0);
+    return card_xchg(value);
+}
+
+void spi_nwrite(SPI_t SPI_Num, const void* data, int length)
+{
+    const uint8_t *p = data;
+
+    while (length--) {
+        tick(1);
+        card_xchg(*p++);
+    }
+    DWT->CYCCNT += 40;
+}
+
+int spi_nread(SPI_t SPI_Num, void* data, int length, int fill)
+{
+    uint8_t *p = data;
+
+    while (length--) {
+        tick(1);
+        *p++ = card_xchg(fill);
+    }
+    DWT->CYCCNT += 40;
+    return 1;
+}
+
+int spi_make_profile(SPI_t SPI_Num, SPI_Profile_t* profile, SPI_Mode_t mode, int bits, int hz)
+{
+    memset(profile, 0, sizeof(SPI_Profile_t));
+    profile->hz = (hz > 21000000) ? 21000000 : hz;
+    return profile->hz;
+}
+
+int spi_set_profile(SPI_t SPI_Num, const SPI_Profile_t* profile)
+{
+    sck_div = SystemCoreClock / 8 / profile->hz;
+    if (sck_div < 8)
+        sck_div = 8;
+    return 1;
+}
+
+/* 카드를 놓으면 남은 응답과 연속 읽기를 버린다 */
+void spi_select(SPI_t SPI_Num, GPIO_Pin_t pin)
+{
+    cs = 0;
+}
+
+void spi_deselect(SPI_t SPI_Num, GPIO_Pin_t pin)
+{
+    cs = 1;
+    ncmd = 0;
+    qhead = qtail;
+    if (mode == 1)
+        mode = 0;
+}
+
+void gpio_init(GPIO_Pin_t pin, GPIO_Mode_t mode) {}
+void gpio_write(GPIO_Pin_t pin, uint16_t value) {}
+
+uint32_t HAL_GetTick(void)
+{
+    return DWT->CYCCNT / (SystemCoreClock / 1000);
+}
+
+#if SDSPI_DMA
+int spi_async_init(SPI_t SPI_Num)
+{
+    return 1;
+}
+
+void spi_async_device(SPI_Device_t* dev, SPI_t SPI_Num, GPIO_Pin_t cs, GPIO_Pin_t dc, SPI_Mode_t mode, uint32_t hz, int bits)
+{
+    dev->bus = SPI_Num;
+}
+
+/* 바로 전송하고 끝난 것으로 표시한다. dma_stall 이면 큐에 남은 것처럼 둔다 */
+int spi_async_submit(SPI_Async_t* xfer)
+{
+    const uint8_t *tx = xfer->tx;
+    uint8_t *rx = xfer->rx, v;
+    int i;
+
+    if (dma_stall) {
+        xfer->state = SPI_ASYNC_PENDING;
+        return 1;
+    }
+    for (i = 0; i < xfer->length; i++) {
+        v = card_xchg(tx ? tx[i] : 0xFF);
+        DWT->CYCCNT += 8 * sck_div;
+        if (rx)
+            rx[i] = v;
+    }
+    DWT->CYCCNT += 300;
+    xfer->state = SPI_ASYNC_DONE;
+    return 1;
+}
+
+int spi_async_wait(SPI_Async_t* xfer, uint32_t timeout)
+{
+    return (xfer->state == SPI_ASYNC_DONE) ? 1 : -1;
+}
+
+int spi_async_cancel(SPI_Async_t* xfer)
+{
+    if (xfer->state != SPI_ASYNC_PENDING)
+        return 0;
+    xfer->state = SPI_ASYNC_ERROR;
+    cancels++;
+    return 1;
+}
+#endif
+
+static void check(int ok, const char* what)
+{
+    printf("%-44s %s\n", what, ok ? "ok" : "FAIL");
+    if (!ok)
+        failed = 1;
+}
+
+static uint8_t buf[64][512], chk[64][512];
+
+int main(void)
+{
+    SDSPI_t card;
+    uint64_t w0, w1, w2;
+    int i, same;
+
+    SystemCoreClock = 168000000;
+    for (i = 0; i < NSECT * 512; i++)
+        ((uint8_t *)disk)[i] = rand();
+
+    check(sdspi_init(&card, SPI_2, GPIO_PB_12) == SDSPI_RES_OK, "init");
+    check(card.type == SDSPI_TYPE_SDHC && card.sectors == NSECT, "SDHC type and sector count from CSD");
+    check(card.hz == 21000000 && bad_cmd_crc == 0, "fast clock, command CRCs accepted");
+
+    check(sdspi_read(&card, 10, buf[0], 1) == SDSPI_RES_OK && memcmp(buf[0], disk[10], 512) == 0, "single block read");
+    check(sdspi_read(&card, 100, buf, 32) == SDSPI_RES_OK && memcmp(buf, disk[100], 32 * 512) == 0 &&
+          cmd12s == 1, "multi block read stopped with CMD12");
+    for (i = 0; i < 64 * 512; i++)
+        ((uint8_t *)buf)[i] = i * 13;
+    check(sdspi_write(&card, 7, buf[0], 1) == SDSPI_RES_OK && memcmp(disk[7], buf[0], 512) == 0, "single block write");
+    check(sdspi_write(&card, 200, buf, 64) == SDSPI_RES_OK && memcmp(disk[200], buf, 64 * 512) == 0 &&
+          acmd23 == 64, "multi block write with ACMD23 pre-erase");
+    check(sdspi_read(&card, NSECT - 1, buf, 2) == SDSPI_RES_PARAM, "read past the last block rejected");
+
+#if SDSPI_CRC
+    inject_crc = 1;
+    check(sdspi_read(&card, 300, buf, 4) == SDSPI_RES_CRC && card.crcerrors == 1, "corrupted block reported as CRC error");
+#endif
+#if SDSPI_DMA
+    dma_stall = 1;
+    check(sdspi_read(&card, 20, buf, 1) != SDSPI_RES_OK && cancels == 1, "stalled DMA block cancelled");
+    dma_stall = 0;
+    check(sdspi_read(&card, 20, buf, 1) == SDSPI_RES_OK && memcmp(buf[0], disk[20], 512) == 0, "read works after cancel");
+#endif
+
+    /* 1 MB 를 64 블록씩 쓰고 읽는다 */
+    for (i = 0; i < 64 * 512; i++)
+        ((uint8_t *)buf)[i] = i * 7;
+    card.readblocks = card.writeblocks = 0;
+    card.readcycles = card.writecycles = 0;
+    w0 = wire;
+    for (i = 0; i < 32; i++)
+        sdspi_write(&card, 1024 + i * 64, buf, 64);
+    w1 = wire;
+    same = 1;
+    for (i = 0; i < 32; i++) {
+        sdspi_read(&card, 1024 + i * 64, chk, 64);
+        same &= memcmp(chk, buf, sizeof(buf)) == 0;
+    }
+    w2 = wire;
+    check(same, "1 MB written and read back");
+    printf("write: wire efficiency %.1f%%, %.2f MB/s (model)\n", 100.0 * 32 * 64 * 512 / (w1 - w0), sdspi_write_rate(&card) / 1e6);
+    printf("read : wire efficiency %.1f%%, %.2f MB/s (model)\n", 100.0 * 32 * 64 * 512 / (w2 - w1), sdspi_read_rate(&card) / 1e6);
+    check(32.0 * 64 * 512 / (w1 - w0) > 0.98 && 32.0 * 64 * 512 / (w2 - w1) > 0.98, "more than 98% of wire bytes are payload");
+
+    printf("%s\n", failed ? "FAILED" : "PASSED");
+    return failed;
+}
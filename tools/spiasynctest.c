@@ -0,0 +1,182 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+/*
+ * SPIASYNC 호스트 시험
+ *
+ * SPI1 의 DMA 스트림(DMA2 스트림 0/3)을 흉내 내어, 켜진 두 스트림을 한 번에 끝까지 돌리고
+ * 받은 값으로 보낸 값 ^ 0x5A 를 돌려준 후 완료 인터럽트를 부른다. 사이클 카운터는 SCK 로
+ * 프레임을 보내는 데 걸리는 만큼 늘린다. 다음을 확인한다.
+ *   - 장치마다 최대 주파수를 넘지 않는 SCK 와 CR1 을 계산하는지
+ *   - 큐의 전송이 순서대로 이어지고 CS/DC 가 기술자와 SPI_ASYNC_HOLD 대로 움직이는지
+ *   - 8/16 비트 프레임, 송신 또는 수신 버퍼가 없는 전송이 맞게 동작하는지
+ *   - 장치가 바뀔 때만 CR1 을 다시 쓰는지, 통계와 처리량이 맞는지
+ *   - 기다리는 기술자와 전송 중인 기술자를 취소할 수 있는지, 전송 오류(TEIF)를 알리는지
+ * 실패하면 0 이 아닌 값으로 끝난다.
+ *
+ * 사용법:
+ *   cc -no-pie -I tools/host -o spiasynctest tools/spiasynctest.c stm32lib/spiasync.c stm32lib/spi.c tools/host/host.c
+ *   ./spiasynctest
+ */
+#include <stdio.h>
+#include <string.h>
+#include "../stm32lib/spiasync.h"
+
+static char trace[1024];
+static int tracelen, callbacks, failed;
+
+static void note(const char* s)
+{
+    tracelen += snprintf(trace + tracelen, sizeof(trace) - tracelen, "%s ", s);
+}
+
+/* CS 와 DC 핀은 trace 에 기록만 한다 */
+void gpio_init(GPIO_Pin_t pin, GPIO_Mode_t mode) {}
+void gpio_alternate_init(GPIO_Pin_t pin, GPIO_Mode_t mode, uint8_t alternate) {}
+void gpio_set_pinmode(GPIO_Pin_t pin, GPIO_PullMode_t mode) {}
+
+void gpio_write(GPIO_Pin_t pin, uint16_t value)
+{
+    char s[8];
+
+    snprintf(s, sizeof(s), "%s%c", (pin == GPIO_PB_6) ? "A" : (pin == GPIO_PA_4) ? "B" : "DC", value ? '1' : '0');
+    note(s);
+}
+
+void DMA2_Stream0_IRQHandler(void);
+
+/* 켜진 SPI1 스트림을 끝까지 돌리고 완료 인터럽트를 부른다. 돌릴 것이 없으면 0 */
+static int sim_dma(uint32_t sck)
+{
+    DMA_Stream_TypeDef *rx = DMA2_Stream0, *tx = DMA2_Stream3;
+    uint8_t *txp = (uint8_t *)(uintptr_t)tx->M0AR, *rxp = (uint8_t *)(uintptr_t)rx->M0AR;
+    int wide = (rx->CR & DMA_SxCR_MSIZE_0) != 0, n = tx->NDTR, i;
+
+    if (!(rx->CR & DMA_SxCR_EN) || !(tx->CR & DMA_SxCR_EN) ||
+        !(SPI1->CR2 & SPI_CR2_TXDMAEN) || !(SPI1->CR2 & SPI_CR2_RXDMAEN) || tx->NDTR != rx->NDTR)
+        return 0;
+    for (i = 0; i < n; i++) {
+        int ti = (tx->CR & DMA_SxCR_MINC) ? i : 0, ri = (rx->CR & DMA_SxCR_MINC) ? i : 0;
+        uint16_t v = (wide ? ((uint16_t *)txp)[ti] : txp[ti]) ^ 0x5A;
+
+        if (wide)
+            ((uint16_t *)rxp)[ri] = v;
+        else
+            rxp[ri] = (uint8_t)v;
+    }
+    DWT->CYCCNT += (uint32_t)((uint64_t)n * (wide ? 16 : 8) * SystemCoreClock / sck);
+    tx->NDTR = rx->NDTR = 0;
+    tx->CR &= ~DMA_SxCR_EN;
+    rx->CR &= ~DMA_SxCR_EN;
+    DMA2->LISR = 0x20;      /* 스트림 0 TCIF */
+    DMA2_Stream0_IRQHandler();
+    DMA2->LISR = 0;
+    return 1;
+}
+
+static void done(SPI_Async_t* xfer, int result)
+{
+    callbacks++;
+    note(result > 0 ? "ok" : "err");
+}
+
+static void check(int ok, const char* what)
+{
+    printf("%-44s %s\n", what, ok ? "ok" : "FAIL");
+    if (!ok)
+        failed = 1;
+}
+
+int main(void)
+{
+    static SPI_Device_t a, b;
+    static uint8_t cmd[6] = {0x15, 0, 95, 0x75, 0, 63}, pixels[300], rxb[4];
+    static uint16_t w16[4] = {0x1234, 0xABCD, 1, 2}, r16[4];
+    static SPI_Async_t x1, x2, x3, x4, x5;
+    SPI_AsyncStats_t st;
+    int i, steps = 0;
+
+    SystemCoreClock = 168000000;    /* PCLK2 = 84 MHz */
+    check(spi_async_init(SPI_1) == 1, "init SPI1");
+    spi_async_device(&a, SPI_1, GPIO_PB_6, GPIO_PC_7, SPI_Mode3, 8000000, 8);
+    spi_async_device(&b, SPI_1, GPIO_PA_4, GPIO_NC, SPI_Mode0, 20000000, 16);
+    check(a.hz == 5250000 && b.hz == 10500000 && a.cr1 != b.cr1, "device SCK not above maximum");
+
+    for (i = 0; i < 300; i++)
+        pixels[i] = i;
+    tracelen = 0;
+    x1 = (SPI_Async_t){&a, 0, cmd, NULL, 6, SPI_ASYNC_HOLD, done, NULL};
+    x2 = (SPI_Async_t){&a, 1, pixels, NULL, 300, 0, done, NULL};
+    x3 = (SPI_Async_t){&b, 0, w16, r16, 4, 0, done, NULL};
+    x4 = (SPI_Async_t){&a, 0, NULL, rxb, 4, 0, done, NULL};
+    x5 = (SPI_Async_t){&a, 0, cmd, NULL, 6, 0, done, NULL};
+    check(spi_async_submit(&x1) == 1 && spi_async_submit(&x2) == 1 && spi_async_submit(&x3) == 1 &&
+          spi_async_submit(&x4) == 1 && spi_async_submit(&x5) == 1, "queue five transfers");
+    check(spi_async_submit(&x1) == -1 && spi_async_pending(SPI_1) == 5, "pending transfer not queued twice");
+
+    while (sim_dma((SPI1->CR1 & SPI_CR1_DFF) ? b.hz : a.hz)) {
+        steps++;
+        note("|");
+    }
+    check(steps == 5 && callbacks == 5, "transfers chained from the interrupt");
+    /* 다음 전송은 완료 인터럽트 안에서 시작하므로 | 앞에 찍힌다. x1 과 x2 사이에 A1 이 없어야 한다 */
+    check(strcmp(trace, "DC0 A0 ok DC1 A0 | A1 ok B0 | B1 ok DC0 A0 | A1 ok DC0 A0 | A1 ok | ") == 0,
+          "CS held across command and data");
+    check(x1.state == SPI_ASYNC_DONE && x2.state == SPI_ASYNC_DONE && x3.state == SPI_ASYNC_DONE &&
+          x4.state == SPI_ASYNC_DONE && x5.state == SPI_ASYNC_DONE, "all transfers done");
+    check(r16[0] == (0x1234 ^ 0x5A) && r16[1] == (0xABCD ^ 0x5A), "16-bit frames received");
+    check(rxb[0] == (0xFF ^ 0x5A) && rxb[3] == (0xFF ^ 0x5A), "receive only sends 0xFF");
+
+    spi_async_get_stats(SPI_1, &st);
+    check(st.submitted == 5 && st.completed == 5 && st.errors == 0 && st.depth == 0 && st.maxdepth == 5,
+          "queue stats");
+    check(st.bytes == 6 + 300 + 8 + 4 + 6 && a.bytes == 316 && b.bytes == 8, "byte counts");
+    check(st.reconfigs == 3, "CR1 rewritten only on device change");
+    check(spi_async_throughput(&a) == a.hz / 8 && spi_async_throughput(&b) == b.hz / 8, "throughput at SCK rate");
+
+    /* 기다리는 기술자와 전송 중인 기술자 취소 */
+    tracelen = 0;
+    x1.flags = 0;
+    spi_async_submit(&x1);
+    spi_async_submit(&x5);
+    check(spi_async_cancel(&x5) == 1 && x5.state == SPI_ASYNC_ERROR && spi_async_pending(SPI_1) == 1,
+          "cancel a waiting transfer");
+    check(spi_async_cancel(&x1) == 1 && x1.state == SPI_ASYNC_ERROR && spi_async_pending(SPI_1) == 0 &&
+          !(DMA2_Stream0->CR & DMA_SxCR_EN) && !(SPI1->CR2 & SPI_CR2_TXDMAEN), "cancel the active transfer");
+    check(spi_async_cancel(&x1) == 0 && strcmp(trace, "DC0 A0 A1 ") == 0, "CS released once");
+
+    /* 전송 오류 */
+    callbacks = 0;
+    spi_async_submit(&x5);
+    DMA2->LISR = 0x08;      /* 스트림 0 TEIF */
+    DMA2_Stream0_IRQHandler();
+    DMA2->LISR = 0;
+    check(x5.state == SPI_ASYNC_ERROR && callbacks == 1 && a.errors == 3, "transfer error reported");
+
+    printf("%s\n", failed ? "FAILED" : "PASSED");
+    return failed;
+}
@@ -0,0 +1,243 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+/*
+ * SPI 묶음 전송 호스트 시험
+ *
+ * STM32F4 SPI 마스터(송신 버퍼 하나, 수신 버퍼 하나, 시프트 레지스터)를 코어 클록 단위로
+ * 흉내 낸다. HOST_SPI_SIM 으로 SR/DR 접근을 가로채고 접근마다 4 클록이 지난 것으로 본다.
+ * 슬레이브는 받은 값에 0x5A 를 XOR 하여 돌려준다. 168 MHz 에서 SCK 42/21/5.25 MHz 로 다음을 확인한다.
+ *   - spi_writeread, spi_nwriteread, spi_nwrite, spi_nread, spi_nfill 의 데이터
+ *   - spi_nwriteread 가 선 속도를 내고, 바이트마다 부르는 spi_writeread 보다 빠른지
+ *   - 16 비트 프레임
+ *   - CPU 가 늦어 오버런이 나면 멈추지 않고 -1 을 돌려주는지, 전송 전에 남은 수신 값과 OVR 을 지우는지
+ * 실패하면 0 이 아닌 값으로 끝난다.
+ *
+ * 사용법:
+ *   cc -I tools/host -c -o host.o tools/host/host.c
+ *   c++ -std=c++20 -I tools/host -DHOST_SPI_SIM -o spibulktest tools/spibulktest.cpp -x c++ stm32lib/spi.c \
+ *       -x none host.o
+ *   ./spibulktest
+ */
+#include <stdio.h>
+#include <string.h>
+#include "../stm32lib/spi.h"
+
+/* 코어 클록 단위의 SPI 마스터 모델 */
+static struct {
+    uint64_t now;
+    uint32_t access, frame;
+    int shifting, txfull, rxfull, ovr, ovr_read;
+    uint64_t shift_end;
+    uint16_t shift_val, txval, rxval;
+    uint64_t lost, frames;
+    uint16_t sent[4096];
+    uint32_t nsent;
+} sim;
+static int failed;
+
+/* t 까지 시프트를 끝낸 프레임을 수신 버퍼로 옮기고, 송신 버퍼에 있으면 다음 프레임을 시작한다 */
+static void sim_advance(uint64_t t)
+{
+    while (sim.shifting && sim.shift_end <= t) {
+        if (sim.rxfull) {
+            sim.ovr = 1;
+            sim.lost++;
+        } else {
+            sim.rxfull = 1;
+            sim.rxval = sim.shift_val ^ 0x5A;
+        }
+        sim.frames++;
+        if (sim.txfull) {
+            sim.txfull = 0;
+            sim.shift_val = sim.txval;
+            sim.shift_end += sim.frame;
+        } else
+            sim.shifting = 0;
+    }
+}
+
+HostSpiSR::operator uint32_t() const
+{
+    uint32_t sr = 0;
+
+    sim.now += sim.access;
+    sim_advance(sim.now);
+    if (!sim.txfull)
+        sr |= SPI_SR_TXE;
+    if (sim.rxfull)
+        sr |= SPI_SR_RXNE;
+    if (sim.shifting || sim.txfull)
+        sr |= SPI_SR_BSY;
+    if (sim.ovr) {
+        sr |= SPI_SR_OVR;
+        /* OVR 은 DR 을 읽은 뒤 SR 을 읽으면 지워진다 */
+        if (sim.ovr_read)
+            sim.ovr = sim.ovr_read = 0;
+    }
+    return sr;
+}
+
+HostSpiDR::operator uint32_t() const
+{
+    sim.now += sim.access;
+    sim_advance(sim.now);
+    sim.rxfull = 0;
+    if (sim.ovr)
+        sim.ovr_read = 1;
+    return sim.rxval;
+}
+
+HostSpiDR& HostSpiDR::operator=(uint32_t value)
+{
+    sim.now += sim.access;
+    sim_advance(sim.now);
+    if (sim.nsent < 4096)
+        sim.sent[sim.nsent++] = (uint16_t)value;
+    if (!sim.shifting) {
+        sim.shifting = 1;
+        sim.shift_val = (uint16_t)value;
+        sim.shift_end = sim.now + 1 + sim.frame;
+    } else {
+        /* TXE 가 0 일 때 쓰면 덮어쓴다 */
+        sim.txfull = 1;
+        sim.txval = (uint16_t)value;
+    }
+    return *this;
+}
+
+extern "C" {
+void gpio_alternate_init(GPIO_Pin_t pin, GPIO_Mode_t mode, uint8_t alternate) {}
+void gpio_set_pinmode(GPIO_Pin_t pin, GPIO_PullMode_t mode) {}
+void gpio_write(GPIO_Pin_t pin, uint16_t value) {}
+}
+
+static void reset(uint32_t frame)
+{
+    memset(&sim, 0, sizeof(sim));
+    sim.access = 4;
+    sim.frame = frame;
+}
+
+static double mbs(int n, uint64_t cycles)
+{
+    return n * 168e6 / cycles / 1e6;
+}
+
+static void check(int ok, const char* what)
+{
+    printf("%-44s %s\n", what, ok ? "ok" : "FAIL");
+    if (!ok)
+        failed = 1;
+}
+
+static int echoed(const uint8_t* tx, const uint8_t* rx, int n)
+{
+    int i;
+
+    for (i = 0; i < n; i++)
+        if (rx[i] != (tx[i] ^ 0x5A))
+            return 0;
+    return 1;
+}
+
+int main(void)
+{
+    static const uint32_t frames[] = {32, 64, 256};
+    static const uint8_t pattern[3] = {1, 2, 3};
+    static uint8_t tx[512], rx[512];
+    static uint16_t tx16[256], rx16[256];
+    uint64_t single, bulk;
+    unsigned f;
+    int i, ok;
+    char what[64];
+
+    for (i = 0; i < 512; i++)
+        tx[i] = i * 7 + 3;
+    for (f = 0; f < sizeof(frames) / sizeof(frames[0]); f++) {
+        printf("SCK %.2f MHz (%u cycles per byte at 168 MHz)\n", 168.0 * 8 / frames[f], (unsigned)frames[f]);
+
+        reset(frames[f]);
+        for (i = 0; i < 512; i++)
+            rx[i] = spi_writeread(SPI_1, tx[i]);
+        single = sim.now;
+        snprintf(what, sizeof(what), "  spi_writeread x512 (%.2f MB/s)", mbs(512, single));
+        check(echoed(tx, rx, 512), what);
+
+        reset(frames[f]);
+        memset(rx, 0, sizeof(rx));
+        ok = spi_nwriteread(SPI_1, tx, rx, 512) == 1 && echoed(tx, rx, 512) && sim.lost == 0;
+        bulk = sim.now;
+        snprintf(what, sizeof(what), "  spi_nwriteread 512 (%.2f MB/s)", mbs(512, bulk));
+        check(ok, what);
+        check(bulk < single && bulk <= 512 * frames[f] + 512 * frames[f] / 50, "  at wire speed, faster than spi_writeread");
+
+        reset(frames[f]);
+        spi_nwrite(SPI_1, tx, 512);
+        ok = sim.nsent == 512 && !sim.shifting && !sim.ovr;
+        for (i = 0; i < 512 && ok; i++)
+            ok = sim.sent[i] == tx[i];
+        check(ok, "  spi_nwrite sends all and ends idle");
+
+        reset(frames[f]);
+        ok = spi_nread(SPI_1, rx, 512, 0xFF) == 1;
+        for (i = 0; i < 512 && ok; i++)
+            ok = rx[i] == (0xFF ^ 0x5A) && sim.sent[i] == 0xFF;
+        check(ok, "  spi_nread sends the fill value");
+
+        reset(frames[f]);
+        spi_nfill(SPI_1, pattern, 3, 170);
+        ok = sim.nsent == 510;
+        for (i = 0; i < 510 && ok; i++)
+            ok = sim.sent[i] == pattern[i % 3];
+        check(ok, "  spi_nfill repeats the pattern");
+    }
+
+    for (i = 0; i < 256; i++)
+        tx16[i] = i * 0x101 + 0x1234;
+    reset(64);
+    SPI1->CR1 |= SPI_CR1_DFF;
+    ok = spi_nwriteread(SPI_1, tx16, rx16, 256) == 1;
+    for (i = 0; i < 256 && ok; i++)
+        ok = rx16[i] == (uint16_t)(tx16[i] ^ 0x5A);
+    SPI1->CR1 &= ~SPI_CR1_DFF;
+    check(ok, "16 bit frames");
+
+    /* 레지스터 접근 한 번이 프레임보다 길면 수신을 놓친다 */
+    reset(32);
+    sim.access = 40;
+    check(spi_nwriteread(SPI_1, tx, rx, 64) == -1 && sim.lost > 0 && !sim.ovr && !sim.shifting,
+          "overrun returns -1 with OVR cleared");
+    reset(32);
+    sim.rxfull = 1;
+    sim.rxval = 0xEE;
+    sim.ovr = 1;
+    check(spi_nwriteread(SPI_1, tx, rx, 16) == 1 && echoed(tx, rx, 16), "stale data and OVR flushed first");
+
+    printf("%s\n", failed ? "FAILED" : "PASSED");
+    return failed;
+}
@@ -0,0 +1,127 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+/*
+ * SPI 분주비 선택 호스트 시험
+ *
+ * 여러 PCLK1/PCLK2 조합과 원하는 주파수에 대해, 가능한 8 개의 분주비를 모두 따져 본 기준값과
+ * 라이브러리가 고른 주파수를 비교한다. 다음을 확인한다.
+ *   - spi_set_frequency() 와 spi_make_profile() 은 원하는 주파수를 넘지 않는 가장 빠른 주파수를,
+ *     모두 넘으면 1/256 을 고르는지
+ *   - SPI_CLOCK_NEAREST 는 가장 가까운 주파수를, 차이가 같으면 느린 쪽을 고르는지
+ *   - spi_get_frequency() 가 CR1 에 쓰인 분주비와 맞는지, 버스마다 맞는 PCLK 를 쓰는지
+ * 실패하면 0 이 아닌 값으로 끝난다.
+ *
+ * 사용법:
+ *   cc -I tools/host -o spiclocktest tools/spiclocktest.c stm32lib/spi.c stm32lib/gpio.c tools/host/host.c
+ *   ./spiclocktest
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include "../stm32lib/spi.h"
+
+static uint32_t pclk1, pclk2;
+static int failed;
+
+uint32_t HAL_RCC_GetPCLK1Freq(void) { return pclk1; }
+uint32_t HAL_RCC_GetPCLK2Freq(void) { return pclk2; }
+
+static void check(int ok, const char* what)
+{
+    printf("%-44s %s\n", what, ok ? "ok" : "FAIL");
+    if (!ok)
+        failed = 1;
+}
+
+/* 분주비 2 ~ 256 을 모두 따져 BELOW 와 NEAREST 의 기준 주파수를 구한다 */
+static void reference(uint32_t pclk, int hz, int* below, int* nearest)
+{
+    long diff = -1;
+    int i;
+
+    *below = pclk >> 8;
+    for (i = 7; i >= 0; i--) {
+        long f = pclk >> (i + 1), d = labs(f - ((hz > 0) ? hz : 0));
+
+        if (hz > 0 && f <= hz)
+            *below = f;
+        if (diff < 0 || d < diff) {
+            diff = d;
+            *nearest = f;
+        }
+    }
+}
+
+int main(void)
+{
+    static const uint32_t pclks[][2] = {{42000000, 84000000}, {45000000, 90000000}, {50000000, 100000000},
+                                        {8000000, 16000000}, {16000000, 16000000}};
+    static const int targets[] = {-5, 0, 1, 100000, 400000, 1000000, 5000000, 10500000, 12000000,
+                                  20000000, 25000000, 42000000, 100000000};
+    static const SPI_t buses[] = {SPI_1, SPI_2};
+    unsigned p, t, b;
+    int bad_below = 0, bad_near = 0, bad_get = 0, bad_profile = 0;
+
+    SPI1->SR = SPI2->SR = SPI_SR_TXE;
+    spi_init(SPI_1, SPI1_PINS1);
+    spi_init(SPI_2, SPI2_PINS1);
+    for (p = 0; p < sizeof(pclks) / sizeof(pclks[0]); p++) {
+        pclk1 = pclks[p][0];
+        pclk2 = pclks[p][1];
+        for (t = 0; t < sizeof(targets) / sizeof(targets[0]); t++) {
+            for (b = 0; b < 2; b++) {
+                int below, nearest, hz = targets[t];
+                SPI_Profile_t profile;
+
+                reference((buses[b] == SPI_1) ? pclk2 : pclk1, hz, &below, &nearest);
+                bad_below += spi_set_frequency(buses[b], hz) != below;
+                bad_get += spi_get_frequency(buses[b]) != below;
+                bad_near += spi_set_clock(buses[b], hz, SPI_CLOCK_NEAREST) != nearest;
+                bad_get += spi_get_frequency(buses[b]) != nearest;
+                bad_profile += spi_make_profile(buses[b], &profile, SPI_Mode3, 16, hz) != below ||
+                               (int)profile.hz != below || !(profile.cr1 & SPI_CR1_DFF);
+            }
+        }
+    }
+    check(bad_below == 0, "BELOW picks fastest not above request");
+    check(bad_near == 0, "NEAREST picks closest, slower on tie");
+    check(bad_get == 0, "spi_get_frequency matches CR1");
+    check(bad_profile == 0, "spi_make_profile never above maximum");
+
+    pclk1 = 42000000;
+    pclk2 = 84000000;
+    check(spi_set_frequency(SPI_1, 12000000) == 10500000 &&
+          spi_set_clock(SPI_1, 12000000, SPI_CLOCK_NEAREST) == 10500000, "SPI1 12 MHz -> 10.5 MHz");
+    check(spi_set_frequency(SPI_2, 400000) == 328125 &&
+          spi_set_clock(SPI_2, 400000, SPI_CLOCK_NEAREST) == 328125, "SPI2 400 kHz -> 328 kHz");
+    check(spi_set_frequency(SPI_1, 35000000) == 21000000 &&
+          spi_set_clock(SPI_1, 35000000, SPI_CLOCK_NEAREST) == 42000000, "SPI1 35 MHz BELOW 21, NEAREST 42");
+    check(spi_get_frequency(SPI_2) == 328125, "SPI2 untouched by SPI1 changes");
+
+    printf("%s\n", failed ? "FAILED" : "PASSED");
+    return failed;
+}
@@ -0,0 +1,249 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+/*
+ * SPI 사용률 보고서 생성기 (호스트 도구)
+ *
+ * SPI_PROF=1 로 빌드한 펌웨어에서 spi_prof_dump() 가 출력한 로그를 읽어서
+ * 장치별 버스 사용률, 시간 분해와 히스토그램을 출력한다.
+ * 로그에 섞인 다른 출력 줄은 무시한다. 같은 장치가 여러 번 나오면 마지막 출력을 사용한다.
+ *
+ * CS 유지 시간(hold)은 다음과 같이 나누어 보인다.
+ *   wire:   SCK 가 실제로 움직인 시간
+ *   frame:  SPI 전송 함수 안에 있었지만 SCK 가 쉰 시간 (프레임 사이 틈)
+ *   driver: CS 를 내린 채 SPI 전송 함수 밖에 있었던 시간
+ *   poll:   SPI 전송 함수 안에서 TXE/RXNE/BSY 를 폴링한 시간 (wire 와 겹친다)
+ *
+ * 사용법:
+ *   cc -o spiprof tools/spiprof.c
+ *   ./spiprof [-s] uart.log
+ *     -s: 히스토그램은 생략하고 요약만 출력
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_DEVICES     64
+#define MAX_BUCKETS     32
+
+typedef struct {
+    unsigned bus;
+    unsigned long cs;
+    unsigned long transactions;
+    unsigned long calls;
+    unsigned long bytes;
+    unsigned long hold;     /* 마이크로초 */
+    unsigned long active;
+    unsigned long wire;
+    unsigned long wait;
+    unsigned long maxhold;
+    unsigned long holdhist[MAX_BUCKETS];
+    unsigned long sizehist[MAX_BUCKETS];
+    unsigned long utilhist[MAX_BUCKETS];
+    int nhold, nsize, nutil;
+} Device_t;
+
+static Device_t devices[MAX_DEVICES];
+static int ndevices;
+
+static Device_t *find_device(unsigned bus, unsigned long cs)
+{
+    int i;
+
+    for (i = 0; i < ndevices; i++)
+        if (devices[i].bus == bus && devices[i].cs == cs)
+            return &devices[i];
+    if (ndevices == MAX_DEVICES)
+        return NULL;
+    devices[ndevices].bus = bus;
+    devices[ndevices].cs = cs;
+    return &devices[ndevices++];
+}
+
+/* 펌웨어의 GPIO_Pin_t 값을 핀 이름으로 바꾼다 */
+static const char *pin_name(unsigned long cs)
+{
+    static char name[8];
+
+    if (cs == 0xFFFFFFFFUL)
+        return "-";
+    snprintf(name, sizeof(name), "P%c%lu", (int)('A' + ((cs >> 4) & 0x0F)), cs & 0x0F);
+    return name;
+}
+
+/* 공백으로 나뉜 숫자들을 읽는다 */
+static int parse_list(const char *p, unsigned long *values, int max)
+{
+    char *end;
+    int n = 0;
+
+    while (n < max) {
+        values[n] = strtoul(p, &end, 10);
+        if (end == p)
+            break;
+        p = end;
+        n++;
+    }
+    return n;
+}
+
+static double percent(unsigned long part, unsigned long whole)
+{
+    return (whole > 0) ? (double)part * 100.0 / (double)whole : 0.0;
+}
+
+static void print_histogram(const char *title, const unsigned long *hist, int n, int log2, const char *unit)
+{
+    unsigned long max = 0;
+    char range[48];
+    int i, j, width;
+
+    for (i = 0; i < n; i++)
+        if (hist[i] > max)
+            max = hist[i];
+    if (max == 0)
+        return;
+    printf("  %s\n", title);
+    for (i = 0; i < n; i++) {
+        if (hist[i] == 0)
+            continue;
+        if (log2) {
+            /* 0 번은 0, i 번은 2^(i-1) 이상 2^i 미만, 마지막은 그 이상 */
+            if (i == 0)
+                snprintf(range, sizeof(range), "0");
+            else if (i == n - 1)
+                snprintf(range, sizeof(range), ">= %lu", 1UL << (i - 1));
+            else
+                snprintf(range, sizeof(range), "%lu-%lu", 1UL << (i - 1), (1UL << i) - 1);
+        } else {
+            snprintf(range, sizeof(range), "%d-%d%%", i * 100 / n, (i + 1) * 100 / n);
+        }
+        width = (int)(hist[i] * 40 / max);
+        printf("  %16s %-3s %8lu ", range, unit, hist[i]);
+        for (j = 0; j < width; j++)
+            putchar('#');
+        putchar('\n');
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    FILE *fp = stdin;
+    char line[512];
+    unsigned long clock = 0, value[10];
+    unsigned bus;
+    int i, summary = 0;
+    Device_t *dev = NULL;
+    unsigned long frame, driver;
+
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-s") == 0)
+            summary = 1;
+        else if ((fp = fopen(argv[i], "r")) == NULL) {
+            perror(argv[i]);
+            return 1;
+        }
+    }
+
+    while (fgets(line, sizeof(line), fp) != NULL) {
+        if (sscanf(line, "# spiprof clock=%lu", &clock) == 1)
+            continue;
+        if (sscanf(line, "D SPI%u %lx %lu %lu %lu %lu %lu %lu %lu %lu", &bus, &value[0],
+                   &value[1], &value[2], &value[3], &value[4], &value[5], &value[6], &value[7], &value[8]) == 10) {
+            dev = find_device(bus, value[0]);
+            if (dev == NULL)
+                continue;
+            memset(dev->holdhist, 0, sizeof(dev->holdhist));
+            memset(dev->sizehist, 0, sizeof(dev->sizehist));
+            memset(dev->utilhist, 0, sizeof(dev->utilhist));
+            dev->transactions = value[1];
+            dev->calls = value[2];
+            dev->bytes = value[3];
+            dev->hold = value[4];
+            dev->active = value[5];
+            dev->wire = value[6];
+            dev->wait = value[7];
+            dev->maxhold = value[8];
+            continue;
+        }
+        /* 히스토그램 줄은 바로 앞의 장치 줄에 속한다 */
+        if (dev == NULL || line[1] != ' ')
+            continue;
+        if (line[0] == 'H')
+            dev->nhold = parse_list(line + 1, dev->holdhist, MAX_BUCKETS);
+        else if (line[0] == 'S')
+            dev->nsize = parse_list(line + 1, dev->sizehist, MAX_BUCKETS);
+        else if (line[0] == 'U')
+            dev->nutil = parse_list(line + 1, dev->utilhist, MAX_BUCKETS);
+    }
+    if (fp != stdin)
+        fclose(fp);
+
+    if (ndevices == 0) {
+        fprintf(stderr, "no profile entries\n");
+        return 1;
+    }
+
+    printf("clock %lu Hz, times in us\n", clock);
+    printf(" bus   cs     trans    calls     bytes  bytes/tr      hold  maxhold   wire  frame driver   poll   bytes/s\n");
+    for (i = 0; i < ndevices; i++) {
+        dev = &devices[i];
+        /* 마이크로초로 내림한 값이라 순서가 뒤집힐 수 있다 */
+        frame = (dev->active > dev->wire) ? dev->active - dev->wire : 0;
+        driver = (dev->hold > dev->active) ? dev->hold - dev->active : 0;
+        printf(" SPI%u %-5s %8lu %8lu %9lu %9.1f %9lu %8lu %5.1f%% %5.1f%% %5.1f%% %5.1f%% %9.0f\n",
+               dev->bus, pin_name(dev->cs), dev->transactions, dev->calls, dev->bytes,
+               dev->transactions ? (double)dev->bytes / dev->transactions : 0.0,
+               dev->hold, dev->maxhold,
+               percent(dev->wire, dev->hold), percent(frame, dev->hold),
+               percent(driver, dev->hold), percent(dev->wait, dev->hold),
+               dev->hold ? (double)dev->bytes * 1e6 / dev->hold : 0.0);
+    }
+
+    for (i = 0; i < ndevices; i++) {
+        dev = &devices[i];
+        frame = (dev->active > dev->wire) ? dev->active - dev->wire : 0;
+        driver = (dev->hold > dev->active) ? dev->hold - dev->active : 0;
+
+        printf("\nSPI%u %s\n", dev->bus, pin_name(dev->cs));
+        /* 사용률을 가장 많이 깎는 원인을 알려 준다 */
+        if (percent(frame, dev->hold) >= 25.0 && dev->calls > dev->transactions * 4)
+            printf("  SCK idles between frames inside many small calls: batch them with spi_nwrite() or SPIASYNC DMA\n");
+        else if (percent(frame, dev->hold) >= 25.0)
+            printf("  SCK idles between frames inside transfers: check for interrupt load or per-frame work\n");
+        if (percent(driver, dev->hold) >= 25.0)
+            printf("  CS is held while the driver works outside SPI calls: prepare data before spi_select()\n");
+        if (dev->cs == 0xFFFFFFFFUL)
+            printf("  transfers outside spi_select()/spi_deselect(): each call counts as one transaction\n");
+        if (summary)
+            continue;
+        print_histogram("CS hold time", dev->holdhist, dev->nhold, 1, "us");
+        print_histogram("transaction size", dev->sizehist, dev->nsize, 1, "B");
+        print_histogram("wire utilisation", dev->utilhist, dev->nutil, 0, "");
+    }
+    return 0;
+}
@@ -0,0 +1,235 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+/*
+ * SPISLAVE 호스트 시험
+ *
+ * SPI1 과 DMA2 스트림 0(수신), 3(송신)을 흉내 내어 마스터가 NSS 로 구분한 프레임을
+ * 한 바이트씩 보내고, NSS 가 올라갈 때 외부 인터럽트 함수를 부른다. 수신 스트림은
+ * 반 바퀴와 한 바퀴를 돌 때 HT/TC 플래그를 세운다. 다음을 확인한다.
+ *   - 응답이 프레임 경계에서만 바뀌고, 응답보다 길게 읽으면 처음부터 반복되는지
+ *   - 버퍼 끝에서 되돌아간 프레임을 포함해 받은 데이터가 모두 그대로 전달되는지
+ *   - 반 바퀴보다 긴 정상 프레임은 넘침으로 보지 않는지
+ *   - rxsize 이상 rxsize * 3 / 2 미만으로 넘친 프레임은 버리고 errors 로 세는지
+ * DMA 주소 레지스터가 32 비트이므로 버퍼가 4 GB 아래에 놓이도록 -no-pie 로 링크한다.
+ * 실패하면 0 이 아닌 값으로 끝난다.
+ *
+ * 사용법:
+ *   cc -no-pie -I tools/host -o spislavetest tools/spislavetest.c stm32lib/spislave.c stm32lib/spi.c \
+ *      tools/host/host.c
+ *   ./spislavetest
+ */
+#include <stdio.h>
+#include <string.h>
+#include "../stm32lib/spislave.h"
+#include "../stm32lib/extirq.h"
+
+#define RXSIZE  64
+
+static EXTIRQ_Callback_t nss_handler;
+static int nss_level = 1;
+static int txloaded, txpos, txn;
+static uint8_t txdr;
+static int failed;
+
+/* 흉내 낸 GPIO 와 외부 인터럽트. NSS 핀의 값만 기억한다 */
+EXTIRQ_Res_t extirq_init(GPIO_Pin_t pin, EXTIRQ_Callback_t callback, EXTIRQ_Edge_t edge)
+{
+    nss_handler = callback;
+    return EXTIRQ_RES_OK;
+}
+
+void extirq_free(GPIO_Pin_t pin)
+{
+    nss_handler = NULL;
+}
+
+void gpio_alternate_init(GPIO_Pin_t pin, GPIO_Mode_t mode, uint8_t alternate) {}
+void gpio_set_pinmode(GPIO_Pin_t pin, GPIO_PullMode_t mode) {}
+void gpio_write(GPIO_Pin_t pin, uint16_t value) {}
+
+uint16_t gpio_read(GPIO_Pin_t pin)
+{
+    return nss_level;
+}
+
+/* LIFCR 쓰기는 곧바로 LISR 의 플래그를 지워야 하지만 흉내 낸 레지스터는 그냥 메모리이므로,
+   라이브러리가 부르는 다음 지점(SPI 리셋, 다음 바이트)에서 반영한다 */
+static void sim_clear_flags(void)
+{
+    DMA2->LISR &= ~DMA2->LIFCR;
+    DMA2->LIFCR = 0;
+}
+
+/* RCC 리셋은 DR 에 들어간 송신 데이터도 지운다 */
+void host_spi_reset(SPI_TypeDef *SPIx)
+{
+    sim_clear_flags();
+    SPIx->CR1 = 0;
+    SPIx->CR2 = 0;
+    txloaded = 0;
+    txpos = 0;
+}
+
+/* 송신 스트림이 켜져 있으면 다음 바이트를 DR 로 옮긴다 */
+static void sim_load(void)
+{
+    DMA_Stream_TypeDef *tx = DMA2_Stream3;
+
+    if (txloaded || !(tx->CR & DMA_SxCR_EN) || !(SPI1->CR2 & SPI_CR2_TXDMAEN))
+        return;
+    if (txpos == 0)
+        txn = tx->NDTR;
+    txdr = *((uint8_t *)(uintptr_t)tx->M0AR + ((tx->CR & DMA_SxCR_MINC) ? txpos : 0));
+    txpos = (txpos + 1) % txn;
+    txloaded = 1;
+}
+
+/* 한 바이트를 주고받는다. 수신 스트림은 원형으로 돌며 HT(비트 4), TC(비트 5)를 세운다 */
+static uint8_t sim_xfer(uint8_t in)
+{
+    DMA_Stream_TypeDef *rx = DMA2_Stream0;
+    uint8_t out;
+
+    sim_clear_flags();
+    sim_load();
+    out = txloaded ? txdr : 0xEE;
+    txloaded = 0;
+    if ((SPI1->CR1 & SPI_CR1_SPE) && (SPI1->CR2 & SPI_CR2_RXDMAEN) && (rx->CR & DMA_SxCR_EN)) {
+        ((uint8_t *)(uintptr_t)rx->M0AR)[RXSIZE - rx->NDTR] = in;
+        if (--rx->NDTR == RXSIZE / 2)
+            DMA2->LISR |= 0x10;
+        if (rx->NDTR == 0) {
+            DMA2->LISR |= 0x20;
+            rx->NDTR = RXSIZE;
+        }
+    }
+    sim_load();
+    return out;
+}
+
+static uint8_t got[512];
+static int ngot, nframes, wrapped;
+
+static void received(SPI_Slave_t* slave, const SPI_SlaveFrame_t* frame)
+{
+    memcpy(got + ngot, frame->data, frame->length);
+    ngot += frame->length;
+    memcpy(got + ngot, frame->wrap, frame->wraplength);
+    ngot += frame->wraplength;
+    if (frame->wraplength > 0)
+        wrapped++;
+    nframes++;
+}
+
+static uint8_t rxbuf[RXSIZE], tx0[16], tx1[16];
+static SPI_Slave_t slave = {rxbuf, sizeof(rxbuf), {tx0, tx1}, sizeof(tx0), received, NULL};
+
+/* NSS 를 내리고 n 바이트를 보낸 뒤 NSS 를 올린다 */
+static void frame(const char* out, int n, char* reply)
+{
+    int i;
+
+    nss_level = 0;
+    for (i = 0; i < n; i++)
+        reply[i] = sim_xfer(out[i]);
+    nss_level = 1;
+    nss_handler(0, 1);
+}
+
+static int respond(const char* s)
+{
+    uint8_t *next = spi_slave_prepare(SPI_1);
+
+    if (next == NULL)
+        return -1;
+    memcpy(next, s, strlen(s));
+    return spi_slave_commit(SPI_1, strlen(s));
+}
+
+static void check(int ok, const char* what)
+{
+    printf("%-44s %s\n", what, ok ? "ok" : "FAIL");
+    if (!ok)
+        failed = 1;
+}
+
+int main(void)
+{
+    char reply[128], big[96];
+    const char *expect = "HELLOWORLD!xyz123qabcdefgh";
+    SPI_SlaveStats_t st;
+    int i, n, frames, errors;
+
+    check(spi_slave_init(SPI_1, GPIO_PA_4, SPI_Mode0, 8, &slave) == 1, "init");
+    check(spi_slave_init(SPI_2, GPIO_PA_4, SPI_Mode0, 8, &slave) == -1, "unsupported NSS pin rejected");
+
+    frame("HELLO", 5, reply);
+    check(memcmp(reply, "\xFF\xFF\xFF\xFF\xFF", 5) == 0, "fill value before first response");
+    check(respond("ABCD") == 1, "commit response");
+    check(spi_slave_prepare(SPI_1) == NULL, "prepare refused while pending");
+    /* 이미 시작된 프레임의 응답은 바꿀 수 없으므로 commit 한 응답은 그 다음 프레임 경계에서 바뀐다 */
+    frame("WORLD!", 6, reply);
+    check(memcmp(reply, "\xFF\xFF\xFF\xFF\xFF\xFF", 6) == 0, "response kept until frame boundary");
+    frame("xyz123", 6, reply);
+    check(memcmp(reply, "ABCDAB", 6) == 0, "new response repeated from its beginning");
+    check(respond("1234567") == 1, "commit second response");
+    frame("q", 1, reply);
+    check(reply[0] == 'A', "previous response sent again");
+    nss_handler(0, 1);
+    frame("abcdefgh", 8, reply);
+    check(memcmp(reply, "12345671", 8) == 0, "second response after spurious NSS edge");
+
+    /* 40 바이트 프레임은 반 바퀴와 한 바퀴를 모두 지나지만 넘친 것이 아니다 */
+    for (i = 0; i < (int)sizeof(big); i++)
+        big[i] = 'a' + i % 26;
+    frame(big, 40, reply);
+    frame(big, 30, reply);
+    n = strlen(expect);
+    check(ngot == n + 70 && memcmp(got, expect, n) == 0 &&
+          memcmp(got + n, big, 40) == 0 && memcmp(got + n + 40, big, 30) == 0, "received data intact");
+    check(wrapped > 0, "wrapped frame delivered in two pieces");
+    spi_slave_get_stats(SPI_1, &st);
+    check(st.frames == 7 && st.errors == 0, "long frames not taken as overflow");
+
+    /* rxsize + 10 과 rxsize + rxsize / 2 - 1 바이트 프레임은 버린다 */
+    frames = nframes;
+    errors = st.errors;
+    frame(big, RXSIZE + 10, reply);
+    frame(big, RXSIZE + RXSIZE / 2 - 1, reply);
+    spi_slave_get_stats(SPI_1, &st);
+    check(nframes == frames && st.errors == errors + 2, "overflowed frames dropped and counted");
+    ngot = 0;
+    frame("after", 5, reply);
+    check(ngot == 5 && memcmp(got, "after", 5) == 0, "next frame received after overflow");
+
+    spi_slave_deinit(SPI_1);
+    check(spi_slave_init(SPI_1, GPIO_PA_4, SPI_Mode0, 8, &slave) == 1, "init again after deinit");
+
+    printf("%s\n", failed ? "FAILED" : "PASSED");
+    return failed;
+}
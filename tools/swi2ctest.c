@@ -0,0 +1,230 @@
+/*
+ *----------------------------------------------------------------------
+ * Copyright (C) Seong-Woo Kim, 2018
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of
+ * this software and associated documentation files
+ * (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and
+ * to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *----------------------------------------------------------------------
+ */
+/*
+ * SWI2C 호스트 시험
+ *
+ * SCL(PB_8)과 SDA(PC_9)의 BSRR 쓰기를 비트 단위로 따라가는 I2C 슬레이브(주소 0xD0, 레지스터 32 개)를
+ * 흉내 낸다. SWI2C_TIMESTAMP() 를 host_cycles() 로 바꾸고 그 함수가 불릴 때마다 버스를 한 걸음
+ * 진행시키므로, 지연 루프 하나하나가 버스의 시간이 된다. 다음을 확인한다.
+ *   - 주소 응답(ACK)과 무응답(NAK)
+ *   - 반복 START 를 쓰는 연속 읽기와 연속 쓰기, 한 바이트 읽기
+ *   - 14 바이트 읽기가 한 전송(주소 + 레지스터 + 주소 + 14 바이트, 바이트마다 9 클록)으로 끝나는지
+ *   - 슬레이브의 클록 늘이기를 기다리는지, SCL 이 풀리지 않으면 오류로 끝나고 다음 전송은 되는지
+ * 실패하면 0 이 아닌 값으로 끝난다.
+ *
+ * 사용법:
+ *   cc -I tools/host '-DSWI2C_TIMESTAMP()=host_cycles()' -o swi2ctest tools/swi2ctest.c stm32lib/swi2c.c \
+ *      stm32lib/gpio.c tools/host/host.c
+ *   ./swi2ctest
+ */
+#include <stdio.h>
+#include <string.h>
+#include "../stm32lib/swi2c.h"
+
+enum { IDLE, RXADDR, RXDATA, ACKOUT, TXDATA, ACKIN };
+
+static GPIO_TypeDef *sclport, *sdaport;
+static uint32_t sclmask, sdamask;
+static int master_scl = 1, master_sda = 1, slave_sda_low, slave_hold, bus_scl = 1, bus_sda = 1;
+static uint32_t ticks, clocks, stretch_ticks;
+static uint8_t regs[32];
+static int phase, bitcnt, shift, dir, first, regptr, nack, cur;
+static int failed;
+
+static void on_start(void)
+{
+    phase = RXADDR;
+    bitcnt = 0;
+    shift = 0;
+    slave_sda_low = 0;
+}
+
+static void on_stop(void)
+{
+    phase = IDLE;
+    slave_sda_low = 0;
+}
+
+/* SCL 이 올라갈 때 SDA 를 읽는다 */
+static void on_rise(int sda)
+{
+    clocks++;
+    if (phase == RXADDR || phase == RXDATA) {
+        shift = (shift << 1) | sda;
+        bitcnt++;
+    } else if (phase == TXDATA)
+        bitcnt++;
+    else if (phase == ACKIN)
+        nack = sda;
+}
+
+static void load(void)
+{
+    cur = regs[regptr++ & 31];
+    bitcnt = 0;
+    phase = TXDATA;
+    slave_sda_low = !(cur & 0x80);
+}
+
+/* SCL 이 내려갈 때 슬레이브가 SDA 를 바꾼다 */
+static void on_fall(void)
+{
+    if ((phase == RXADDR || phase == RXDATA) && bitcnt == 8) {
+        if (phase == RXADDR) {
+            if ((shift & 0xFE) == 0xD0) {
+                dir = shift & 1;
+                slave_sda_low = 1;
+                phase = ACKOUT;
+                first = 1;
+            } else
+                phase = IDLE;
+        } else {
+            if (first) {
+                regptr = shift;
+                first = 0;
+            } else
+                regs[regptr++ & 31] = shift;
+            slave_sda_low = 1;
+            phase = ACKOUT;
+        }
+    } else if (phase == ACKOUT) {
+        slave_sda_low = 0;
+        slave_hold = stretch_ticks;
+        if (dir)
+            load();
+        else {
+            phase = RXDATA;
+            bitcnt = 0;
+            shift = 0;
+        }
+    } else if (phase == TXDATA) {
+        if (bitcnt == 8) {
+            slave_sda_low = 0;
+            phase = ACKIN;
+        } else
+            slave_sda_low = !((cur << bitcnt) & 0x80);
+    } else if (phase == ACKIN) {
+        if (nack)
+            phase = IDLE;
+        else
+            load();
+    }
+}
+
+/* SWI2C_TIMESTAMP(): 마스터가 BSRR 에 쓴 값을 반영하고 버스를 한 걸음 진행한다 */
+uint32_t host_cycles(void)
+{
+    int scl, sda;
+
+    if (sclport->BSRR & sclmask)
+        master_scl = 1;
+    if (sclport->BSRR & (sclmask << 16))
+        master_scl = 0;
+    sclport->BSRR = 0;
+    if (sdaport->BSRR & sdamask)
+        master_sda = 1;
+    if (sdaport->BSRR & (sdamask << 16))
+        master_sda = 0;
+    sdaport->BSRR = 0;
+    if (slave_hold > 0)
+        slave_hold--;
+
+    scl = master_scl && !slave_hold;
+    sda = master_sda && !slave_sda_low;
+    if (scl && !bus_scl)
+        on_rise(sda);
+    else if (!scl && bus_scl)
+        on_fall();
+    else if (scl && bus_scl && sda != bus_sda) {
+        if (!sda)
+            on_start();
+        else
+            on_stop();
+    }
+    bus_scl = scl;
+    bus_sda = master_sda && !slave_sda_low;
+    sclport->IDR = scl ? sclmask : 0;
+    sdaport->IDR = bus_sda ? sdamask : 0;
+    return ++ticks;
+}
+
+static void check(int ok, const char* what)
+{
+    printf("%-44s %s\n", what, ok ? "ok" : "FAIL");
+    if (!ok)
+        failed = 1;
+}
+
+int main(void)
+{
+    static const uint8_t w[] = {0x11, 0x22, 0x33};
+    SWI2C_t bus;
+    uint8_t d[32];
+    int i, ok;
+
+    sclport = gpio_get_port_base(GPIO_PB_8);
+    sdaport = gpio_get_port_base(GPIO_PC_9);
+    sclmask = GPIO_REG_VALUE(GPIO_PB_8);
+    sdamask = GPIO_REG_VALUE(GPIO_PC_9);
+    sclport->IDR = sclmask;
+    sdaport->IDR = sdamask;
+    SystemCoreClock = 84000000;
+    for (i = 0; i < 32; i++)
+        regs[i] = 0xA0 + i;
+
+    swi2c_init(&bus, GPIO_PB_8, GPIO_PC_9, 400000);
+    printf("half %u stretch %u\n", (unsigned)bus.half, (unsigned)bus.stretch);
+    check(bus.half > 0 && bus.half <= SystemCoreClock / 400000 / 2, "half period not longer than 400 kHz");
+    check(swi2c_ready(&bus, 0xD0) == 1, "slave 0xD0 acknowledges");
+    check(swi2c_ready(&bus, 0x40) == -1, "absent 0x40 not acknowledged");
+
+    clocks = 0;
+    ok = swi2c_nread(&bus, 0xD0, 27, d, 14) == 1;
+    for (i = 0; i < 14; i++)
+        ok &= d[i] == 0xA0 + ((27 + i) & 31);
+    check(ok, "14 byte read with repeated start");
+    printf("14 byte read: %u SCL clocks\n", (unsigned)clocks);
+    /* 17 바이트 x 9 클록에 반복 START 와 STOP 앞에서 SCL 을 올리는 두 번 */
+    check(clocks == 17 * 9 + 2, "single transfer, 17 bytes of 9 clocks");
+
+    check(swi2c_nwrite(&bus, 0xD0, 5, (uint8_t *)w, 3) == 1 && regs[4] == 0xA4 && regs[5] == 0x11 &&
+          regs[6] == 0x22 && regs[7] == 0x33 && regs[8] == 0xA8, "burst write");
+    check(swi2c_read(&bus, 0xD0, 6, d) == 1 && d[0] == 0x22, "single register read");
+
+    stretch_ticks = 50;
+    check(swi2c_nread(&bus, 0xD0, 5, d, 3) == 1 && d[0] == 0x11 && d[1] == 0x22 && d[2] == 0x33, "read with clock stretching");
+    stretch_ticks = 100000000;
+    check(swi2c_read(&bus, 0xD0, 5, d) == -1, "stuck SCL ends with an error");
+    stretch_ticks = 0;
+    slave_hold = 0;
+    check(swi2c_read(&bus, 0xD0, 5, d) == 1 && d[0] == 0x11, "next transfer after stuck SCL");
+    check(bus_scl && bus_sda && phase == IDLE, "bus released after the last transfer");
+
+    printf("%s\n", failed ? "FAILED" : "PASSED");
+    return failed;
+}